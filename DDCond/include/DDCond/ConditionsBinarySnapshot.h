@@ -0,0 +1,269 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDCOND_CONDITIONSBINARYSNAPSHOT_H
+#define DDCOND_CONDITIONSBINARYSNAPSHOT_H
+
+// Framework include files
+#include "DDCond/ConditionsPool.h"
+
+// C/C++ include files
+#include <set>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for implementation details of the AIDA detector description toolkit
+  namespace cond {
+
+    /// Forward declarations
+    class ConditionsIOVPool;
+
+    /// Helper to save conditions snapshots in a flat binary format
+    /**
+     *  Unlike the ConditionsRootPersistency the snapshot does not stream
+     *  conditions objects. The file consists of
+     *  - a header,
+     *  - the table of the IOV types used,
+     *  - the index of all conditions sorted by the conditions key and the IOV,
+     *  - the names of the conditions and
+     *  - the payload region with the data of all conditions.
+     *
+     *  Only payloads with a fixed layout are supported: scalars, strings,
+     *  vectors of scalars and alignment deltas. Alignment data are saved as
+     *  their alignment delta (see align::Keys::deltaKey) and are recomputed
+     *  after loading. All other conditions are skipped.
+     *  The file is written in the native byte order and is not portable
+     *  between machines of different endianess.
+     *
+     *  Snapshot files are read by mapping them to memory (see MappedFile).
+     *  The index is accessed in place, the payload of a condition is only
+     *  decoded when the condition is requested.
+     *  The loader DD4hep_Conditions_binary_snapshot_Loader serves the conditions
+     *  of snapshot files to the conditions manager.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_CONDITIONS
+     */
+    class ConditionsBinarySnapshot  {
+    public:
+      /// Payload data types
+      enum DataType   {
+        TYPE_INT           = 1,
+        TYPE_LONG          = 2,
+        TYPE_FLOAT         = 3,
+        TYPE_DOUBLE        = 4,
+        TYPE_STRING        = 5,
+        TYPE_VECTOR_INT    = 6,
+        TYPE_VECTOR_LONG   = 7,
+        TYPE_VECTOR_FLOAT  = 8,
+        TYPE_VECTOR_DOUBLE = 9,
+        TYPE_DELTA         = 10
+      };
+
+      /// Header of the binary snapshot file
+      struct Header {
+        /// File identifier: "DD4CSNP"
+        char          magic[8]      { 'D','D','4','C','S','N','P', 0 };
+        /// File format version
+        std::uint32_t version       { 1 };
+        /// Byte order marker
+        std::uint32_t byteOrder     { 0x01020304 };
+        /// Size of the header to check the layout
+        std::uint32_t headerSize    { sizeof(Header) };
+        /// Size of an index entry to check the layout
+        std::uint32_t entrySize     { 0 };
+        /// Number of IOV types
+        std::uint64_t numTypes      { 0 };
+        /// Number of index entries
+        std::uint64_t numEntries    { 0 };
+        /// File offset of the IOV type table
+        std::uint64_t typesOffset   { 0 };
+        /// File offset of the index
+        std::uint64_t indexOffset   { 0 };
+        /// File offset of the names
+        std::uint64_t stringsOffset { 0 };
+        /// Size of the names region
+        std::uint64_t stringsSize   { 0 };
+        /// File offset of the payload region
+        std::uint64_t payloadOffset { 0 };
+        /// Size of the payload region
+        std::uint64_t payloadSize   { 0 };
+      };
+
+      /// IOV type table entry
+      struct TypeEntry {
+        /// IOV type identifier
+        std::uint32_t type;
+        /// Length of the IOV type name
+        std::uint32_t nameLength;
+        /// Offset of the IOV type name in the names region
+        std::uint64_t nameOffset;
+      };
+
+      /// Index entry of one condition
+      struct Entry {
+        /// Conditions key
+        std::uint64_t key;
+        /// Lower bound of the IOV
+        std::int64_t  lower;
+        /// Upper bound of the IOV
+        std::int64_t  upper;
+        /// Offset of the data in the payload region
+        std::uint64_t offset;
+        /// Size of the data in bytes
+        std::uint64_t size;
+        /// Offset of the condition name in the names region
+        std::uint64_t nameOffset;
+        /// Length of the condition name
+        std::uint32_t nameLength;
+        /// IOV type identifier
+        std::uint32_t iovType;
+        /// Payload data type (see DataType)
+        std::uint32_t dataType;
+        /// Conditions flags
+        std::uint32_t flags;
+      };
+
+      /// Payload layout of alignment deltas
+      struct DeltaData {
+        double        translation[3];
+        double        pivot[3];
+        /// Rotation angles phi, theta, psi
+        double        rotation[3];
+        std::uint32_t flags;
+        std::uint32_t reserved;
+      };
+
+      /// Read-only memory mapping of a binary snapshot file
+      /**
+       *  The file is validated when mapped. Index entries point directly
+       *  into the mapped memory. The mapping must outlive the entries, but
+       *  not the decoded conditions: their payload is owned by the condition.
+       *
+       *  \author  M.Frank
+       *  \version 1.0
+       *  \ingroup DD4HEP_CONDITIONS
+       */
+      class MappedFile  {
+        /// Name of the mapped file
+        std::string          m_name;
+        /// Start of the mapped memory
+        void*                m_mapping  { nullptr };
+        /// Size of the mapped memory
+        std::size_t          m_size     { 0 };
+        /// Reference to the file header
+        const Header*        m_header   { nullptr };
+        /// Start of the IOV type table
+        const TypeEntry*     m_types    { nullptr };
+        /// Start of the index
+        const Entry*         m_entries  { nullptr };
+        /// Start of the names region
+        const char*          m_strings  { nullptr };
+        /// Start of the payload region
+        const unsigned char* m_payload  { nullptr };
+
+      public:
+        /// Initializing constructor: map the file to memory
+        MappedFile(const std::string& file_name);
+        /// No copy constructor
+        MappedFile(const MappedFile& copy) = delete;
+        /// Default destructor: unmap the file
+        ~MappedFile();
+        /// No assignment
+        MappedFile& operator=(const MappedFile& copy) = delete;
+
+        /// Access the file name
+        const std::string& name()  const          {  return m_name;                  }
+        /// Access the file header
+        const Header& header()  const             {  return *m_header;               }
+        /// Number of conditions in the file
+        std::size_t size()  const                 {  return m_header->numEntries;    }
+        /// Access the IOV type table
+        const TypeEntry* types()  const           {  return m_types;                 }
+        /// Index begin
+        const Entry* begin()  const               {  return m_entries;               }
+        /// Index end
+        const Entry* end()  const                 {  return m_entries + size();      }
+        /// Access a string from the names region
+        std::string string(std::uint64_t offset, std::uint32_t length)  const;
+        /// Find all entries of a given conditions key
+        std::pair<const Entry*, const Entry*> find(Condition::key_type key)  const;
+        /// Find the first entry of a given conditions key with an IOV containing the requested IOV
+        const Entry* find(Condition::key_type key, const IOV& required)  const;
+        /// Create the condition of an index entry and decode its payload
+        Condition decode(const Entry& entry)  const;
+      };
+
+    protected:
+      /// Sort criterium of the index entries
+      typedef std::tuple<std::uint64_t, std::uint32_t, std::int64_t, std::int64_t> key_type;
+
+      /// IOV type table
+      std::vector<TypeEntry>     m_types;
+      /// Conditions index
+      std::vector<Entry>         m_entries;
+      /// Names region
+      std::string                m_strings;
+      /// Payload region
+      std::vector<unsigned char> m_payload;
+      /// Keys of the conditions already added
+      std::set<key_type>         m_keys;
+      /// Number of conditions with an unsupported payload type
+      std::size_t                m_numSkipped = 0;
+
+      /// Add a string to the names region
+      std::uint64_t addString(const std::string& value);
+      /// Add a data block to the payload region
+      std::uint64_t addPayload(const void* data, std::size_t len);
+      /// Add a single condition
+      bool add(const IOV& iov, Condition condition);
+
+    public:
+      /// Time used for the last operation in seconds
+      float duration = 0;
+
+      /// Default constructor
+      ConditionsBinarySnapshot() = default;
+      /// No copy constructor
+      ConditionsBinarySnapshot(const ConditionsBinarySnapshot& copy) = delete;
+      /// Default destructor
+      ~ConditionsBinarySnapshot() = default;
+      /// No assignment
+      ConditionsBinarySnapshot& operator=(const ConditionsBinarySnapshot& copy) = delete;
+
+      /// Number of conditions in the snapshot
+      std::size_t size()  const                   {  return m_entries.size();        }
+      /// Number of conditions skipped due to an unsupported payload type
+      std::size_t numSkipped()  const             {  return m_numSkipped;            }
+      /// Clear object content and release allocated memory
+      void clear();
+
+      /// Add conditions content to be saved
+      std::size_t add(const IOV& iov, const std::vector<Condition>& conditions);
+      /// Add conditions content to be saved
+      std::size_t add(ConditionsPool& pool);
+      /// Add conditions content to be saved
+      std::size_t add(const ConditionsIOVPool& pool);
+
+      /// Save the snapshot to a file. Returns the number of bytes written
+      long save(const std::string& file_name);
+    };
+
+  }        /* End namespace cond                            */
+}          /* End namespace dd4hep                          */
+#endif // DDCOND_CONDITIONSBINARYSNAPSHOT_H
@@ -24,6 +24,10 @@ namespace dd4hep {
 
     /// Base class to handle conditions cleanups
     /**
+     *  The ages of the conditions pools (ConditionsPool::age_value) are written
+     *  lazily by the IOV index of the ConditionsIOVPool. They are up to date when
+     *  the policy is called from ConditionsManager::clean() or ConditionsIOVPool::clean().
+     *  Code calling a policy directly must call ConditionsIOVPool::updateAges() first.
      *
      *  \author  M.Frank
      *  \version 1.0
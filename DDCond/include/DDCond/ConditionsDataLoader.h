@@ -14,6 +14,7 @@
 #define DDCOND_CONDITIONSDATALOADER_H
 
 // Framework include files
+#include "DD4hep/Mutex.h"
 #include "DD4hep/Conditions.h"
 #include "DD4hep/NamedObject.h"
 #include "DD4hep/ComponentProperties.h"
@@ -60,6 +61,8 @@ namespace dd4hep {
       ConditionsManager m_mgr;
       /// Property: input data source definitions
       Sources           m_sources;
+      /// Lock to serialize load requests of concurrent user pools
+      dd4hep_mutex_t    m_lock;
 
     protected:
       /// Queue update to manager.
@@ -76,6 +79,8 @@ namespace dd4hep {
       virtual void initialize()    {}
       /// Access conditions manager
       ConditionsManager manager() const  {  return m_mgr; }
+      /// Access the lock serializing load requests. Loaders themselves are not thread safe
+      dd4hep_mutex_t& lock()             {  return m_lock; }
       /// Access to properties
       Property& operator[](const std::string& property_name);
       /// Access to properties (CONST)
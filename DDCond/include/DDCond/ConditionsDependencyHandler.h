@@ -19,6 +19,10 @@
 #include "DDCond/ConditionsPool.h"
 #include "DDCond/ConditionsManager.h"
 
+// C/C++ include files
+#include <atomic>
+#include <shared_mutex>
+
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
 
@@ -44,6 +48,15 @@ namespace dd4hep {
      *  ConditionResolver interface in order to allow for upgrades of
      *  this implementation which might not be polymorph.
      *
+     *  If the conditions manager property "ComputeThreads" is non-zero,
+     *  the dependencies are ordered by the keys in ConditionDependency::dependencies
+     *  and executed in topological waves: all items of one wave only depend on
+     *  items of previous waves and are computed and resolved concurrently by
+     *  a pool of threads. Items in dependency cycles are left for the serial
+     *  execution, where the recursion check reports them.
+     *  In this mode callbacks may only access derived conditions, which are
+     *  declared as dependencies.
+     *
      *  \author  M.Frank
      *  \version 1.0
      */
@@ -65,6 +78,8 @@ namespace dd4hep {
         int                        callstack = 0;
         /// Current conversion state of the item
         State                      state     = INVALID;
+        /// Execution wave in parallel mode (-1: not scheduled)
+        int                        wave      = -1;
       public:
         /// Inhibit default constructor
         Work() = delete;
@@ -105,13 +120,21 @@ namespace dd4hep {
       Work*                       m_block = 0;
       /// Current item of the block
       Work*                       m_currentWork = 0;
+      /// Flag set while the work items are processed by several threads
+      bool                        m_parallel = false;
+      /// Lock to protect the user pool against inserts by callbacks in parallel mode
+      std::shared_timed_mutex     m_poolLock;
     public:
       /// Number of callbacks to the handler for monitoring
-      mutable size_t              num_callback;
+      mutable std::atomic<size_t> num_callback;
 
     protected:
       /// Internal call to trigger update callback
       void do_callback(Work* dep);
+      /// Access the item currently worked on by the calling thread
+      Work*& currentWork();
+      /// Compute and resolve the work items in topological waves using several threads
+      void compute_parallel(std::size_t num_threads);
 
     public:
       /// Initializing constructor
@@ -0,0 +1,121 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDCOND_CONDITIONSIOVINDEX_H
+#define DDCOND_CONDITIONSIOVINDEX_H
+
+// Framework include files
+#include "DD4hep/IOV.h"
+
+// C/C++ include files
+#include <map>
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for implementation details of the AIDA detector description toolkit
+  namespace cond {
+
+    /// Forward declarations
+    class ConditionsPool;
+
+    /// Index of the IOV ranges of the conditions pools of one IOV type
+    /**
+     *  Purely internal class to the ConditionsIOVPool.
+     *
+     *  The index selects all pools with an IOV range containing the requested range,
+     *  i.e. key.first <= required.first and key.second >= required.second.
+     *  The entries are kept in blocks with sizes of powers of 2 (logarithmic method).
+     *  Each block is sorted by the IOV key and carries a sparse table with the
+     *  position of the maximal upper IOV bound of every range of 2^n entries.
+     *  A block is searched by bisection for the lower bound, the matches are
+     *  collected by recursive range maximum queries on the upper bound:
+     *  selection is O(log^2(n) + k), insertion is O(log^2(n)) amortized.
+     *  Removals require a rebuild of the index.
+     *
+     *  The index also keeps the age of the pools: each aging selection
+     *  increments the index clock. The age of a pool is the number of aging
+     *  selections since it was last selected. It is only written to the
+     *  pool (ConditionsPool::age_value) when selected or on request.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_CONDITIONS
+     */
+    class ConditionsIOVIndex  {
+    public:
+      /// Shortcut name for the indexed pools
+      typedef std::shared_ptr<ConditionsPool> Element;
+      /// Shortcut name for the container of pools the index is built from
+      typedef std::map<IOV::Key, Element >    Elements;
+
+      /// Index entry of one conditions pool
+      class Entry  {
+      public:
+        /// IOV range of the pool
+        IOV::Key    key;
+        /// Reference to the pool
+        Element     pool;
+        /// Age of the pool at the time of the stamp
+        long        age   = 0;
+        /// Index clock at the time the age was recorded
+        std::size_t stamp = 0;
+      };
+
+    protected:
+      /// Sorted block of entries with range maximum table
+      class Block  {
+      public:
+        /// Entries sorted by IOV key
+        std::vector<Entry> entries;
+        /// Sparse table: position of the maximal upper IOV bound for ranges of 2^(n+1) entries
+        std::vector<std::vector<std::uint32_t> > table;
+        /// Build the range maximum table
+        void build();
+        /// Position of the entry with the maximal upper bound in [first, last)
+        std::size_t argmax(std::size_t first, std::size_t last)  const;
+        /// Collect all entries with lower bound <= key.first and upper bound >= key.second
+        void select(const IOV::Key& key, std::vector<Entry*>& result);
+      };
+      /// Blocks with strictly decreasing sizes
+      std::vector<Block> m_blocks;
+      /// Total number of entries
+      std::size_t        m_size  = 0;
+      /// Clock for the age of the pools. Incremented by every aging selection
+      std::size_t        m_clock = 0;
+
+    public:
+      /// Default constructor
+      ConditionsIOVIndex() = default;
+      /// Number of indexed pools
+      std::size_t size()  const    {  return m_size;  }
+      /// Remove all entries
+      void clear();
+      /// Rebuild the index from the container of pools. The ages are taken from the pools
+      void build(const Elements& elements);
+      /// Add a new pool to the index
+      void insert(const IOV::Key& key, const Element& pool);
+      /// Select all entries containing the requested range (unordered)
+      std::size_t select(const IOV::Key& required, std::vector<Entry*>& result);
+      /// Select all entries containing the requested range (unordered) and update the ages
+      std::size_t selectActive(const IOV::Key& required, std::vector<Entry*>& result);
+      /// Write the current age to all indexed pools
+      void updateAges();
+    };
+
+  } /* End namespace cond             */
+} /* End namespace dd4hep                   */
+
+#endif // DDCOND_CONDITIONSIOVINDEX_H
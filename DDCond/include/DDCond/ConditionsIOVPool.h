@@ -14,7 +14,9 @@
 #define DDCOND_CONDITIONSIOVPOOL_H
 
 // Framework include files
+#include "DD4hep/Mutex.h"
 #include "DDCond/ConditionsPool.h"
+#include "DDCond/ConditionsIOVIndex.h"
 
 // C/C++ include files
 #include <map>
@@ -31,6 +33,16 @@ namespace dd4hep {
      *  Purely internal class to the conditions manager implementation.
      *  Not at all to be accessed by clients!
      *
+     *  The selection and cleanup calls are protected by the pool lock.
+     *  Code accessing the elements must hold the lock, since several user
+     *  pools may select conditions concurrently.
+     *
+     *  Selections by IOV use an index of the IOV ranges (see ConditionsIOVIndex)
+     *  and do not scan all elements. The elements are only modified by insert(),
+     *  erase() and clean(), which keep the index up to date.
+     *  The ages of the pools are kept by the index. Call updateAges() before
+     *  inspecting ConditionsPool::age_value.
+     *
      *  \author  M.Frank
      *  \version 1.0
      *  \ingroup DD4HEP_CONDITIONS
@@ -42,16 +54,31 @@ namespace dd4hep {
       /// Shortcut name for the actual conditions container
       typedef std::map<IOV::Key, Element >    Elements;      
 
+    private:
       /// Container of IOV dependent conditions pools
-      Elements elements;     //! Not ROOT persistent
+      Elements m_elements;          //! Not ROOT persistent
+      /// Index of the IOV ranges of the elements for fast selection
+      ConditionsIOVIndex m_index;   //! Not ROOT persistent
+
+    public:
       /// Reference to the IOV container
       const IOVType* type;   //! Not ROOT persistent
+      /// Lock to protect the elements and the conditions pools they contain
+      mutable dd4hep_mutex_t lock;  //! Not ROOT persistent
+      /// Cleanup counter: incremented whenever conditions pools are removed
+      std::size_t generation = 0;   //! Not ROOT persistent
       
     public:
       /// Default constructor
       ConditionsIOVPool(const IOVType* type);
       /// Default destructor
       virtual ~ConditionsIOVPool();
+      /// Access to the conditions pools. The lock must be held while accessing them
+      const Elements& elements()  const   {  return m_elements;  }
+      /// Add a new conditions pool for the given IOV range. Returns false if the range exists
+      bool insert(const IOV::Key& key, const Element& pool);
+      /// Remove the conditions pool of the given IOV range. Returns false if the range does not exist
+      bool erase(const IOV::Key& key);
       /// Retrieve  a condition set given the key according to their validity
       size_t select(Condition::key_type key, const IOV& req_validity, RangeConditions& result);
       /// Retrieve  a condition set given the key according to their validity
@@ -70,6 +97,10 @@ namespace dd4hep {
       size_t select(const IOV& req_validity, std::vector<Element>& valid, IOV& cond_validity);
       /// Select all ACTIVE conditions pools, which do match the IOV requirement (faster)
       size_t select(const IOV& req_validity, std::vector<Element>& valid);
+      /// Select all ACTIVE conditions pools, which do match the IOV requirement and update the pool ages
+      size_t selectActive(const IOV& req_validity, std::vector<Element>& valid);
+      /// Write the current age to all conditions pools (ConditionsPool::age_value)
+      void updateAges();
 
       /// Remove all key based pools with an age beyon the minimum age. 
       /** @return Number of conditions cleaned up and removed.                       */
@@ -72,6 +72,8 @@ namespace dd4hep {
       bool                   m_doLoad = true;
       /// Property: Flag to indicate if unloaded items should be saved to the slice (or not)
       bool                   m_doOutputUnloaded = false;
+      /// Property: Number of threads to compute derived conditions (0: serial computation)
+      int                    m_computeThreads = 0;
 
       /// Register callback listener object
       void registerCallee(Listeners& listeners, const Listener& callee, bool add);
@@ -96,6 +98,9 @@ namespace dd4hep {
       /// Access to flag to indicate if unloaded items should be saved to the slice (or not)
       bool doOutputUnloaded()  const        {  return m_doOutputUnloaded;     }
 
+      /// Access to the number of threads used to compute derived conditions
+      int computeThreads()  const           {  return m_computeThreads;       }
+
       /// Listener invocation when a condition is registered to the cache
       void onRegister(Condition condition);
 
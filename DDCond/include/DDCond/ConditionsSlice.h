@@ -44,6 +44,14 @@ namespace dd4hep {
      *
      *  On return it contains the individual condition load information.
      *
+     *  If the flag INCREMENTAL is set, a prepare call for a new IOV keeps all
+     *  conditions of the previous call, which are still valid. Only the expired
+     *  conditions are selected or loaded again and only the derived conditions
+     *  depending on them are recomputed. Dependencies are tracked according to
+     *  the declared dependencies of the derived conditions. The result of an
+     *  incremental prepare call only counts the conditions selected, loaded or
+     *  computed by this call. The kept conditions are not counted.
+     *
      *  Referenced by: ConditonsUserPool, ConditionsManager
      *
      *  \author  M.Frank
@@ -61,7 +69,8 @@ namespace dd4hep {
         REGISTER_FULL   = REGISTER_MANAGER|REGISTER_POOL
       };
       enum LoadFlags  {
-        REF_POOLS       = 1<<1
+        REF_POOLS       = 1<<1,
+        INCREMENTAL     = 1<<2
       };
       
       /// Helper to simplify the registration of new condtitions from arbitrary containers.
@@ -136,10 +136,14 @@ namespace dd4hep {
       /// Access conditions multi IOV pool by iov type
       virtual ConditionsIOVPool* iovPool(const IOVType& type)  const  final;
 
-      /// Register new condition with the conditions store. Unlocked version, not multi-threaded
+      /// Register new condition with the conditions store. Only the IOV pool of the target pool is locked
+      /** Returns false if the pool already holds a condition with the same key. */
       virtual bool registerUnlocked(ConditionsPool& pool, Condition cond)  final;
 
       /// Register a whole block of conditions with identical IOV.
+      /** Returns the number of registered conditions. Conditions clashing with
+       *  existing pool entries are not registered.
+       */
       virtual size_t blockRegister(ConditionsPool& pool, const std::vector<Condition>& cond) const final;
 
       /// Adopt cleanup handler. If a handler is registered, it is invoked at every "prepare" step
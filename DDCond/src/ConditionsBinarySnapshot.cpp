@@ -0,0 +1,459 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DD4hep/Printout.h>
+#include <DD4hep/Alignments.h>
+#include <DD4hep/AlignmentData.h>
+#include <DD4hep/detail/ConditionsInterna.h>
+#include <DDCond/ConditionsIOVPool.h>
+#include <DDCond/ConditionsBinarySnapshot.h>
+
+// C/C++ include files
+#include <chrono>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+// POSIX include files
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace dd4hep;
+using namespace dd4hep::cond;
+
+// Local namespace for anonymous stuff
+namespace  {
+
+  typedef ConditionsBinarySnapshot Snapshot;
+
+  /// Alignment of all regions and payloads in the file
+  constexpr std::size_t s_alignment = 8;
+
+  /// Round up to the next aligned offset
+  inline std::uint64_t aligned(std::uint64_t offset)   {
+    return (offset + s_alignment - 1) & ~std::uint64_t(s_alignment - 1);
+  }
+  /// Check that the region [offset, offset+len) lies within [0, total)
+  inline bool in_range(std::uint64_t offset, std::uint64_t len, std::uint64_t total)   {
+    return offset <= total && len <= total - offset;
+  }
+  /// Sort criterium of the index entries
+  inline bool entry_less(const Snapshot::Entry& a, const Snapshot::Entry& b)   {
+    return std::tie(a.key, a.iovType, a.lower, a.upper) < std::tie(b.key, b.iovType, b.lower, b.upper);
+  }
+
+  /// Helper to measure the duration of snapshot operations
+  struct DurationStamp  {
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    float& duration;
+    DurationStamp(float& d) : duration(d)  {
+    }
+    ~DurationStamp()  {
+      std::chrono::duration<float> diff = std::chrono::steady_clock::now() - start;
+      duration = diff.count();
+    }
+  };
+
+  /// Access the name of a condition
+  inline std::string condition_name(Condition c)   {
+#if defined(DD4HEP_CONDITIONS_HAVE_NAME)
+    return c->name;
+#else
+    return std::string();
+#endif
+  }
+
+  /// Size of a single value in the payload region. 0 for unknown data types
+  std::size_t value_size(std::uint32_t data_type)   {
+    switch(data_type)  {
+    case Snapshot::TYPE_INT:
+    case Snapshot::TYPE_VECTOR_INT:     return sizeof(std::int32_t);
+    case Snapshot::TYPE_LONG:
+    case Snapshot::TYPE_VECTOR_LONG:    return sizeof(std::int64_t);
+    case Snapshot::TYPE_FLOAT:
+    case Snapshot::TYPE_VECTOR_FLOAT:   return sizeof(float);
+    case Snapshot::TYPE_DOUBLE:
+    case Snapshot::TYPE_VECTOR_DOUBLE:  return sizeof(double);
+    case Snapshot::TYPE_DELTA:          return sizeof(Snapshot::DeltaData);
+    case Snapshot::TYPE_STRING:         return 1;
+    default:                            return 0;
+    }
+  }
+
+  /// Bind a scalar value from the payload region
+  template <typename T, typename S=T> void decode_value(Condition c, const unsigned char* data)   {
+    S value;
+    std::memcpy(&value, data, sizeof(S));
+    c.bind<T>() = T(value);
+  }
+
+  /// Bind a vector from the payload region. The vector is filled directly from the mapped memory
+  template <typename T, typename S=T> void decode_vector(Condition c, const unsigned char* data, std::size_t len)   {
+    const S* first = reinterpret_cast<const S*>(data);
+    c.bind<std::vector<T> >().assign(first, first + len/sizeof(S));
+  }
+
+  /// Convert values to the storage type of the payload region
+  template <typename S, typename T> std::vector<S> convert(const T* first, std::size_t num)   {
+    return std::vector<S>(first, first + num);
+  }
+
+  /// Fill the payload layout of an alignment delta
+  Snapshot::DeltaData encode_delta(const Delta& delta)   {
+    Snapshot::DeltaData d;
+    std::memset(&d, 0, sizeof(d));
+    delta.translation.GetCoordinates(d.translation);
+    delta.pivot.Vect().GetCoordinates(d.pivot);
+    d.rotation[0] = delta.rotation.Phi();
+    d.rotation[1] = delta.rotation.Theta();
+    d.rotation[2] = delta.rotation.Psi();
+    d.flags       = delta.flags;
+    return d;
+  }
+}
+
+/// Initializing constructor: map the file to memory
+Snapshot::MappedFile::MappedFile(const std::string& file_name) : m_name(file_name)   {
+  struct stat buff;
+  int fd = ::open(file_name.c_str(), O_RDONLY);
+  if ( fd < 0 )
+    except("ConditionsBinarySnapshot","+++ Failed to open snapshot file %s: %s",
+           file_name.c_str(), std::strerror(errno));
+  if ( ::fstat(fd, &buff) != 0 || std::size_t(buff.st_size) < sizeof(Header) )  {
+    ::close(fd);
+    except("ConditionsBinarySnapshot","+++ The file %s is not a valid conditions snapshot.", file_name.c_str());
+  }
+  void* mem = ::mmap(nullptr, buff.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if ( mem == MAP_FAILED )
+    except("ConditionsBinarySnapshot","+++ Failed to map snapshot file %s: %s",
+           file_name.c_str(), std::strerror(errno));
+
+  m_mapping = mem;
+  m_size    = buff.st_size;
+  m_header  = static_cast<const Header*>(mem);
+  const Header& hdr = *m_header;
+  const char*   err = nullptr;
+  if ( std::memcmp(hdr.magic, Header().magic, sizeof(hdr.magic)) != 0 )
+    err = "is not a valid conditions snapshot";
+  else if ( hdr.version != Header().version )
+    err = "has an unsupported format version";
+  else if ( hdr.byteOrder != Header().byteOrder )
+    err = "was written with a different byte order";
+  else if ( hdr.headerSize != sizeof(Header) || hdr.entrySize != sizeof(Entry) )
+    err = "has an incompatible layout";
+  else if ( hdr.typesOffset%s_alignment != 0 || hdr.indexOffset%s_alignment != 0 || hdr.payloadOffset%s_alignment != 0 )
+    err = "has misaligned regions";
+  else if ( hdr.numTypes   > m_size/sizeof(TypeEntry) || !in_range(hdr.typesOffset, hdr.numTypes*sizeof(TypeEntry), m_size) ||
+            hdr.numEntries > m_size/sizeof(Entry)     || !in_range(hdr.indexOffset, hdr.numEntries*sizeof(Entry), m_size) ||
+            !in_range(hdr.stringsOffset, hdr.stringsSize, m_size) ||
+            !in_range(hdr.payloadOffset, hdr.payloadSize, m_size) )
+    err = "is truncated";
+  if ( err )  {
+    ::munmap(m_mapping, m_size);
+    except("ConditionsBinarySnapshot","+++ The file %s %s.", file_name.c_str(), err);
+  }
+  const unsigned char* base = static_cast<const unsigned char*>(mem);
+  m_types   = reinterpret_cast<const TypeEntry*>(base + hdr.typesOffset);
+  m_entries = reinterpret_cast<const Entry*>(base + hdr.indexOffset);
+  m_strings = reinterpret_cast<const char*>(base + hdr.stringsOffset);
+  m_payload = base + hdr.payloadOffset;
+  printout(DEBUG,"ConditionsBinarySnapshot","+++ Mapped snapshot %s: %ld conditions, %ld bytes.",
+           file_name.c_str(), long(hdr.numEntries), long(m_size));
+}
+
+/// Default destructor: unmap the file
+Snapshot::MappedFile::~MappedFile()   {
+  if ( m_mapping )  {
+    ::munmap(m_mapping, m_size);
+    m_mapping = nullptr;
+  }
+}
+
+/// Access a string from the names region
+std::string Snapshot::MappedFile::string(std::uint64_t offset, std::uint32_t length)  const   {
+  if ( !in_range(offset, length, m_header->stringsSize) )
+    except("ConditionsBinarySnapshot","+++ Corrupted snapshot %s: invalid name reference.", m_name.c_str());
+  return std::string(m_strings + offset, length);
+}
+
+/// Find all entries of a given conditions key
+std::pair<const Snapshot::Entry*, const Snapshot::Entry*>
+Snapshot::MappedFile::find(Condition::key_type key)  const   {
+  auto first = std::lower_bound(begin(), end(), key,
+                                [](const Entry& e, Condition::key_type k) { return e.key < k; });
+  auto last  = first;
+  while( last != end() && last->key == key ) ++last;
+  return { first, last };
+}
+
+/// Find the first entry of a given conditions key with an IOV containing the requested IOV
+const Snapshot::Entry* Snapshot::MappedFile::find(Condition::key_type key, const IOV& required)  const   {
+  auto range = find(key);
+  for( const Entry* e = range.first; e != range.second; ++e )   {
+    if ( e->iovType == required.type && IOV::key_contains_range(IOV::Key(e->lower, e->upper), required.keyData) )
+      return e;
+  }
+  return nullptr;
+}
+
+/// Create the condition of an index entry and decode its payload
+Condition Snapshot::MappedFile::decode(const Entry& entry)  const   {
+  std::size_t len = value_size(entry.dataType);
+  if ( 0 == len )
+    except("ConditionsBinarySnapshot","+++ Corrupted snapshot %s: condition %016llX has unknown data type %u.",
+           m_name.c_str(), (unsigned long long)entry.key, entry.dataType);
+  bool vector_type = entry.dataType >= TYPE_STRING && entry.dataType <= TYPE_VECTOR_DOUBLE;
+  if ( !in_range(entry.offset, entry.size, m_header->payloadSize) || entry.offset%s_alignment != 0 ||
+       (vector_type ? entry.size%len != 0 : entry.size != len) )
+    except("ConditionsBinarySnapshot","+++ Corrupted snapshot %s: condition %016llX has an invalid payload.",
+           m_name.c_str(), (unsigned long long)entry.key);
+
+  std::string          nam  = string(entry.nameOffset, entry.nameLength);
+  std::string          typ  = nam.substr(nam.find('#')+1);
+  const unsigned char* data = m_payload + entry.offset;
+  Condition            cond(nam, typ);
+  cond->hash  = entry.key;
+  cond->flags = entry.flags;
+  switch(entry.dataType)  {
+  case TYPE_INT:            decode_value<int,std::int32_t>(cond, data);               break;
+  case TYPE_LONG:           decode_value<long,std::int64_t>(cond, data);              break;
+  case TYPE_FLOAT:          decode_value<float>(cond, data);                          break;
+  case TYPE_DOUBLE:         decode_value<double>(cond, data);                         break;
+  case TYPE_STRING:         cond.bind<std::string>().assign((const char*)data, entry.size); break;
+  case TYPE_VECTOR_INT:     decode_vector<int,std::int32_t>(cond, data, entry.size);  break;
+  case TYPE_VECTOR_LONG:    decode_vector<long,std::int64_t>(cond, data, entry.size); break;
+  case TYPE_VECTOR_FLOAT:   decode_vector<float>(cond, data, entry.size);             break;
+  case TYPE_VECTOR_DOUBLE:  decode_vector<double>(cond, data, entry.size);            break;
+  case TYPE_DELTA:   {
+    DeltaData d;
+    std::memcpy(&d, data, sizeof(d));
+    Delta& delta      = cond.bind<Delta>();
+    delta.translation = Position(d.translation[0], d.translation[1], d.translation[2]);
+    delta.pivot       = Delta::Pivot(d.pivot[0], d.pivot[1], d.pivot[2]);
+    delta.rotation    = RotationZYX(d.rotation[0], d.rotation[1], d.rotation[2]);
+    delta.flags       = d.flags;
+    break;
+  }
+  default:
+    break;
+  }
+  return cond;
+}
+
+/// Clear object content and release allocated memory
+void Snapshot::clear()   {
+  m_types.clear();
+  m_entries.clear();
+  m_keys.clear();
+  m_strings.clear();
+  m_payload.clear();
+  m_numSkipped = 0;
+  m_types.shrink_to_fit();
+  m_entries.shrink_to_fit();
+  m_strings.shrink_to_fit();
+  m_payload.shrink_to_fit();
+}
+
+/// Add a string to the names region
+std::uint64_t Snapshot::addString(const std::string& value)   {
+  std::uint64_t offset = m_strings.size();
+  m_strings += value;
+  return offset;
+}
+
+/// Add a data block to the payload region
+std::uint64_t Snapshot::addPayload(const void* data, std::size_t len)   {
+  std::uint64_t offset = aligned(m_payload.size());
+  m_payload.resize(offset + len, 0);
+  if ( len > 0 ) std::memcpy(&m_payload[offset], data, len);
+  return offset;
+}
+
+/// Add a single condition
+bool Snapshot::add(const IOV& iov, Condition cond)   {
+  if ( !cond.isValid() || !cond.is_bound() || !iov.iovType )  {
+    ++m_numSkipped;
+    return false;
+  }
+  const std::type_info& typ = cond.typeInfo();
+  const void*   data = cond.data().ptr();
+  std::size_t   len  = 0;
+  std::string   nam  = condition_name(cond);
+  Entry         entry;
+  /// Temporary buffers for payloads with a different storage layout
+  std::vector<std::int64_t> longs;
+  DeltaData                 delta;
+
+  std::memset(&entry, 0, sizeof(entry));
+  entry.key     = cond.key();
+  entry.lower   = iov.keyData.first;
+  entry.upper   = iov.keyData.second;
+  entry.iovType = iov.type;
+  entry.flags   = cond->flags;
+  if ( typ == typeid(int) )  {
+    static_assert(sizeof(int) == sizeof(std::int32_t), "Unsupported size of type int");
+    entry.dataType = TYPE_INT;
+    len = sizeof(int);
+  }
+  else if ( typ == typeid(long) )  {
+    longs.emplace_back(cond.get<long>());
+    entry.dataType = TYPE_LONG;
+    data = longs.data();
+    len  = sizeof(std::int64_t);
+  }
+  else if ( typ == typeid(float) )  {
+    entry.dataType = TYPE_FLOAT;
+    len = sizeof(float);
+  }
+  else if ( typ == typeid(double) )  {
+    entry.dataType = TYPE_DOUBLE;
+    len = sizeof(double);
+  }
+  else if ( typ == typeid(std::string) )  {
+    const std::string& s = cond.get<std::string>();
+    entry.dataType = TYPE_STRING;
+    data = s.data();
+    len  = s.length();
+  }
+  else if ( typ == typeid(std::vector<int>) )  {
+    const auto& v = cond.get<std::vector<int> >();
+    entry.dataType = TYPE_VECTOR_INT;
+    data = v.data();
+    len  = v.size()*sizeof(int);
+  }
+  else if ( typ == typeid(std::vector<long>) )  {
+    const auto& v = cond.get<std::vector<long> >();
+    longs = convert<std::int64_t>(v.data(), v.size());
+    entry.dataType = TYPE_VECTOR_LONG;
+    data = longs.data();
+    len  = longs.size()*sizeof(std::int64_t);
+  }
+  else if ( typ == typeid(std::vector<float>) )  {
+    const auto& v = cond.get<std::vector<float> >();
+    entry.dataType = TYPE_VECTOR_FLOAT;
+    data = v.data();
+    len  = v.size()*sizeof(float);
+  }
+  else if ( typ == typeid(std::vector<double>) )  {
+    const auto& v = cond.get<std::vector<double> >();
+    entry.dataType = TYPE_VECTOR_DOUBLE;
+    data = v.data();
+    len  = v.size()*sizeof(double);
+  }
+  else if ( typ == typeid(Delta) )  {
+    delta = encode_delta(cond.get<Delta>());
+    entry.dataType = TYPE_DELTA;
+    data = &delta;
+    len  = sizeof(delta);
+  }
+  else if ( typ == typeid(AlignmentData) )  {
+    /// Alignment data are derived: save the alignment delta and recompute them after loading
+    typedef ConditionKey::KeyMaker KM;
+    delta = encode_delta(cond.get<AlignmentData>().delta);
+    entry.key      = KM(cond.detector_key(), align::Keys::deltaKey).hash;
+    entry.flags    = Condition::ALIGNMENT_DELTA;
+    entry.dataType = TYPE_DELTA;
+    nam  = nam.substr(0, nam.find('#')) + "#" + align::Keys::deltaName;
+    data = &delta;
+    len  = sizeof(delta);
+  }
+  else   {
+    printout(DEBUG,"ConditionsBinarySnapshot","+++ Skip condition %016llX of unsupported type %s.",
+             (unsigned long long)cond.key(), cond.data().dataType().c_str());
+    ++m_numSkipped;
+    return false;
+  }
+  if ( !m_keys.emplace(entry.key, entry.iovType, entry.lower, entry.upper).second )  {
+    return false;
+  }
+  auto t = std::find_if(m_types.begin(), m_types.end(),
+                        [&iov](const TypeEntry& e) { return e.type == iov.type; });
+  if ( t == m_types.end() )  {
+    TypeEntry type_entry;
+    type_entry.type       = iov.type;
+    type_entry.nameLength = std::uint32_t(iov.iovType->name.length());
+    type_entry.nameOffset = addString(iov.iovType->name);
+    m_types.emplace_back(type_entry);
+  }
+  entry.size       = len;
+  entry.offset     = addPayload(data, len);
+  entry.nameLength = std::uint32_t(nam.length());
+  entry.nameOffset = addString(nam);
+  m_entries.emplace_back(entry);
+  return true;
+}
+
+/// Add conditions content to be saved
+std::size_t Snapshot::add(const IOV& iov, const std::vector<Condition>& conditions)   {
+  std::size_t count = 0;
+  DurationStamp stamp(duration);
+  for( const auto& c : conditions )
+    count += add(iov, c) ? 1 : 0;
+  return count;
+}
+
+/// Add conditions content to be saved
+std::size_t Snapshot::add(ConditionsPool& pool)   {
+  RangeConditions conditions;
+  pool.select_all(conditions);
+  return add(*pool.iov, conditions);
+}
+
+/// Add conditions content to be saved
+std::size_t Snapshot::add(const ConditionsIOVPool& pool)   {
+  std::size_t count = 0;
+  dd4hep_lock_t lock(pool.lock);
+  for( const auto& p : pool.elements() )
+    count += add(*p.second);
+  return count;
+}
+
+/// Save the snapshot to a file. Returns the number of bytes written
+long Snapshot::save(const std::string& file_name)   {
+  DurationStamp stamp(duration);
+  Header hdr;
+  std::sort(m_entries.begin(), m_entries.end(), entry_less);
+  hdr.entrySize     = sizeof(Entry);
+  hdr.numTypes      = m_types.size();
+  hdr.numEntries    = m_entries.size();
+  hdr.typesOffset   = aligned(sizeof(Header));
+  hdr.indexOffset   = aligned(hdr.typesOffset + hdr.numTypes*sizeof(TypeEntry));
+  hdr.stringsOffset = hdr.indexOffset + hdr.numEntries*sizeof(Entry);
+  hdr.stringsSize   = m_strings.size();
+  hdr.payloadOffset = aligned(hdr.stringsOffset + hdr.stringsSize);
+  hdr.payloadSize   = m_payload.size();
+
+  static const char padding[s_alignment] = { 0 };
+  std::ofstream out(file_name, std::ios::binary|std::ios::trunc);
+  auto pad = [&out](std::uint64_t offset)  {
+    out.write(padding, std::streamsize(offset - std::uint64_t(out.tellp())));
+  };
+  out.write(reinterpret_cast<const char*>(&hdr), sizeof(Header));
+  pad(hdr.typesOffset);
+  out.write(reinterpret_cast<const char*>(m_types.data()), hdr.numTypes*sizeof(TypeEntry));
+  pad(hdr.indexOffset);
+  out.write(reinterpret_cast<const char*>(m_entries.data()), hdr.numEntries*sizeof(Entry));
+  out.write(m_strings.data(), hdr.stringsSize);
+  pad(hdr.payloadOffset);
+  out.write(reinterpret_cast<const char*>(m_payload.data()), hdr.payloadSize);
+  if ( !out.good() )
+    except("ConditionsBinarySnapshot","+++ Failed to write snapshot file %s.", file_name.c_str());
+  printout(DEBUG,"ConditionsBinarySnapshot","+++ Saved %ld conditions to %s. Skipped %ld conditions.",
+           long(m_entries.size()), file_name.c_str(), long(m_numSkipped));
+  return long(hdr.payloadOffset + hdr.payloadSize);
+}
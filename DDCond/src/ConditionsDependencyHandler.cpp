@@ -18,9 +18,100 @@
 #include <DD4hep/Printout.h>
 #include <TTimeStamp.h>
 
+// C/C++ include files
+#include <condition_variable>
+#include <mutex>
+#include <exception>
+#include <functional>
+#include <thread>
+
 using namespace dd4hep::cond;
 
 namespace {
+
+  /// Work item currently processed by this thread (parallel mode only)
+  thread_local ConditionsDependencyHandler::Work* t_currentWork = nullptr;
+
+  /// Minimal thread pool executing the items of one wave
+  /**
+   *  The calling thread participates in the execution. run() returns
+   *  once all items are processed. The first exception is re-thrown.
+   */
+  class WaveExecutor  {
+    std::vector<std::thread>                 m_threads;
+    std::mutex                               m_lock;
+    std::condition_variable                  m_start;
+    std::condition_variable                  m_done;
+    const std::function<void(std::size_t)>*  m_call   = nullptr;
+    std::atomic<std::size_t>                 m_next   { 0 };
+    std::size_t                              m_count  = 0;
+    std::size_t                              m_active = 0;
+    std::size_t                              m_generation = 0;
+    std::exception_ptr                       m_error;
+    bool                                     m_stop   = false;
+
+    /// Process items until the current wave is exhausted
+    void work()   {
+      for( std::size_t i = m_next++; i < m_count; i = m_next++ )   {
+        try   {
+          (*m_call)(i);
+        }
+        catch(...)   {
+          std::lock_guard<std::mutex> lock(m_lock);
+          if ( !m_error ) m_error = std::current_exception();
+        }
+      }
+    }
+    /// Thread function of the workers
+    void loop()   {
+      std::size_t generation = 0;
+      while( true )   {  {
+          std::unique_lock<std::mutex> lock(m_lock);
+          m_start.wait(lock, [this, generation] { return m_stop || m_generation != generation; });
+          if ( m_stop ) return;
+          generation = m_generation;
+        }
+        work();
+        std::lock_guard<std::mutex> lock(m_lock);
+        if ( --m_active == 0 ) m_done.notify_all();
+      }
+    }
+  public:
+    /// Initializing constructor. The calling thread is an additional worker
+    WaveExecutor(std::size_t num_workers)   {
+      for( std::size_t i = 0; i < num_workers; ++i )
+        m_threads.emplace_back([this] { loop(); });
+    }
+    /// Default destructor
+    ~WaveExecutor()   {   {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_stop = true;
+      }
+      m_start.notify_all();
+      for( auto& t : m_threads ) t.join();
+    }
+    /// Execute call(i) for i in [0,count[ and wait for completion
+    void run(std::size_t count, const std::function<void(std::size_t)>& call)   {
+      if ( count < 2 || m_threads.empty() )   {
+        for( std::size_t i = 0; i < count; ++i ) call(i);
+        return;
+      }  {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_call   = &call;
+        m_count  = count;
+        m_next   = 0;
+        m_active = m_threads.size();
+        m_error  = nullptr;
+        ++m_generation;
+      }
+      m_start.notify_all();
+      work();
+      std::unique_lock<std::mutex> lock(m_lock);
+      m_done.wait(lock, [this] { return m_active == 0; });
+      if ( m_error ) std::rethrow_exception(m_error);
+    }
+  };
+
   std::string dependency_name(const ConditionDependency* d)  {
 #if defined(DD4HEP_CONDITIONS_HAVE_NAME)
     return d->target.name;
@@ -90,8 +181,97 @@ dd4hep::Detector& ConditionsDependencyHandler::detectorDescription() const  {
   return m_manager->detectorDescription();
 }
 
+/// Access the item currently worked on by the calling thread
+ConditionsDependencyHandler::Work*& ConditionsDependencyHandler::currentWork()   {
+  return m_parallel ? t_currentWork : m_currentWork;
+}
+
+/// Compute and resolve the work items in topological waves using several threads
+void ConditionsDependencyHandler::compute_parallel(std::size_t num_threads)   {
+  const std::size_t num_work = m_todo.size();
+  std::vector<std::vector<Work*> > users(num_work);
+  std::vector<std::size_t>         pending(num_work, 0);
+  std::vector<Work*>               wave, next;
+  std::size_t                      num_done = 0;
+  int                              num_waves = 0;
+
+  // Build the dependency graph from the declared dependencies.
+  // Inputs not handled here are already present in the user pool.
+  for( const auto& i : m_todo )   {
+    Work* w = i.second;
+    for( const auto& key : w->context.dependency->dependencies )   {
+      auto j = m_todo.find(key.hash);
+      if ( j != m_todo.end() )   {
+        users[j->second - m_block].emplace_back(w);
+        ++pending[w - m_block];
+      }
+    }
+  }
+  for( const auto& i : m_todo )   {
+    if ( 0 == pending[i.second - m_block] ) wave.emplace_back(i.second);
+  }
+  auto do_compute = [this, &wave](std::size_t k)  {
+    Work* w = wave[k];
+    t_currentWork = nullptr;
+    if ( !w->condition )  {
+      do_callback(w);
+      if ( !w->condition )  {
+        except("DependencyHandler",
+               "Derived condition was not created after calling the creation callback!");
+      }
+    }
+  };
+  auto do_resolve = [&wave](std::size_t k)  {
+    Work* w = wave[k];
+    if ( w->state != RESOLVED )   {
+      t_currentWork = w;
+      w->resolve(t_currentWork);
+    }
+    t_currentWork = nullptr;
+  };
+
+  WaveExecutor executor(num_threads-1);
+  m_parallel = true;
+  try  {
+    // All items of one wave only depend on items of previous waves
+    while( !wave.empty() )   {
+      for( Work* w : wave ) w->wave = num_waves;
+      m_state = CREATED;
+      executor.run(wave.size(), do_compute);
+      m_state = RESOLVED;
+      executor.run(wave.size(), do_resolve);
+      next.clear();
+      for( Work* w : wave )   {
+        for( Work* u : users[w - m_block] )
+          if ( 0 == --pending[u - m_block] ) next.emplace_back(u);
+      }
+      num_done += wave.size();
+      wave.swap(next);
+      ++num_waves;
+    }
+  }
+  catch(...)   {
+    m_parallel = false;
+    m_state = CREATED;
+    throw;
+  }
+  m_parallel = false;
+  m_state = CREATED;
+  printout(DEBUG,"DependencyHandler","Computed %ld of %ld derived conditions in %d waves with %ld threads.",
+           num_done, num_work, num_waves, num_threads);
+  if ( num_done < num_work )   {
+    printout(WARNING,"DependencyHandler","%ld derived conditions are part of dependency cycles.",
+             num_work - num_done);
+  }
+}
+
 /// 1rst pass: Compute/create the missing conditions
 void ConditionsDependencyHandler::compute()   {
+  int num_threads = m_manager->computeThreads();
+  if ( num_threads > 0 && m_todo.size() > 1 )   {
+    compute_parallel(num_threads);
+  }
+  // Serial computation. In parallel mode only items in dependency cycles are left
   m_state = CREATED;
   for( const auto& i : m_todo )   {
     if ( !i.second->condition )  {
@@ -158,12 +338,16 @@ void ConditionsDependencyHandler::resolve()    {
 
 /// Interface to handle multi-condition inserts by callbacks: One single insert
 bool ConditionsDependencyHandler::registerOne(const IOV& iov, Condition cond)    {
+  std::unique_lock<std::shared_timed_mutex> lock(m_poolLock, std::defer_lock);
+  if ( m_parallel ) lock.lock();
   return m_pool.registerOne(iov, cond);
 }
 
 /// Handle multi-condition inserts by callbacks: block insertions of conditions with identical IOV
 std::size_t
 ConditionsDependencyHandler::registerMany(const IOV& iov, const std::vector<Condition>& values)   {
+  std::unique_lock<std::shared_timed_mutex> lock(m_poolLock, std::defer_lock);
+  if ( m_parallel ) lock.lock();
   return m_pool.registerMany(iov, values);
 }
 
@@ -187,9 +371,12 @@ ConditionsDependencyHandler::getByItem(Condition::itemkey_type key)   {
         return 1;
       }
     };
-    item_selector proc(key);
-    m_pool.scan(conditionsProcessor(proc));
-    for (auto c : proc.conditions ) m_currentWork->do_intersection(c->iov);
+    item_selector proc(key);  {
+      std::shared_lock<std::shared_timed_mutex> lock(m_poolLock, std::defer_lock);
+      if ( m_parallel ) lock.lock();
+      m_pool.scan(conditionsProcessor(proc));
+    }
+    for (auto c : proc.conditions ) currentWork()->do_intersection(c->iov);
     return proc.conditions;
   }
   except("DependencyHandler",
@@ -203,8 +390,12 @@ ConditionsDependencyHandler::get(Condition::detkey_type det_key)   {
   if ( m_state == RESOLVED )   {
     ConditionKey::KeyMaker lower(det_key, Condition::FIRST_ITEM_KEY);
     ConditionKey::KeyMaker upper(det_key, Condition::LAST_ITEM_KEY);
-    std::vector<Condition> conditions = m_pool.get(lower.hash, upper.hash);
-    for (auto c : conditions ) m_currentWork->do_intersection(c->iov);
+    std::vector<Condition> conditions;  {
+      std::shared_lock<std::shared_timed_mutex> lock(m_poolLock, std::defer_lock);
+      if ( m_parallel ) lock.lock();
+      conditions = m_pool.get(lower.hash, upper.hash);
+    }
+    for (auto c : conditions ) currentWork()->do_intersection(c->iov);
     return conditions;
   }
   except("DependencyHandler",
@@ -225,15 +416,31 @@ ConditionsDependencyHandler::get(Condition::key_type key,
                                  bool throw_if_not)
 {
   /// If we are not already resolving here, we follow the normal procedure
-  Condition c = m_pool.get(key);
+  Condition c;  {
+    std::shared_lock<std::shared_timed_mutex> lock(m_poolLock, std::defer_lock);
+    if ( m_parallel ) lock.lock();
+    c = m_pool.get(key);
+  }
   if ( c.isValid() )  {
-    m_currentWork->do_intersection(c->iov);
+    currentWork()->do_intersection(c->iov);
     return c;
   }
   auto i = m_todo.find(key);
   if ( i != m_todo.end() )   {
     Work* w = i->second;
-    if ( w->state == RESOLVED )   {
+    if ( m_parallel )   {
+      // Only items of previous waves are complete. Anything else is not thread safe
+      Work* current = currentWork();
+      if ( !current || w->wave < 0 || w->wave >= current->wave )   {
+        except("DependencyHandler",
+               "++ Condition %016lX is accessed by %s, but it is no declared dependency. "
+               "This is not supported by the parallel computation.", key,
+               current ? dependency_name(current->context.dependency).c_str() : "???");
+      }
+      current->do_intersection(w->iov);
+      return w->condition;
+    }
+    else if ( w->state == RESOLVED )   {
       return w->condition;
     }
     else if ( w->state == CREATED )   {
@@ -291,8 +498,9 @@ ConditionsDependencyHandler::get(Condition::key_type key,
 void ConditionsDependencyHandler::do_callback(Work* work)   {
   const ConditionDependency* dep = work->context.dependency;
   try  {
-    Work* previous  = m_currentWork;
-    m_currentWork   = work;
+    Work*& current  = currentWork();
+    Work* previous  = current;
+    current         = work;
     if ( work->callstack > 0 )   {
       // if we end up here it means a previous construction call never finished
       // because the bugger tried to access another condition, which in turn
@@ -311,7 +519,7 @@ void ConditionsDependencyHandler::do_callback(Work* work)   {
     ++work->callstack;
     work->condition = (*dep->callback)(dep->target, work->context).ptr();
     --work->callstack;
-    m_currentWork   = previous;
+    current         = previous;
     if ( work->condition )  {
       if ( !work->iov )  {
         work->_iov = IOV(m_iovType,IOV::Key(IOV::MIN_KEY, IOV::MAX_KEY));
@@ -0,0 +1,156 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DDCond/ConditionsIOVIndex.h>
+#include <DDCond/ConditionsPool.h>
+
+// C/C++ include files
+#include <algorithm>
+#include <climits>
+#include <iterator>
+
+using namespace dd4hep::cond;
+
+namespace {
+  /// Sort criterium of the index entries
+  inline bool entry_less(const ConditionsIOVIndex::Entry& a, const ConditionsIOVIndex::Entry& b)
+  {  return a.key < b.key;  }
+}
+
+/// Build the range maximum table
+void ConditionsIOVIndex::Block::build()   {
+  const std::size_t len = entries.size();
+  table.clear();
+  for( std::size_t width = 2; width <= len; width *= 2 )   {
+    std::vector<std::uint32_t> level(len - width + 1);
+    const std::size_t half = width / 2;
+    for( std::size_t i = 0; i < level.size(); ++i )   {
+      std::size_t a = half > 1 ? table.back()[i]        : i;
+      std::size_t b = half > 1 ? table.back()[i + half] : i + 1;
+      level[i] = std::uint32_t(entries[a].key.second >= entries[b].key.second ? a : b);
+    }
+    table.emplace_back(std::move(level));
+  }
+}
+
+/// Position of the entry with the maximal upper bound in [first, last)
+std::size_t ConditionsIOVIndex::Block::argmax(std::size_t first, std::size_t last)  const  {
+  std::size_t len = last - first, lvl = 0;
+  if ( len == 1 ) return first;
+  while( (std::size_t(2) << (lvl+1)) <= len ) ++lvl;
+  std::size_t a = table[lvl][first];
+  std::size_t b = table[lvl][last - (std::size_t(2) << lvl)];
+  return entries[a].key.second >= entries[b].key.second ? a : b;
+}
+
+/// Collect all entries with lower bound <= key.first and upper bound >= key.second
+void ConditionsIOVIndex::Block::select(const IOV::Key& key, std::vector<Entry*>& result)   {
+  auto end = std::partition_point(entries.begin(), entries.end(),
+                                  [&key](const Entry& e) { return e.key.first <= key.first; });
+  std::vector<std::pair<std::size_t,std::size_t> > ranges;
+  ranges.emplace_back(0, end - entries.begin());
+  while( !ranges.empty() )   {
+    auto r = ranges.back();
+    ranges.pop_back();
+    if ( r.first >= r.second ) continue;
+    std::size_t m = argmax(r.first, r.second);
+    if ( entries[m].key.second < key.second ) continue;
+    result.emplace_back(&entries[m]);
+    ranges.emplace_back(r.first, m);
+    ranges.emplace_back(m + 1, r.second);
+  }
+}
+
+/// Remove all entries
+void ConditionsIOVIndex::clear()   {
+  m_blocks.clear();
+  m_size = 0;
+}
+
+/// Rebuild the index from the container of pools. The ages are taken from the pools
+void ConditionsIOVIndex::build(const Elements& elements)   {
+  Block block;
+  block.entries.reserve(elements.size());
+  for( const auto& e : elements )   {
+    Entry entry;
+    entry.key   = e.first;
+    entry.pool  = e.second;
+    entry.age   = e.second->age_value;
+    entry.stamp = m_clock;
+    block.entries.emplace_back(std::move(entry));
+  }
+  block.build();
+  m_blocks.clear();
+  m_size = elements.size();
+  if ( m_size > 0 ) m_blocks.emplace_back(std::move(block));
+}
+
+/// Add a new pool to the index
+void ConditionsIOVIndex::insert(const IOV::Key& key, const Element& pool)   {
+  Block block;
+  Entry entry;
+  entry.key   = key;
+  entry.pool  = pool;
+  entry.age   = pool->age_value;
+  entry.stamp = m_clock;
+  block.entries.emplace_back(std::move(entry));
+  /// Merge blocks of equal size like a binary counter
+  while( !m_blocks.empty() && m_blocks.back().entries.size() <= block.entries.size() )   {
+    Block merged;
+    auto& last = m_blocks.back().entries;
+    merged.entries.reserve(last.size() + block.entries.size());
+    std::merge(std::make_move_iterator(last.begin()), std::make_move_iterator(last.end()),
+               std::make_move_iterator(block.entries.begin()), std::make_move_iterator(block.entries.end()),
+               std::back_inserter(merged.entries), entry_less);
+    m_blocks.pop_back();
+    block = std::move(merged);
+  }
+  block.build();
+  m_blocks.emplace_back(std::move(block));
+  ++m_size;
+}
+
+/// Select all entries containing the requested range (unordered)
+std::size_t ConditionsIOVIndex::select(const IOV::Key& required, std::vector<Entry*>& result)   {
+  std::size_t len = result.size();
+  for( auto& b : m_blocks )
+    b.select(required, result);
+  return result.size() - len;
+}
+
+/// Select all entries containing the requested range (unordered) and update the ages
+std::size_t ConditionsIOVIndex::selectActive(const IOV::Key& required, std::vector<Entry*>& result)   {
+  std::size_t len = result.size();
+  ++m_clock;
+  for( auto& b : m_blocks )
+    b.select(required, result);
+  for( std::size_t i = len; i < result.size(); ++i )   {
+    Entry* e = result[i];
+    e->age   = 0;
+    e->stamp = m_clock;
+    e->pool->age_value = 0;
+  }
+  return result.size() - len;
+}
+
+/// Write the current age to all indexed pools
+void ConditionsIOVIndex::updateAges()   {
+  for( auto& b : m_blocks )   {
+    for( auto& e : b.entries )   {
+      e.age  += long(m_clock - e.stamp);
+      e.stamp = m_clock;
+      e.pool->age_value = int(std::min(e.age, long(INT_MAX)));
+    }
+  }
+}
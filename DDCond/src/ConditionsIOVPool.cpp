@@ -20,8 +20,22 @@
 
 #include <DD4hep/detail/ConditionsInterna.h>
 
+// C/C++ include files
+#include <algorithm>
+
 using namespace dd4hep::cond;
 
+namespace {
+  typedef std::vector<ConditionsIOVIndex::Entry*> IndexEntries;
+
+  /// Order the selected entries like the elements of the pool
+  void sort_entries(IndexEntries& entries)   {
+    std::sort(entries.begin(), entries.end(),
+              [](const ConditionsIOVIndex::Entry* a, const ConditionsIOVIndex::Entry* b)
+              { return a->key < b->key; });
+  }
+}
+
 /// Default constructor
 ConditionsIOVPool::ConditionsIOVPool(const IOVType* typ) : type(typ)  {
   InstanceCount::increment(this);
@@ -38,16 +52,40 @@ ConditionsIOVPool::~ConditionsIOVPool()  {
   InstanceCount::decrement(this);
 }
 
+/// Add a new conditions pool for the given IOV range. Returns false if the range exists
+bool ConditionsIOVPool::insert(const IOV::Key& key, const Element& pool)   {
+  dd4hep_lock_t guard(lock);
+  if ( m_elements.emplace(key, pool).second )  {
+    m_index.insert(key, pool);
+    return true;
+  }
+  return false;
+}
+
+/// Remove the conditions pool of the given IOV range. Returns false if the range does not exist
+bool ConditionsIOVPool::erase(const IOV::Key& key)   {
+  dd4hep_lock_t guard(lock);
+  auto i = m_elements.find(key);
+  if ( i != m_elements.end() )  {
+    m_index.updateAges();
+    m_elements.erase(i);
+    m_index.build(m_elements);
+    ++generation;
+    return true;
+  }
+  return false;
+}
+
 size_t ConditionsIOVPool::select(Condition::key_type key, const IOV& req_validity, RangeConditions& result)
 {
-  if ( !elements.empty() )  {
+  dd4hep_lock_t guard(lock);
+  if ( !m_elements.empty() )  {
     size_t len = result.size();
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& e : elements )  {
-      if ( IOV::key_contains_range(e.first, req_key) )  {
-        e.second->select(key, result);
-      }
-    }
+    IndexEntries entries;
+    m_index.select(req_validity.key(), entries);
+    sort_entries(entries);
+    for( const auto* e : entries )
+      e->pool->select(key, result);
     return result.size() - len;
   }
   return 0;
@@ -55,9 +93,10 @@ size_t ConditionsIOVPool::select(Condition::key_type key, const IOV& req_validit
 
 size_t ConditionsIOVPool::selectRange(Condition::key_type key, const IOV& req_validity, RangeConditions& result)
 {
+  dd4hep_lock_t guard(lock);
   size_t len = result.size();
   const IOV::Key range = req_validity.key();
-  for( const auto& e : elements )  {
+  for( const auto& e : m_elements )  {
     const IOV::Key& k = e.first;
     if ( IOV::key_is_contained(k,range) )
       // IOV test contained in key. Take it!
@@ -74,9 +113,11 @@ size_t ConditionsIOVPool::selectRange(Condition::key_type key, const IOV& req_va
 
 /// Invoke cache cleanup with user defined policy
 int ConditionsIOVPool::clean(const ConditionsCleanup& cleaner)   {
- Elements rest;
+  dd4hep_lock_t guard(lock);
+  Elements rest;
   int count = 0;
-  for( const auto& e : elements )  {
+  m_index.updateAges();
+  for( const auto& e : m_elements )  {
     const ConditionsPool* p = e.second.get();
     if ( cleaner (*p) )   {
       count += e.second->size();
@@ -85,15 +126,27 @@ int ConditionsIOVPool::clean(const ConditionsCleanup& cleaner)   {
     }
     rest.insert(e);
   }
-  elements = std::move(rest);
+  if ( rest.size() != m_elements.size() )  {
+    ++generation;
+    m_index.build(rest);
+  }
+  m_elements = std::move(rest);
   return count;  
 }
 
+/// Write the current age to all conditions pools (ConditionsPool::age_value)
+void ConditionsIOVPool::updateAges()   {
+  dd4hep_lock_t guard(lock);
+  m_index.updateAges();
+}
+
 /// Remove all key based pools with an age beyon the minimum age
 int ConditionsIOVPool::clean(int max_age)   {
+  dd4hep_lock_t guard(lock);
   Elements rest;
   int count = 0;
-  for( const auto& e : elements )  {
+  m_index.updateAges();
+  for( const auto& e : m_elements )  {
     if ( e.second->age_value >= max_age )   {
       count += e.second->size();
       e.second->print("Remove");
@@ -102,7 +155,11 @@ int ConditionsIOVPool::clean(int max_age)   {
       rest.insert(e);
     }
   }
-  elements = std::move(rest);
+  if ( rest.size() != m_elements.size() )  {
+    ++generation;
+    m_index.build(rest);
+  }
+  m_elements = std::move(rest);
   return count;
 }
 
@@ -111,17 +168,15 @@ size_t ConditionsIOVPool::select(const IOV&        req_validity,
                                  RangeConditions&  valid,
                                  IOV&              cond_validity)
 {
+  dd4hep_lock_t guard(lock);
   size_t num_selected = 0;
-  if ( !elements.empty() )  {
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& i : elements )  {
-      if ( !IOV::key_contains_range(i.first, req_key) )  {
-        ++i.second->age_value;
-        continue;
-      }
-      cond_validity.iov_intersection(i.first);
-      num_selected += i.second->select_all(valid);
-      i.second->age_value = 0;
+  if ( !m_elements.empty() )  {
+    IndexEntries entries;
+    m_index.selectActive(req_validity.key(), entries);
+    sort_entries(entries);
+    for( const auto* e : entries )  {
+      cond_validity.iov_intersection(e->key);
+      num_selected += e->pool->select_all(valid);
     }
   }
   return num_selected;
@@ -132,18 +187,15 @@ size_t ConditionsIOVPool::select(const IOV&              req_validity,
                                  const ConditionsSelect& predicate_processor,
                                  IOV&                    cond_validity)
 {
-  size_t num_selected = 0, pool_selected = 0;
-  if ( !elements.empty() )  {
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& i : elements )  {
-      if ( !IOV::key_contains_range(i.first, req_key) )  {
-        ++i.second->age_value;
-        continue;
-      }
-      cond_validity.iov_intersection(i.first);
-      pool_selected = i.second->select_all(predicate_processor);
-      num_selected += pool_selected;
-      i.second->age_value = 0;
+  dd4hep_lock_t guard(lock);
+  size_t num_selected = 0;
+  if ( !m_elements.empty() )  {
+    IndexEntries entries;
+    m_index.selectActive(req_validity.key(), entries);
+    sort_entries(entries);
+    for( const auto* e : entries )  {
+      cond_validity.iov_intersection(e->key);
+      num_selected += e->pool->select_all(predicate_processor);
     }
   }
   return num_selected;
@@ -154,6 +206,7 @@ size_t ConditionsIOVPool::select(const IOV& req_validity,
                                  Elements&  valid,
                                  IOV&       cond_validity)
 {
+  dd4hep_lock_t guard(lock);
   size_t num_selected = select(req_validity, valid);
   cond_validity.invert().reset();
   for( const auto& i : valid )
@@ -164,14 +217,13 @@ size_t ConditionsIOVPool::select(const IOV& req_validity,
 /// Select all ACTIVE conditions, which do match the IOV requirement
 size_t ConditionsIOVPool::select(const IOV& req_validity, Elements&  valid)
 {
+  dd4hep_lock_t guard(lock);
   size_t num_selected = 0;
-  if ( !elements.empty() )   {
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& i : elements )  {
-      if ( !IOV::key_contains_range(i.first, req_key) )  {
-        continue;
-      }
-      valid[i.first] = i.second;
+  if ( !m_elements.empty() )   {
+    IndexEntries entries;
+    m_index.select(req_validity.key(), entries);
+    for( const auto* e : entries )  {
+      valid[e->key] = e->pool;
       ++num_selected;
     }
   }
@@ -183,6 +235,7 @@ size_t ConditionsIOVPool::select(const IOV&        req_validity,
                                  std::vector<Element>&  valid,
                                  IOV&              cond_validity)
 {
+  dd4hep_lock_t guard(lock);
   size_t num_selected = select(req_validity, valid);
   cond_validity.invert().reset();
   for( const auto& i : valid )
@@ -193,14 +246,31 @@ size_t ConditionsIOVPool::select(const IOV&        req_validity,
 /// Select all ACTIVE conditions, which do match the IOV requirement
 size_t ConditionsIOVPool::select(const IOV& req_validity, std::vector<Element>& valid)
 {
+  dd4hep_lock_t guard(lock);
+  size_t num_selected = 0;
+  if ( !m_elements.empty() )   {
+    IndexEntries entries;
+    m_index.select(req_validity.key(), entries);
+    sort_entries(entries);
+    for( const auto* e : entries )  {
+      valid.emplace_back(e->pool);
+      ++num_selected;
+    }
+  }
+  return num_selected;
+}
+
+/// Select all ACTIVE conditions pools, which do match the IOV requirement and update the pool ages
+size_t ConditionsIOVPool::selectActive(const IOV& req_validity, std::vector<Element>& valid)
+{
+  dd4hep_lock_t guard(lock);
   size_t num_selected = 0;
-  if ( !elements.empty() )   {
-    const IOV::Key req_key = req_validity.key(); // 16 bytes => better copy!
-    for( const auto& i : elements )  {
-      if ( !IOV::key_contains_range(i.first, req_key) )  {
-        continue;
-      }
-      valid.emplace_back(i.second);
+  if ( !m_elements.empty() )   {
+    IndexEntries entries;
+    m_index.selectActive(req_validity.key(), entries);
+    sort_entries(entries);
+    for( const auto* e : entries )  {
+      valid.emplace_back(e->pool);
       ++num_selected;
     }
   }
@@ -38,7 +38,7 @@ size_t Operators::collectAllConditions(ConditionsManager manager, RangeCondition
     if ( type )   {
       ConditionsIOVPool* pool = manager.iovPool(*type);
       if ( pool )  {
-        for( auto& cp : pool->elements )  {
+        for( const auto& cp : pool->elements() )  {
           RangeConditions rc;
           cp.second->select_all(rc);
           for( auto c : rc )
@@ -65,7 +65,7 @@ size_t Operators::collectAllConditions(ConditionsManager manager, std::map<int,C
     if ( type )   {
       ConditionsIOVPool* pool = manager.iovPool(*type);
       if ( pool )  {
-        for( auto& cp : pool->elements )  {
+        for( const auto& cp : pool->elements() )  {
           RangeConditions rc;
           cp.second->select_all(rc);
           for( auto c : rc )
@@ -214,7 +214,7 @@ int ConditionsRepository::save(ConditionsManager manager, const std::string& out
     if ( type )   {
       ConditionsIOVPool* pool = manager.iovPool(*type);
       if ( pool )  {
-        for( const auto& cp : pool->elements )   {
+        for( const auto& cp : pool->elements() )   {
           RangeConditions rc;
           cp.second->select_all(rc);
           for( const auto& cond : rc )
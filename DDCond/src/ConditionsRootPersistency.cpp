@@ -109,7 +109,7 @@ size_t ConditionsRootPersistency::add(const std::string& identifier, ConditionsP
 size_t ConditionsRootPersistency::add(const std::string& identifier, const ConditionsIOVPool& pool)    {
   size_t count = 0;
   DurationStamp stamp(this);
-  for( const auto& p : pool.elements )  {
+  for( const auto& p : pool.elements() )  {
     iovPools.emplace_back(std::pair<iov_key_type, pool_type>());
     pool_type&    ent = iovPools.back().second;
     iov_key_type& key = iovPools.back().first;
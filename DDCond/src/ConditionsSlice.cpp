@@ -184,6 +184,7 @@ void dd4hep::cond::fill_content(ConditionsManager mgr,
                                 const IOVType& typ)
 {
   ConditionsIOVPool* iovPool = mgr.iovPool(typ);
-  ConditionsIOVPool::Elements& pools = iovPool->elements;
+  dd4hep_lock_t lock(iovPool->lock);
+  const ConditionsIOVPool::Elements& pools = iovPool->elements();
   for_each(begin(pools),end(pools),SliceOper(content));
 }
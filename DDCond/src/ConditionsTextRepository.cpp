@@ -208,7 +208,7 @@ int ConditionsTextRepository::save(ConditionsManager manager, const std::string&
     if ( type )   {
       ConditionsIOVPool* pool = manager.iovPool(*type);
       if ( pool )  {
-        for ( const auto& cp : pool->elements )   {
+        for ( const auto& cp : pool->elements() )   {
           RangeConditions rc;
           cp.second->select_all(rc);
           for(auto c : rc )
@@ -108,7 +108,7 @@ std::size_t ConditionsTreePersistency::add(const std::string& identifier, Condit
 std::size_t ConditionsTreePersistency::add(const std::string& identifier, const ConditionsIOVPool& pool)    {
   std::size_t count = 0;
   DurationStamp stamp(this);
-  for( const auto& p : pool.elements )  {
+  for( const auto& p : pool.elements() )  {
     iovPools.emplace_back(std::pair<iov_key_type, pool_type>());
     pool_type&    ent = iovPools.back().second;
     iov_key_type& key = iovPools.back().first;
@@ -125,6 +125,14 @@ namespace {
     return false;
   }
 
+  /// Lock the IOV pool a conditions pool belongs to while conditions are inserted
+  std::unique_lock<dd4hep::dd4hep_mutex_t>
+  __lock_iov_pool(const Manager_Type1::TypedConditionPool& pools, const ConditionsPool& pool)  {
+    if ( pool.iov && pool.iov->type < pools.size() && pools[pool.iov->type] )
+      return std::unique_lock<dd4hep::dd4hep_mutex_t>(pools[pool.iov->type]->lock);
+    return std::unique_lock<dd4hep::dd4hep_mutex_t>();
+  }
+
   template <typename PMF>
   void __callListeners(const Manager_Type1::Listeners& listeners, PMF pmf, dd4hep::Condition& cond)  {
     for(const auto& listener : listeners )
@@ -220,8 +228,10 @@ ConditionsPool* Manager_Type1::registerIOV(const IOVType& typ, IOV::Key key)   {
   if ( !pool )  {
     m_rawPool[typ.type] = pool = new ConditionsIOVPool(&typ);
   }
-  ConditionsIOVPool::Elements::const_iterator i = pool->elements.find(key);
-  if ( i != pool->elements.end() )   {
+  // Other user pools may concurrently select from this IOV pool
+  dd4hep_lock_t      iov_lock(pool->lock);
+  ConditionsIOVPool::Elements::const_iterator i = pool->elements().find(key);
+  if ( i != pool->elements().end() )   {
     return (*i).second.get();
   }
   IOV* iov = new IOV(&typ);
@@ -229,7 +239,7 @@ ConditionsPool* Manager_Type1::registerIOV(const IOVType& typ, IOV::Key key)   {
   iov->keyData   = key;
   const void* argv_pool[] = {this, iov, 0};
   std::shared_ptr<ConditionsPool> cond_pool(createPlugin<ConditionsPool>(m_poolType,m_detDesc,2,argv_pool));
-  pool->elements.emplace(key,cond_pool);
+  pool->insert(key,cond_pool);
   printout(INFO,"ConditionsMgr","Created IOV Pool for:%s",iov->str().c_str());
   return cond_pool.get();
 }
@@ -239,12 +249,15 @@ ConditionsIOVPool* Manager_Type1::iovPool(const IOVType& iov_type)  const    {
   return m_rawPool[iov_type.type];
 }
 
-/// Register new condition with the conditions store. Unlocked version, not multi-threaded
+/// Register new condition with the conditions store. Only the IOV pool of the target pool is locked
 bool Manager_Type1::registerUnlocked(ConditionsPool& pool, Condition cond)   {
   if ( cond.isValid() )  {
+    auto iov_lock = __lock_iov_pool(m_rawPool, pool);
     cond->iov  = pool.iov;
     cond->setFlag(Condition::ACTIVE);
-    pool.insert(cond);
+    if ( !pool.insert(cond) )   {
+      return false;
+    }
 #if !defined(DD4HEP_MINIMAL_CONDITIONS) && defined(DD4HEP_CONDITIONS_HAVE_NAME)
     printout(DEBUG,"ConditionsMgr","Register condition %016lX %s [%s] IOV:%s",
              cond.key(), cond.name(), cond->address.c_str(), pool.iov->str().c_str());
@@ -269,11 +282,14 @@ bool Manager_Type1::registerUnlocked(ConditionsPool& pool, Condition cond)   {
 /// Register a whole block of conditions with identical IOV.
 std::size_t Manager_Type1::blockRegister(ConditionsPool& pool, const std::vector<Condition>& cond) const {
   std::size_t result = 0;
+  auto iov_lock = __lock_iov_pool(m_rawPool, pool);
   for(auto c : cond)   {
     if ( c.isValid() )    {
       c->iov = pool.iov;
       c->setFlag(Condition::ACTIVE);
-      pool.insert(c);
+      if ( !pool.insert(c) )   {
+        continue;
+      }
       if ( !m_onRegister.empty() )   {
         __callListeners(m_onRegister, &ConditionsListener::onRegisterCondition, c);
       }
@@ -360,6 +376,8 @@ std::pair<int,int> Manager_Type1::clean(const ConditionsCleanup& cleaner)   {
   std::pair<int,int> count(0,0);
   for( TypedConditionPool::iterator i=m_rawPool.begin(); i != m_rawPool.end(); ++i)  {
     ConditionsIOVPool* p = *i;
+    // The pool ages are kept lazily: write them before the policy inspects the pool
+    if ( p ) p->updateAges();
     if ( p && cleaner(*p) )  {
       ++count.first;
       count.second += p->clean(cleaner);
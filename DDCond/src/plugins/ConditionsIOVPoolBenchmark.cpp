@@ -0,0 +1,140 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DD4hep/Detector.h>
+#include <DD4hep/Printout.h>
+#include <DD4hep/Factories.h>
+#include <DDCond/ConditionsManager.h>
+#include <DDCond/ConditionsIOVPool.h>
+
+// C/C++ include files
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+using namespace dd4hep;
+using namespace dd4hep::cond;
+
+namespace  {
+
+  /// Benchmark of the ConditionsIOVPool selection: linear scan versus IOV index
+  /**
+   *  The IOV pool of one IOV type is populated with many IOV ranges:
+   *  mostly consecutive ranges of 10 runs and every 10th range with a
+   *  random length of up to 10000 runs. For random runs the pools containing
+   *  the run are selected using the IOV index and using a linear scan
+   *  over all elements. Both selections must return the identical pools.
+   *
+   *  Test: geoPluginRun -plugin DD4hep_ConditionsIOVPoolBenchmark \
+   *                     [-iovs <number>] [-queries <number>]
+   *
+   *  @author  M.Frank
+   *  @version 1.0
+   */
+  struct ConditionsIOVPoolBenchmark  {
+    using clock_t = std::chrono::high_resolution_clock;
+    typedef std::vector<ConditionsIOVPool::Element> Elements;
+    ConditionsManager  manager;
+    ConditionsIOVPool* pool     { nullptr };
+    const IOVType*     iov_type { nullptr };
+    std::size_t        num_iov  { 10000 };
+    std::size_t        num_query{ 10000 };
+    long               max_run  { 1 };
+
+    /// Initializing constructor
+    ConditionsIOVPoolBenchmark(Detector& description, int argc, char** argv)   {
+      for( int i = 0; i < argc && argv[i]; ++i )   {
+        if ( 0 == ::strncmp(argv[i], "-iovs", 4) && i+1 < argc )
+          num_iov = std::max(1L, ::atol(argv[++i]));
+        else if ( 0 == ::strncmp(argv[i], "-queries", 4) && i+1 < argc )
+          num_query = std::max(1L, ::atol(argv[++i]));
+      }
+      description.apply("DD4hep_ConditionsManagerInstaller",0,(char**)0);
+      manager = ConditionsManager::from(description);
+      manager["PoolType"]       = "DD4hep_ConditionsLinearPool";
+      manager["UserPoolType"]   = "DD4hep_ConditionsMapUserPool";
+      manager["UpdatePoolType"] = "DD4hep_ConditionsLinearUpdatePool";
+      manager.initialize();
+      iov_type = manager.registerIOVType(0,"run").second;
+      if ( !iov_type )
+        except("ConditionsIOVPoolBenchmark","++ Failed to register IOV type.");
+    }
+    /// Register the IOV ranges to the manager
+    void populate()   {
+      std::mt19937_64 rndm(12345);
+      PrintLevel level = setPrintLevel(WARNING);
+      for( std::size_t i = 0; i < num_iov; ++i )   {
+        long first = long(i)*10 + 1, last = first + 9;
+        if ( i%10 == 0 )   {
+          first = 1 + long(rndm()%(num_iov*10));
+          last  = first + long(rndm()%10000);
+        }
+        manager.registerIOV(*iov_type, IOV::Key(first, last));
+        max_run = std::max(max_run, last);
+      }
+      setPrintLevel(level);
+      pool = manager.iovPool(*iov_type);
+    }
+    /// Reference selection: linear scan over all elements
+    void select_linear(const IOV& req, Elements& result)  const  {
+      dd4hep_lock_t guard(pool->lock);
+      for( const auto& e : pool->elements() )   {
+        if ( IOV::key_contains_range(e.first, req.keyData) )
+          result.emplace_back(e.second);
+      }
+    }
+    /// Execute the benchmark
+    long run()   {
+      populate();
+      std::vector<long> runs(num_query);
+      std::mt19937_64 rndm(54321);
+      for( auto& r : runs ) r = 1 + long(rndm()%max_run);
+
+      std::vector<Elements> linear(num_query), indexed(num_query);
+      auto start = clock_t::now();
+      for( std::size_t i = 0; i < num_query; ++i )
+        select_linear(IOV(iov_type, runs[i]), linear[i]);
+      auto middle = clock_t::now();
+      for( std::size_t i = 0; i < num_query; ++i )
+        pool->select(IOV(iov_type, runs[i]), indexed[i]);
+      auto stop = clock_t::now();
+
+      std::size_t errors = 0, selected = 0;
+      for( std::size_t i = 0; i < num_query; ++i )   {
+        errors   += (linear[i] != indexed[i]) ? 1 : 0;
+        selected += indexed[i].size();
+      }
+      std::chrono::duration<double, std::micro> linear_us = middle - start, index_us = stop - middle;
+      printout(INFO,"IOVPoolBenchmark","+++ %ld IOV ranges [1, %ld] x %ld selections: %.2f pools per selection",
+               pool->elements().size(), max_run, num_query, double(selected)/double(num_query));
+      printout(INFO,"IOVPoolBenchmark","+++ Linear scan: %9.3f us/selection",
+               linear_us.count()/double(num_query));
+      printout(INFO,"IOVPoolBenchmark","+++ IOV index:   %9.3f us/selection  speedup: %6.2f",
+               index_us.count()/double(num_query),
+               index_us.count() > 0e0 ? linear_us.count()/index_us.count() : 0e0);
+      printout(errors ? ERROR : INFO,"IOVPoolBenchmark",
+               "+++ %ld mismatching selections between linear scan and IOV index.", errors);
+      return errors == 0 ? 1 : 0;
+    }
+    /// Action routine to execute the benchmark
+    static long execute(Detector& description, int argc, char** argv)   {
+      ConditionsIOVPoolBenchmark bench(description, argc, argv);
+      return bench.run();
+    }
+  };
+}
+DECLARE_APPLY(DD4hep_ConditionsIOVPoolBenchmark,ConditionsIOVPoolBenchmark::execute)
@@ -157,8 +157,10 @@ static int ddcond_conditions_pool_processor(Detector& description, bool process_
     if ( type )   {
       ConditionsIOVPool* pool = manager.iovPool(*type);
       if ( pool )  {
-        const ConditionsIOVPool::Elements& e = pool->elements;
+        dd4hep_lock_t guard(pool->lock);
+        const ConditionsIOVPool::Elements& e = pool->elements();
         if ( process_pool )  {
+          pool->updateAges();
           printout(INFO,"CondPoolProcessor","+++ ConditionsIOVPool for type %s  [%d IOV element%s]",
                    type->str().c_str(), int(e.size()),e.size()==1 ? "" : "s");
         }
@@ -0,0 +1,151 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DD4HEP_CONDITIONS_CONDITIONSSNAPSHOTBINARYLOADER_H
+#define DD4HEP_CONDITIONS_CONDITIONSSNAPSHOTBINARYLOADER_H
+
+// Framework include files
+#include <DDCond/ConditionsDataLoader.h>
+#include <DDCond/ConditionsBinarySnapshot.h>
+
+// C/C++ include files
+#include <memory>
+#include <vector>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for implementation details of the AIDA detector description toolkit
+  namespace cond  {
+
+    /// Conditions loader serving conditions from memory mapped binary snapshots
+    /**
+     *  The data sources are files written by the ConditionsBinarySnapshot.
+     *  The files are mapped to memory at the first load request.
+     *  Missing conditions are looked up by key in the index of the mapped files.
+     *  Only the requested conditions are decoded and registered to the
+     *  conditions pool of their IOV. If several files contain a condition
+     *  the first source added wins.
+     *
+     *  \author   M.Frank
+     *  \version  1.0
+     *  \ingroup  DD4HEP_CONDITIONS
+     */
+    class ConditionsSnapshotBinaryLoader : public ConditionsDataLoader   {
+      typedef ConditionsBinarySnapshot::MappedFile MappedFile;
+      /// Memory mapped snapshot files
+      std::vector<std::unique_ptr<MappedFile> > m_files;
+      /// Number of conditions decoded from the snapshot files
+      std::size_t                               m_numLoaded = 0;
+      /// Map the pending data sources to memory
+      void map_sources();
+    public:
+      /// Default constructor
+      ConditionsSnapshotBinaryLoader(Detector& description, ConditionsManager mgr, const std::string& nam);
+      /// Default destructor
+      virtual ~ConditionsSnapshotBinaryLoader();
+      /// Load a number of conditions items from the snapshot files according to the required IOV
+      virtual size_t load_many(  const IOV&      req_validity,
+                                 RequiredItems&  work,
+                                 LoadedItems&    loaded,
+                                 IOV&            conditions_validity)  override;
+    };
+  }    /* End namespace cond                             */
+}      /* End namespace dd4hep                           */
+#endif /* DD4HEP_CONDITIONS_CONDITIONSSNAPSHOTBINARYLOADER_H  */
+
+//#include <ConditionsSnapshotBinaryLoader.h>
+#include <DD4hep/Printout.h>
+#include <DD4hep/Factories.h>
+#include <DD4hep/detail/ConditionsInterna.h>
+#include <DDCond/ConditionsIOVPool.h>
+#include <DDCond/ConditionsManagerObject.h>
+
+// Forward declartions
+using namespace dd4hep::cond;
+
+namespace {
+  void* create_loader(dd4hep::Detector& description, int argc, char** argv)   {
+    const char* name = argc>0 ? argv[0] : "BinarySnapshotLoader";
+    ConditionsManagerObject* mgr = (ConditionsManagerObject*)(argc>0 ? argv[1] : 0);
+    return new ConditionsSnapshotBinaryLoader(description,ConditionsManager(mgr),name);
+  }
+}
+DECLARE_DD4HEP_CONSTRUCTOR(DD4hep_Conditions_binary_snapshot_Loader,create_loader)
+
+/// Standard constructor, initializes variables
+ConditionsSnapshotBinaryLoader::ConditionsSnapshotBinaryLoader(Detector& description, ConditionsManager mgr, const std::string& nam)
+: ConditionsDataLoader(description, mgr, nam)
+{
+}
+
+/// Default Destructor
+ConditionsSnapshotBinaryLoader::~ConditionsSnapshotBinaryLoader() {
+  printout(DEBUG,"BinarySnapshotLoader","+++ Loaded %ld conditions from %ld snapshot files.",
+           long(m_numLoaded), long(m_files.size()));
+  m_files.clear();
+}
+
+/// Map the pending data sources to memory
+void ConditionsSnapshotBinaryLoader::map_sources()   {
+  for( const auto& src : m_sources )   {
+    std::unique_ptr<MappedFile> file(new MappedFile(src.first));
+    const ConditionsBinarySnapshot::TypeEntry* types = file->types();
+    for( std::size_t i = 0; i < file->header().numTypes; ++i )   {
+      /// Throws if the IOV type is already used with a different name
+      m_mgr.registerIOVType(types[i].type, file->string(types[i].nameOffset, types[i].nameLength));
+    }
+    printout(INFO,"BinarySnapshotLoader","+++ Mapped conditions snapshot %s with %ld conditions.",
+             file->name().c_str(), long(file->size()));
+    m_files.emplace_back(std::move(file));
+  }
+  m_sources.clear();
+}
+
+/// Load a number of conditions items from the snapshot files according to the required IOV
+size_t ConditionsSnapshotBinaryLoader::load_many(const IOV&      req_validity,
+                                                 RequiredItems&  work,
+                                                 LoadedItems&    loaded,
+                                                 IOV&            conditions_validity)
+{
+  std::size_t len = loaded.size();
+  if ( !m_sources.empty() )  {
+    map_sources();
+  }
+  if ( !req_validity.iovType )  {
+    except("BinarySnapshotLoader","+++ load_many: Invalid IOV type of the required validity.");
+  }
+  for( const auto& item : work )   {
+    for( const auto& file : m_files )   {
+      const ConditionsBinarySnapshot::Entry* entry = file->find(item.first, req_validity);
+      if ( !entry ) continue;
+      IOV::Key           key(entry->lower, entry->upper);
+      ConditionsPool*    pool     = m_mgr.registerIOV(*req_validity.iovType, key);
+      ConditionsIOVPool* iov_pool = m_mgr.iovPool(*req_validity.iovType);
+      Condition          cond;
+      {
+        /// Other threads may register conditions to the same pool concurrently
+        dd4hep_lock_t lock(iov_pool->lock);
+        cond = pool->exists(item.first);
+        if ( !cond.isValid() )  {
+          cond = file->decode(*entry);
+          m_mgr.registerUnlocked(*pool, cond);
+          ++m_numLoaded;
+        }
+      }
+      loaded[item.first] = cond;
+      conditions_validity.iov_intersection(key);
+      break;
+    }
+  }
+  return loaded.size() - len;
+}
@@ -19,6 +19,8 @@
 
 // C/C++ include files
 #include <map>
+#include <memory>
+#include <vector>
 #include <unordered_map>
 
 /// Namespace for the AIDA detector description toolkit
@@ -29,6 +31,7 @@ namespace dd4hep {
 
     /// Forward declarations
     class ConditionsDataLoader;
+    class ConditionsContent;
     
     /// Class implementing the conditions user pool for a given IOV type
     /**
@@ -51,12 +54,29 @@ namespace dd4hep {
       ConditionsIOVPool*    m_iovPool = 0;
       /// The loader to access non-existing conditions
       ConditionsDataLoader* m_loader = 0;
+      /// Incremental prepare: Slice content the consumer table was built for
+      std::weak_ptr<ConditionsContent> m_content;
+      /// Incremental prepare: Size of the slice content the consumer table was built for
+      size_t                m_contentSize = 0;
+      /// Incremental prepare: Cleanup generation of the IOV pool at the last full selection
+      size_t                m_generation = 0;
+      /// Incremental prepare: Derived conditions consuming a given condition
+      std::unordered_map<Condition::key_type,std::vector<Condition::key_type> > m_consumers;
 
       /// Internal helper to find conditions
       Condition::Object* i_findCondition(Condition::key_type key)  const;
 
       /// Internal insertion helper
       bool i_insert(Condition::Object* o);
+      /// Internal helper: Adopt a condition registered by a concurrent user pool. IOV pool must be locked
+      bool i_adopt(ConditionsPool& pool, Condition cond);
+
+      /// Incremental prepare: Check if the conditions of the last call may be kept
+      bool i_incremental(const IOV& required, const ConditionsSlice& slice)  const;
+      /// Incremental prepare: Drop expired conditions and dependents, then select again. Returns number of selections
+      size_t i_update(const IOV& required, const ConditionsSlice& slice, IOV& pool_iov);
+      /// Incremental prepare: Build the table of consumers from the slice content
+      void i_track(const ConditionsSlice& slice);
 
     public:
       /// Default constructor
@@ -163,7 +183,7 @@ namespace dd4hep {
 #include <DDCond/ConditionsDependencyHandler.h>
 
 // C/C++ include files
-#include <mutex>
+#include <set>
 
 using namespace dd4hep::cond;
 
@@ -254,6 +274,23 @@ ConditionsMappedUserPool<MAPPING>::i_insert(Condition::Object* o)   {
   return ret;
 }
   
+/// Internal helper: Adopt a condition registered by a concurrent user pool. IOV pool must be locked
+template<typename MAPPING> inline bool
+ConditionsMappedUserPool<MAPPING>::i_adopt(ConditionsPool& pool, Condition cond)   {
+  Condition present = pool.exists(cond->hash);
+  if ( !present.isValid() )   {
+    return false;
+  }
+  // Another slice computed and registered the same condition for this IOV.
+  // The manager owns the registered object: use it and drop the own copy.
+  if ( present.ptr() != cond.ptr() )   {
+    printout(DEBUG,"UserPool","++ Adopt condition [%016llX] registered concurrently.", cond->hash);
+    delete cond.ptr();
+  }
+  m_conditions[present->hash] = present.ptr();
+  return true;
+}
+
 /// Total entry count
 template<typename MAPPING>
 size_t ConditionsMappedUserPool<MAPPING>::size()  const  {
@@ -280,6 +317,8 @@ void ConditionsMappedUserPool<MAPPING>::clear()   {
   }
   m_iov = IOV(0);
   m_conditions.clear();
+  m_consumers.clear();
+  m_content.reset();
 }
 
 /// Check a condition for existence
@@ -313,6 +352,11 @@ ConditionsMappedUserPool<MAPPING>::registerOne(const IOV& iov,
   if ( iov.iovType )   {
     ConditionsPool* pool = m_manager.registerIOV(*iov.iovType,iov.keyData);
     if ( pool )   {
+      // Check for a concurrent registration under the IOV pool lock
+      dd4hep_lock_t guard(m_manager.iovPool(*iov.iovType)->lock);
+      if ( i_adopt(*pool, cond) )   {
+        return true;
+      }
       return m_manager.registerUnlocked(*pool, cond);
     }
     except("UserPool","++ Failed to register IOV: %s",iov.str().c_str());
@@ -328,14 +372,22 @@ ConditionsMappedUserPool<MAPPING>::registerMany(const IOV& iov,
   if ( iov.iovType )   {
     ConditionsPool* pool = m_manager.registerIOV(*iov.iovType,iov.keyData);
     if ( pool )   {
-      std::size_t result = m_manager.blockRegister(*pool, conds);
-      if ( result == conds.size() )   {
-        for(auto c : conds) i_insert(c.ptr());
-        return result;
+      // Slices preparing the same IOV compute the same derived conditions concurrently.
+      // Select them again under the IOV pool lock and adopt the registered objects.
+      dd4hep_lock_t guard(m_manager.iovPool(*iov.iovType)->lock);
+      std::vector<Condition> missing;
+      missing.reserve(conds.size());
+      for(auto c : conds)   {
+        if ( !i_adopt(*pool, c) ) missing.emplace_back(c);
+      }
+      std::size_t result = m_manager.blockRegister(*pool, missing);
+      if ( result == missing.size() )   {
+        for(auto c : missing) i_insert(c.ptr());
+        return conds.size();
       }
       except("UserPool","++ Conditions registration was incomplete: "
              "registerd only  %ld out of %ld conditions.",
-             result, conds.size());
+             result, missing.size());
     }
     except("UserPool","++ Failed to register IOV: %s",iov.str().c_str());
   }
@@ -499,6 +551,89 @@ namespace {
   };
 }
 
+/// Incremental prepare: Check if the conditions of the last call may be kept
+template<typename MAPPING> bool
+ConditionsMappedUserPool<MAPPING>::i_incremental(const IOV& required, const ConditionsSlice& slice)  const  {
+  if ( !(slice.flags&ConditionsSlice::INCREMENTAL) || m_conditions.empty() )
+    return false;
+  else if ( m_iov.iovType != required.iovType )
+    return false;
+  else if ( m_content.lock() != slice.content || m_contentSize != slice.size() )
+    return false;
+  // Removed IOV pools invalidate the conditions kept from the last call
+  dd4hep_lock_t guard(m_iovPool->lock);
+  return m_generation == m_iovPool->generation;
+}
+
+/// Incremental prepare: Drop expired conditions and dependents, then select again. Returns number of selections
+template<typename MAPPING> std::size_t
+ConditionsMappedUserPool<MAPPING>::i_update(const IOV& required, const ConditionsSlice& slice, IOV& pool_iov)  {
+  const IOV::Key req_key = required.key();
+  std::vector<Condition::key_type> expired;
+  std::set<Condition::key_type> removed, lookup;
+  std::vector<ConditionsIOVPool::Element> pools;
+  std::size_t num_selected = 0;
+
+  for( const auto& c : m_conditions )  {
+    const IOV* iov = c.second->iov;
+    if ( !iov || !IOV::key_contains_range(iov->keyData, req_key) )
+      expired.emplace_back(c.first);
+  }
+  std::size_t num_expired = expired.size();
+  // Expired conditions invalidate all derived conditions depending on them
+  while( !expired.empty() )  {
+    Condition::key_type key = expired.back();
+    expired.pop_back();
+    if ( removed.insert(key).second )  {
+      auto i = m_consumers.find(key);
+      m_conditions.erase(key);
+      if ( i != m_consumers.end() )
+        expired.insert(expired.end(), i->second.begin(), i->second.end());
+    }
+  }
+  // Removed conditions and conditions missing in the slice are selected again
+  lookup = removed;
+  for( const auto& c : slice.content->conditions() )  {
+    if ( m_conditions.find(c.first) == m_conditions.end() ) lookup.insert(c.first);
+  }
+  for( const auto& c : slice.content->derived() )  {
+    if ( m_conditions.find(c.first) == m_conditions.end() ) lookup.insert(c.first);
+  }
+  dd4hep_lock_t guard(m_iovPool->lock);
+  m_iovPool->selectActive(required, pools);
+  pool_iov.reset().invert();
+  for( const auto& p : pools )
+    pool_iov.iov_intersection(*(p->iov));
+  for( auto key : lookup )  {
+    for( const auto& p : pools )  {
+      Condition c = p->exists(key);
+      if ( c.isValid() )  {
+        m_conditions.emplace(key, c.ptr());
+        ++num_selected;
+        break;
+      }
+    }
+  }
+  printout((flags&PRINT_LOAD) ? INFO : DEBUG,"UserPool",
+           "Incremental update: %ld conditions expired, %ld removed, %ld selected again.",
+           num_expired, removed.size(), num_selected);
+  return num_selected;
+}
+
+/// Incremental prepare: Build the table of consumers from the slice content
+template<typename MAPPING>
+void ConditionsMappedUserPool<MAPPING>::i_track(const ConditionsSlice& slice)  {
+  if ( m_content.lock() != slice.content || m_contentSize != slice.size() )  {
+    m_consumers.clear();
+    for( const auto& d : slice.content->derived() )  {
+      for( const auto& k : d.second->dependencies )
+        m_consumers[k.hash].emplace_back(d.first);
+    }
+    m_content     = slice.content;
+    m_contentSize = slice.size();
+  }
+}
+
 template<typename MAPPING> ConditionsManager::Result
 ConditionsMappedUserPool<MAPPING>::prepare(const IOV&                  required, 
                                            ConditionsSlice&            slice,
@@ -512,48 +647,64 @@ ConditionsMappedUserPool<MAPPING>::prepare(const IOV&                  required,
   auto&  slice_miss_calc = slice.missingDerivations();
   bool   do_load         = m_manager->doLoadConditions();
   bool   do_output_miss  = m_manager->doOutputUnloaded();
+  bool   do_incremental  = i_incremental(required, slice);
   IOV    pool_iov(required.iovType);
   ConditionsManager::Result result;
+  CondMissing cond_missing;
+  CalcMissing calc_missing;
+  long num_cond_miss = 0, num_calc_miss = 0;
+  std::size_t num_selected = 0;
+
+  // The IOV pool is locked during the selection. Independent user pools
+  // select, load and compute concurrently: only the loader is serialized.
+  // In incremental mode only the expired conditions are selected again.
+  auto select_missing = [&]()  {
+    if ( do_incremental )  {
+      num_selected += i_update(required, slice, pool_iov);
+    }
+    else  {
+      dd4hep_lock_t guard(m_iovPool->lock);
+      m_generation = m_iovPool->generation;
+      m_conditions.clear();
+      pool_iov.reset().invert();
+      m_iovPool->select(required, Operators::mapConditionsSelect(m_conditions), pool_iov);
+    }
+    m_iov = pool_iov;
+    cond_missing.resize(slice_cond.size()+m_conditions.size());
+    calc_missing.resize(slice_calc.size()+m_conditions.size());
+    num_cond_miss = set_difference(begin(slice_cond),   end(slice_cond),
+                                   begin(m_conditions), end(m_conditions),
+                                   begin(cond_missing), COMP()) - begin(cond_missing);
+    num_calc_miss = set_difference(begin(slice_calc),   end(slice_calc),
+                                   begin(m_conditions), end(m_conditions),
+                                   begin(calc_missing), COMP()) - begin(calc_missing);
+    cond_missing.resize(num_cond_miss);
+    calc_missing.resize(num_calc_miss);
+    result.loaded   = 0;
+    result.computed = 0;
+    result.selected = do_incremental ? num_selected : m_conditions.size();
+    result.missing  = num_cond_miss+num_calc_miss;
+  };
 
-  // This is a critical operation, because we have to ensure the
-  // IOV pools are ONLY manipulated by the current thread.
-  // Otherwise the selection and the population are unsafe!
-  static std::mutex lock;
-  std::lock_guard<std::mutex> guard(lock);
-
-  m_conditions.clear();
   slice_miss_cond.clear();
   slice_miss_calc.clear();
-  pool_iov.reset().invert();
-  m_iovPool->select(required, Operators::mapConditionsSelect(m_conditions), pool_iov);
-  m_iov = pool_iov;
-  CondMissing cond_missing(slice_cond.size()+m_conditions.size());
-  CalcMissing calc_missing(slice_calc.size()+m_conditions.size());
-
-  CondMissing::iterator last_cond = set_difference(begin(slice_cond),   end(slice_cond),
-                                                   begin(m_conditions), end(m_conditions),
-                                                   begin(cond_missing), COMP());
-  long num_cond_miss = last_cond-begin(cond_missing);
-  cond_missing.resize(num_cond_miss);
+  select_missing();
+  //
+  // Now we load the missing conditions from the conditions loader
+  //
+  std::unique_lock<dd4hep_mutex_t> load_lock;
+  if ( num_cond_miss > 0 && do_load )  {
+    // Loaders are not thread safe. While waiting for the loader another user pool
+    // may already have loaded the missing conditions: select again.
+    load_lock = std::unique_lock<dd4hep_mutex_t>(m_loader->lock());
+    select_missing();
+  }
   printout((flags&PRINT_LOAD) ? INFO : DEBUG,"UserPool",
            "%ld conditions out of %ld conditions are MISSING.",
            num_cond_miss, slice_cond.size());
-  CalcMissing::iterator last_calc = set_difference(begin(slice_calc),   end(slice_calc),
-                                                   begin(m_conditions), end(m_conditions),
-                                                   begin(calc_missing), COMP());
-  long num_calc_miss = last_calc-begin(calc_missing);
-  calc_missing.resize(num_calc_miss);
   printout((flags&PRINT_COMPUTE) ? INFO : DEBUG,"UserPool",
            "%ld derived conditions out of %ld conditions are MISSING.",
            num_calc_miss, slice_calc.size());
-
-  result.loaded   = 0;
-  result.computed = 0;
-  result.selected = m_conditions.size();
-  result.missing  = num_cond_miss+num_calc_miss;
-  //
-  // Now we load the missing conditions from the conditions loader
-  //
   if ( num_cond_miss > 0 )  {
     if ( do_load )  {
       ConditionsDataLoader::LoadedItems loaded;
@@ -562,7 +713,7 @@ ConditionsMappedUserPool<MAPPING>::prepare(const IOV&                  required,
         // Need to compute the intersection: All missing entries are required....
         CondMissing load_missing(cond_missing.size()+loaded.size());
         // Note: cond_missing is already sorted (doc of 'set_difference'). No need to re-sort....
-        CondMissing::iterator load_last = set_difference(begin(cond_missing), last_cond,
+        CondMissing::iterator load_last = set_difference(begin(cond_missing), end(cond_missing),
                                                          begin(loaded), end(loaded),
                                                          begin(load_missing), COMP());
         long num_load_miss = load_last-begin(load_missing);
@@ -586,18 +737,21 @@ ConditionsMappedUserPool<MAPPING>::prepare(const IOV&                  required,
       }
     }
     else if ( do_output_miss )  {
-      copy(begin(cond_missing), last_cond, inserter(slice_miss_cond, slice_miss_cond.begin()));
+      copy(begin(cond_missing), end(cond_missing), inserter(slice_miss_cond, slice_miss_cond.begin()));
       for ( const auto& missing : slice_miss_cond )   {
         printout (ERROR, "TEST", "Unloaded: %s",missing.second->toString().c_str());
       }
     }
   }
+  if ( load_lock.owns_lock() )  {
+    load_lock.unlock();
+  }
   //
   // Now we update the already existing dependencies, which have expired
   //
   if ( num_calc_miss > 0 )  {
     if ( do_load )  {
-      std::map<Condition::key_type,const ConditionDependency*> deps(calc_missing.begin(),last_calc);
+      std::map<Condition::key_type,const ConditionDependency*> deps(calc_missing.begin(),calc_missing.end());
       ConditionsDependencyHandler handler(m_manager, *this, deps, user_param);
       /// 1rst pass: Compute/create the missing condiions
       handler.compute();
@@ -608,7 +762,7 @@ ConditionsMappedUserPool<MAPPING>::prepare(const IOV&                  required,
       result.missing -= handler.num_callback;
       if ( do_output_miss && result.computed < deps.size() )  {
         // Is this cheaper than an intersection ?
-        for( auto i = calc_missing.begin(); i != last_calc; ++i )   {
+        for( auto i = calc_missing.begin(); i != calc_missing.end(); ++i )   {
           typename MAPPING::iterator j = m_conditions.find((*i).first);
           if ( j == m_conditions.end() )
             slice_miss_calc.emplace(*i);
@@ -616,9 +770,12 @@ ConditionsMappedUserPool<MAPPING>::prepare(const IOV&                  required,
       }
     }
     else if ( do_output_miss )  {
-      copy(begin(calc_missing), last_calc, inserter(slice_miss_calc, slice_miss_calc.begin()));
+      copy(begin(calc_missing), end(calc_missing), inserter(slice_miss_calc, slice_miss_calc.begin()));
     }
   }
+  if ( slice.flags&ConditionsSlice::INCREMENTAL )  {
+    i_track(slice);
+  }
   slice.status = result;
   slice.used_pools.clear();
   if ( slice.flags&ConditionsSlice::REF_POOLS )   {
@@ -639,31 +796,39 @@ ConditionsMappedUserPool<MAPPING>::load(const IOV&                  required,
   bool   do_output_miss  = m_manager->doOutputUnloaded();
   IOV    pool_iov(required.iovType);
   ConditionsManager::Result result;
+  CondMissing cond_missing;
+  long num_cond_miss = 0;
+
+  // The IOV pool is locked during the selection. Independent user pools
+  // select and load concurrently: only the loader is serialized.
+  auto select_missing = [&]()  {
+    m_conditions.clear();
+    pool_iov.reset().invert();
+    m_iovPool->select(required, Operators::mapConditionsSelect(m_conditions), pool_iov);
+    m_iov = pool_iov;
+    cond_missing.resize(slice_cond.size()+m_conditions.size());
+    num_cond_miss = set_difference(begin(slice_cond),   end(slice_cond),
+                                   begin(m_conditions), end(m_conditions),
+                                   begin(cond_missing), COMP()) - begin(cond_missing);
+    cond_missing.resize(num_cond_miss);
+    result.loaded   = 0;
+    result.computed = 0;
+    result.missing  = num_cond_miss;
+    result.selected = m_conditions.size();
+  };
 
-  // This is a critical operation, because we have to ensure the
-  // IOV pools are ONLY manipulated by the current thread.
-  // Otherwise the selection and the population are unsafe!
-  static std::mutex lock;
-  std::lock_guard<std::mutex> guard(lock);
-
-  m_conditions.clear();
   slice_miss_cond.clear();
-  pool_iov.reset().invert();
-  m_iovPool->select(required, Operators::mapConditionsSelect(m_conditions), pool_iov);
-  m_iov = pool_iov;
-  CondMissing cond_missing(slice_cond.size()+m_conditions.size());
-  CondMissing::iterator last_cond = set_difference(begin(slice_cond),   end(slice_cond),
-                                                   begin(m_conditions), end(m_conditions),
-                                                   begin(cond_missing), COMP());
-  long num_cond_miss = last_cond-begin(cond_missing);
-  cond_missing.resize(num_cond_miss);
+  select_missing();
+  std::unique_lock<dd4hep_mutex_t> load_lock;
+  if ( num_cond_miss > 0 && do_load )  {
+    // Loaders are not thread safe. While waiting for the loader another user pool
+    // may already have loaded the missing conditions: select again.
+    load_lock = std::unique_lock<dd4hep_mutex_t>(m_loader->lock());
+    select_missing();
+  }
   printout((flags&PRINT_LOAD) ? INFO : DEBUG,"UserPool",
            "Found %ld missing conditions out of %ld conditions.",
            num_cond_miss, slice_cond.size());
-  result.loaded   = 0;
-  result.computed = 0;
-  result.missing  = num_cond_miss;
-  result.selected = m_conditions.size();
   //
   // Now we load the missing conditions from the conditions loader
   //
@@ -675,7 +840,7 @@ ConditionsMappedUserPool<MAPPING>::load(const IOV&                  required,
         // Need to compute the intersection: All missing entries are required....
         CondMissing load_missing(cond_missing.size()+loaded.size());
         // Note: cond_missing is already sorted (doc of 'set_difference'). No need to re-sort....
-        CondMissing::iterator load_last = set_difference(begin(cond_missing), last_cond,
+        CondMissing::iterator load_last = set_difference(begin(cond_missing), end(cond_missing),
                                                          begin(loaded), end(loaded),
                                                          begin(load_missing), COMP());
         long num_load_miss = load_last-begin(load_missing);
@@ -694,7 +859,7 @@ ConditionsMappedUserPool<MAPPING>::load(const IOV&                  required,
       }
     }
     else if ( do_output_miss )  {
-      copy(begin(cond_missing), last_cond, inserter(slice_miss_cond, slice_miss_cond.begin()));
+      copy(begin(cond_missing), end(cond_missing), inserter(slice_miss_cond, slice_miss_cond.begin()));
     }
   }
   slice.status = result;
@@ -714,12 +879,8 @@ ConditionsMappedUserPool<MAPPING>::compute(const IOV&                  required,
   IOV    pool_iov(required.iovType);
   ConditionsManager::Result result;
 
-  // This is a critical operation, because we have to ensure the
-  // IOV pools are ONLY manipulated by the current thread.
-  // Otherwise the selection and the population are unsafe!
-  static std::mutex lock;
-  std::lock_guard<std::mutex> guard(lock);
-
+  // No global lock: the user pool is private to the caller. The IOV pool
+  // is locked by the manager when the derived conditions are registered.
   slice_miss_calc.clear();
   CalcMissing calc_missing(slice_calc.size()+m_conditions.size());
   CalcMissing::iterator last_calc = set_difference(begin(slice_calc),   end(slice_calc),
@@ -24,6 +24,8 @@ namespace dd4hep {
 
     using DDSegmentation::BitFieldCoder;
     using DDSegmentation::BitFieldElement;
+    using DDSegmentation::BitFieldDecoder;
+    using DDSegmentation::BitFieldSpec;
 
   }       /* End namespace detail           */
 }         /* End namespace dd4hep             */
@@ -18,6 +18,8 @@
 #include <DD4hep/Shapes.h>
 
 // C/C++ include files
+#include <cstdint>
+#include <string>
 #include <vector>
 
 /// Namespace for the AIDA detector description toolkit
@@ -64,6 +66,8 @@ namespace dd4hep {
     SolenoidField();
     /// Call to access the field components at a given location
     virtual void fieldComponents(const double* pos, double* field);
+    /// Declare the box outside of which the field vanishes
+    virtual bool boundingBox(double lower[3], double upper[3]) const;
   };
 
   /// Implementation object of a dipole magnetic field.
@@ -85,6 +89,8 @@ namespace dd4hep {
     DipoleField();
     /// Call to access the field components at a given location
     virtual void fieldComponents(const double* pos, double* field);
+    /// Declare the box outside of which the field vanishes
+    virtual bool boundingBox(double lower[3], double upper[3]) const;
   };
 
   /// Implementation object of a Multipole magnetic field.
@@ -178,5 +184,118 @@ namespace dd4hep {
     virtual void fieldComponents(const double* pos, double* field);
   };
 
+  /// Implementation object of a magnetic field map tabulated on a regular grid.
+  /**
+   *  The field values are tabulated at the nodes of a regular grid, which is either
+   *
+   *  \li cartesian in (x,y,z) with the field components (Bx,By,Bz) or
+   *  \li cylindrical in (r,z) with the components (Br,Bz) and rotational
+   *      symmetry around the z-axis.
+   *
+   *  Between the nodes the field is interpolated tri-linearly (bi-linearly
+   *  in (r,z)). Outside the grid the map does not contribute.
+   *
+   *  The node values are stored in bricks of 2^blockShift nodes along each
+   *  grid axis, so that the corners of a grid cell and its neighbours share
+   *  cache lines. The binary file format mirrors the memory layout: the
+   *  Header (lengths in mm, field values in tesla) is followed by the node
+   *  values as 32 bit floats brick by brick. Files are memory mapped on load.
+   *
+   *  \version 1.0
+   *  \ingroup DD4HEP_CORE
+   */
+  class FieldMap : public CartesianField::Object {
+  public:
+    /// Supported grid types
+    enum GridType { GRID_XYZ = 0, GRID_RZ = 1 };
+
+    /// Header of the binary field map file
+    struct Header {
+      /// File identifier: "DD4FMAP"
+      char          magic[8]   { 'D','D','4','F','M','A','P', 0 };
+      /// File format version
+      std::uint32_t version    { 1 };
+      /// Grid type (see GridType)
+      std::uint32_t grid       { GRID_XYZ };
+      /// Number of field components per node: 3 for XYZ, 2 for RZ grids
+      std::uint32_t components { 3 };
+      /// Log2 of the brick edge length in nodes
+      std::uint32_t blockShift { 2 };
+      /// Number of nodes along the grid axes: (x,y,z) or (r,z,1)
+      std::uint32_t nodes[3]   { 2, 2, 2 };
+      /// Padding to keep the doubles aligned
+      std::uint32_t reserved   { 0 };
+      /// Position of the first node in mm
+      double        minimum[3] { 0e0, 0e0, 0e0 };
+      /// Grid spacing in mm
+      double        step[3]    { 1e0, 1e0, 1e0 };
+    };
+
+    /// Additional scale factor applied to the tabulated field values
+    double scale  { 1e0 };
+
+  protected:
+    /// Grid definition
+    Header             header   { };
+    /// Node values (either the memory mapped file or the owned storage)
+    const float*       values   { nullptr };
+    /// Node values if the map was not loaded from file
+    std::vector<float> storage  { };
+    /// Memory mapped file region
+    void*              mapping  { nullptr };
+    /// Size of the memory mapped region
+    std::size_t        mapSize  { 0 };
+    /// Lookup constants: grid origin in internal units
+    double             lower[3] { 0e0, 0e0, 0e0 };
+    /// Lookup constants: inverse grid spacing in internal units
+    double             inverse[3] { 1e0, 1e0, 1e0 };
+    /// Lookup constants: index of the last node along each axis
+    double             last[3]  { 1e0, 1e0, 1e0 };
+    /// Lookup constants: brick shift, mask and number of bricks along each axis
+    unsigned           shift[3] { 0, 0, 0 }, mask[3] { 0, 0, 0 }, blocks[3] { 1, 1, 1 };
+
+    /// Derive the lookup constants from the header
+    void prepare();
+    /// Release the memory mapped file if any
+    void unmap();
+    /// Offset of the first component of a node in the value array
+    std::size_t nodeIndex(unsigned i, unsigned j, unsigned k) const  {
+      std::size_t brick = (std::size_t(k >> shift[2]) * blocks[1] + (j >> shift[1])) * blocks[0] + (i >> shift[0]);
+      std::size_t local = (std::size_t(k & mask[2]) << (shift[0]+shift[1])) | ((j & mask[1]) << shift[0]) | (i & mask[0]);
+      return ((brick << (shift[0]+shift[1]+shift[2])) | local) * header.components;
+    }
+    /// Number of stored values including the padding of the bricks
+    std::size_t numValues() const;
+
+  public:
+    /// Initializing constructor
+    FieldMap();
+    /// No copy constructor
+    FieldMap(const FieldMap& copy) = delete;
+    /// Default destructor
+    virtual ~FieldMap();
+    /// No assignment
+    FieldMap& operator=(const FieldMap& copy) = delete;
+    /// Access the grid type
+    GridType gridType() const  {  return GridType(header.grid);  }
+    /// Access the grid definition
+    const Header& grid() const  {  return header;                }
+    /// Define the grid (internal units) and allocate the node values (initialized to zero)
+    /** For GRID_RZ the axes are (r,z): nodes[2], minimum[2] and step[2] are ignored.
+     */
+    void setGrid(GridType type, const unsigned nodes[3], const double minimum[3], const double step[3],
+                 unsigned block_shift = 2);
+    /// Set the field at a grid node (internal units). Only allowed for maps not loaded from file
+    void setNode(unsigned i, unsigned j, unsigned k, const double* value);
+    /// Load the field map from a binary file. The node values are memory mapped
+    void load(const std::string& file_name);
+    /// Save the field map to a binary file
+    void save(const std::string& file_name)  const;
+    /// Call to access the field components at a given location
+    virtual void fieldComponents(const double* pos, double* field);
+    /// Declare the box outside of which the field vanishes
+    virtual bool boundingBox(double lower_edge[3], double upper_edge[3]) const;
+  };
+
 }         /* End namespace dd4hep             */
 #endif // DD4HEP_FIELDTYPES_H
@@ -80,6 +80,13 @@ namespace dd4hep {
        *  field vector in order to allow for superposition of the fields.
        */
       virtual void fieldComponents(const double* pos, double* field) = 0;
+
+      /** Overwrite to declare the box outside of which the field vanishes.
+       *  The box may be larger than the true support of the field: it is only used
+       *  to skip components in overlayed fields. Default: the field is not bounded.
+       *  @return true if the field vanishes outside the box [lower, upper]
+       */
+      virtual bool boundingBox(double lower[3], double upper[3]) const;
     };
 
     /// Default constructor
@@ -153,10 +160,22 @@ namespace dd4hep {
      */
     class Object: public CartesianField::TypedObject {
     public:
+      /// Bounding box of a field component (see CartesianField::Object::boundingBox)
+      struct Bounds  {
+        double lower[3];
+        double upper[3];
+        bool   bounded;
+      };
       CartesianField electric;
       CartesianField magnetic;
       std::vector<CartesianField> electric_components;
       std::vector<CartesianField> magnetic_components;
+      /// Bounding boxes of the electric components
+      std::vector<Bounds> electric_bounds;  //! Transient
+      /// Bounding boxes of the magnetic components
+      std::vector<Bounds> magnetic_bounds;  //! Transient
+      /// Unique tag of the component setup. Changes invalidate the per-thread lookup caches
+      unsigned long generation { 0 };       //! Transient
       /// Field extensions
       Properties properties;
 
@@ -263,6 +282,13 @@ namespace dd4hep {
       return { field[0], field[1], field[2] };
     }
 
+    /// Returns the 3 magnetic field components (x, y, z) using the per-thread lookup cache.
+    /** The set of components contributing at the last point is remembered together with
+     *  the largest box around it, which is not crossed by any component bounding box.
+     *  Points inside this box reuse the component set without testing the bounding boxes.
+     */
+    void cachedMagneticField(const double* pos, double* field) const;
+
     /// Returns the 3 electric (val[0]-val[2]) and magnetic field components (val[3]-val[5]).
     void electromagneticField(const Position& pos, double* field) const;
 
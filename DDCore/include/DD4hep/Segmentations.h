@@ -80,6 +80,8 @@ namespace dd4hep {
     void setDecoder(const BitFieldCoder* decoder) const;
     /// determine the local position based on the cell ID
     Position position(const CellID& cellID) const;
+    /// determine the local positions of an array of cell IDs
+    void position(const CellID* cells, std::size_t count, Position* positions) const;
     /// determine the cell ID based on the local position
     CellID cellID(const Position& localPosition, const Position& globalPosition, const VolumeID& volumeID) const;
     /// Determine the volume ID from the full cell ID by removing all local fields
@@ -122,6 +122,12 @@ namespace dd4hep {
    *  subdetectors must have the same length to ensure the uniqueness of the
    *  placement keys.
    *
+   *  Once the geometry is closed, the lookup tables of the top level manager
+   *  and all subdetector sections may be 'frozen': all contexts are compacted
+   *  into one contiguous array sorted by the masked VolumeID, which is then
+   *  searched by bisection instead of walking the std::map trees.
+   *  Any later registration of a placement invalidates the frozen table.
+   *
    *  By default the volume manager in TREE mode (-> 1)) is attached to the
    *  Detector instance and also managed by this instance.
    *  If you wish to create instances yourself, you must ensure that the
@@ -140,6 +146,7 @@ namespace dd4hep {
       TREE = 1 << 1,   // Build 1 level DetElement hierarchy while populating
       ONE  = 1 << 2,   // Populate all daughter volumes into one big lookup-container
       // This flag may be in parallel with 'TREE'
+      FREEZE = 1 << 3, // Compact all placements into a flat lookup table after populating
       LAST
     };
 
@@ -197,6 +204,13 @@ namespace dd4hep {
     /// Register physical volume with the manager and pre-computed volume id
     bool adoptPlacement(VolumeID volume_id, VolumeManagerContext* context);
 
+    /// Compact all registered placements into a flat lookup table. Returns the number of entries
+    std::size_t freeze();
+    /// Drop the flat lookup table and fall back to the tree lookup
+    void unfreeze();
+    /// Check if the flat lookup table is in use
+    bool isFrozen() const;
+
     /** This set of functions is required when reading/analyzing
      *  already created hits which have a VolumeID attached.
      */
@@ -64,6 +64,22 @@ namespace dd4hep {
      */
     class VolumeManagerObject: public NamedObject {
     public:
+      /// Entry of the flat lookup table: (masked volume identifier, context)
+      typedef std::pair<VolumeID, VolumeManagerContext*> FlatEntry;
+      /// Section of the flat lookup table. One section per volume manager instance
+      struct FlatSection  {
+        /// Identifier mask of the section (detMask of the originating manager)
+        VolumeID    mask    = ~0x0ULL;
+        /// Bit mask of the system field (0 if the section has no system field)
+        VolumeID    sysMask = 0;
+        /// Expected bits of the system field within sysMask
+        VolumeID    sysBits = 0;
+        /// First entry of the section in the flat table
+        std::size_t begin   = 0;
+        /// One past the last entry of the section in the flat table
+        std::size_t end     = 0;
+      };
+
       /// The container of subdetector elements
       std::map<DetElement, VolumeManager>       subdetectors;
       /// The volume managers for the individual subdetector elements
@@ -84,6 +100,12 @@ namespace dd4hep {
       VolumeID               detMask = ~0x0ULL;
       /// Population flags
       int                    flags   = VolumeManager::NONE;
+      /// Frozen lookup: all contexts sorted by masked identifier in contiguous memory
+      std::vector<FlatEntry>   flatVolumes;   //! Transient
+      /// Frozen lookup: sections of the flat table in the search order of the tree
+      std::vector<FlatSection> flatSections;  //! Transient
+      /// Flag to indicate that the flat lookup table is valid
+      bool                   frozen  = false; //! Transient
     public:
       /// Default constructor
       VolumeManagerObject() = default;
@@ -99,6 +121,12 @@ namespace dd4hep {
       VolumeManagerObject& operator=(const VolumeManagerObject& copy) = delete;
       /// Search the locally cached volumes for a matching ID
       VolumeManagerContext* search(const VolumeID& id) const;
+      /// Search the flat lookup table for a matching ID (only valid if frozen)
+      VolumeManagerContext* searchFlat(const VolumeID& id) const;
+      /// Build the flat lookup table from this manager and all subdetector managers
+      std::size_t freeze();
+      /// Invalidate the flat lookup table
+      void unfreeze();
       /// Update callback when alignment has changed (called only for subdetectors....)
       void update(unsigned long tags, DetElement& det, void* param);
     };
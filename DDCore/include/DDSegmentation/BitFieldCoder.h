@@ -240,6 +240,139 @@ namespace dd4hep {
     };
 
 
+    /// Precompiled, branch-free access to a selection of fields of a BitFieldCoder
+    /** The field names are resolved once at construction into mask/shift pairs.
+     *  Accessing a field is then a mask, a shift and a branch-free sign extension:
+     *  no name lookup and no bounds check. The bulk calls decode/encode whole arrays
+     *  of cellIDs to/from structure-of-arrays field columns in vectorizable loops.
+     *  Note: encoding does not check the value range.
+     *
+     *  Example:<br>
+     *    BitFieldDecoder dec( coder, {"system","layer","module","x","y"} ) ; <br>
+     *    FieldID layer = dec.get( cell, 1 ) ;                      <br>
+     *    std::vector<FieldID> x( n ) ;                             <br>
+     *    dec.decode( cells, n, 3, x.data() ) ;                     <br>
+     */
+    class BitFieldDecoder  {
+    public:
+      /// Compiled representation of one field
+      struct Field  {
+        /// Mask of the field bits
+        CellID   mask   {};
+        /// Offset of the field (least significant bit)
+        unsigned offset {};
+        /// Sign bit of the shifted field value if the field is signed, else 0
+        CellID   sign   {};
+
+        /// Extract the field value from a 64 bit bitfield
+        FieldID value(CellID bitfield) const  {
+          return FieldID( ( ( bitfield & mask ) >> offset ) ^ sign ) - FieldID( sign ) ;
+        }
+        /// Encode the field value into the bits of the field (no range check)
+        CellID encode(FieldID val) const  {
+          return ( CellID( val ) << offset ) & mask ;
+        }
+        /// Assign the given value to the bitfield (no range check)
+        void set(CellID& bitfield, FieldID val) const  {
+          bitfield = ( bitfield & ~mask ) | encode( val ) ;
+        }
+      };
+
+    public:
+      /// Default constructor
+      BitFieldDecoder() = default ;
+      /// Copy constructor
+      BitFieldDecoder(const BitFieldDecoder&) = default ;
+      /// Move constructor
+      BitFieldDecoder(BitFieldDecoder&&) = default ;
+      /// Compile all fields of the coder in the order of the coder
+      BitFieldDecoder(const BitFieldCoder& coder) ;
+      /// Compile the named fields of the coder in the given order. Throws if a field is unknown
+      BitFieldDecoder(const BitFieldCoder& coder, const std::vector<std::string>& names) ;
+      /// Default destructor
+      ~BitFieldDecoder() = default ;
+
+      /// Assignment operator
+      BitFieldDecoder& operator=(const BitFieldDecoder&) = default ;
+
+      /// Number of compiled fields
+      size_t size() const  {  return _fields.size() ;  }
+
+      /// Access to the compiled field by index (no bounds check)
+      const Field& field(size_t idx) const  {  return _fields[ idx ] ;  }
+
+      /// Get value of the compiled field specified by index (no bounds check)
+      FieldID get(CellID bitfield, size_t idx) const  {
+        return _fields[ idx ].value( bitfield ) ;
+      }
+
+      /// Set value of the compiled field specified by index (no bounds and no range check)
+      void set(CellID& bitfield, size_t idx, FieldID value) const  {
+        _fields[ idx ].set( bitfield, value ) ;
+      }
+
+      /// Decode one field of count cellIDs into the column: column[i] = value( cells[i] )
+      void decode(const CellID* cells, size_t count, size_t idx, FieldID* column) const ;
+
+      /// Decode all compiled fields of count cellIDs: columns[f][i] = value of field f of cells[i]
+      void decode(const CellID* cells, size_t count, FieldID* const* columns) const ;
+
+      /// Encode all compiled fields from the columns into count cellIDs. Other bits are left untouched
+      void encode(const FieldID* const* columns, size_t count, CellID* cells) const ;
+
+    protected:
+      /// Compile one field element
+      static Field compile(const BitFieldElement& element) ;
+
+    protected:
+      std::vector<Field> _fields{} ;
+    };
+
+
+    /// Compile time specification of a bit field for fixed cellID layouts
+    /** Mask, shift and sign extension are constant expressions, hence the
+     *  accessors inline into a few instructions.
+     *
+     *  Example:<br>
+     *    typedef BitFieldSpec< 5, 9>  Layer ;   // layer:5:9   <br>
+     *    typedef BitFieldSpec<32,-16> X ;       // x:32:-16    <br>
+     *    FieldID layer = Layer::value( cell ) ; <br>
+     *    assert( X::matches( coder["x"] ) ) ;   <br>
+     */
+    template <unsigned OFFSET, int SIGNED_WIDTH> struct BitFieldSpec  {
+      /// The field's offset
+      static constexpr unsigned offset   = OFFSET ;
+      /// The field's width
+      static constexpr unsigned width    = SIGNED_WIDTH < 0 ? unsigned( -SIGNED_WIDTH ) : unsigned( SIGNED_WIDTH ) ;
+      /// True if field is interpreted as signed
+      static constexpr bool     isSigned = SIGNED_WIDTH < 0 ;
+
+      static_assert( width > 0 && width < 64 && offset + width <= 64, "BitFieldSpec: field out of range" ) ;
+
+      /// The field's mask
+      static constexpr CellID   mask     = ( ( CellID( 1 ) << width ) - 1 ) << offset ;
+      /// Sign bit of the shifted field value if the field is signed, else 0
+      static constexpr CellID   sign     = isSigned ? CellID( 1 ) << ( width - 1 ) : CellID( 0 ) ;
+
+      /// Extract the field value from a 64 bit bitfield
+      static constexpr FieldID value(CellID bitfield)  {
+        return FieldID( ( ( bitfield & mask ) >> offset ) ^ sign ) - FieldID( sign ) ;
+      }
+      /// Encode the field value into the bits of the field (no range check)
+      static constexpr CellID encode(FieldID val)  {
+        return ( CellID( val ) << offset ) & mask ;
+      }
+      /// Assign the given value to the bitfield (no range check)
+      static void set(CellID& bitfield, FieldID val)  {
+        bitfield = ( bitfield & ~mask ) | encode( val ) ;
+      }
+      /// Check if the specification matches a field element of a runtime coder
+      static bool matches(const BitFieldElement& element)  {
+        return element.offset() == offset && element.width() == width && element.isSigned() == isSigned ;
+      }
+    };
+
+
     /// Helper class  for string tokenization.
     /**  Usage:<br>
      *    std::vector<std::string> tokens ; <br>
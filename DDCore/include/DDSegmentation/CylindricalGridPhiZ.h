@@ -37,6 +37,11 @@ namespace dd4hep {
       virtual Vector3D position(const CellID& cellID) const;
       /// determine the cell ID based on the position
       virtual CellID cellID(const Vector3D& localPosition, const Vector3D& globalPosition, const VolumeID& volumeID) const;
+      /// determine the positions of an array of cell IDs
+      virtual void positions(const CellID* cells, std::size_t count, Vector3D* local) const;
+      /// determine the cell IDs of an array of positions
+      virtual void cellIDs(const Vector3D* local, const Vector3D* global, const VolumeID* volIDs,
+                           std::size_t count, CellID* cells) const;
       /// access the grid size in phi
       double gridSizePhi() const {
         return _gridSizePhi;
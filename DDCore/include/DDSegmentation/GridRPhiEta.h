@@ -51,6 +51,21 @@ namespace dd4hep {
        *   return Cell ID.
        */
       virtual CellID cellID(const Vector3D& aLocalPosition, const Vector3D& aGlobalPosition, const VolumeID& aVolumeID) const;
+      /**  Determine the global positions of an array of cell IDs.
+       *   @param[in] aCellIDs array of cell IDs.
+       *   @param[in] aCount number of cells.
+       *   @param[out] aPositions array of positions.
+       */
+      virtual void positions(const CellID* aCellIDs, std::size_t aCount, Vector3D* aPositions) const;
+      /**  Determine the cell IDs of an array of positions.
+       *   @param[in] aLocalPositions (not used).
+       *   @param[in] aGlobalPositions positions in the global coordinates.
+       *   @param[in] aVolumeIDs IDs of the volumes.
+       *   @param[in] aCount number of positions.
+       *   @param[out] aCellIDs array of cell IDs.
+       */
+      virtual void cellIDs(const Vector3D* aLocalPositions, const Vector3D* aGlobalPositions, const VolumeID* aVolumeIDs,
+                           std::size_t aCount, CellID* aCellIDs) const;
       /**  Determine the radius based on the cell ID.
        *   @param[in] aCellId ID of a cell.
        *   return Radius.
@@ -39,6 +39,11 @@ namespace dd4hep {
       virtual Vector3D position(const CellID& cellID) const;
       /// determine the cell ID based on the position
       virtual CellID cellID(const Vector3D& localPosition, const Vector3D& globalPosition, const VolumeID& volumeID) const;
+      /// determine the positions of an array of cell IDs
+      virtual void positions(const CellID* cells, std::size_t count, Vector3D* local) const;
+      /// determine the cell IDs of an array of positions
+      virtual void cellIDs(const Vector3D* local, const Vector3D* global, const VolumeID* volIDs,
+                           std::size_t count, CellID* cells) const;
       // access the stagger mode: 0=no stagger; 1=stagger cycling through 3 offsets
       int stagger() const {
 	return _stagger;
@@ -109,6 +114,11 @@ namespace dd4hep {
       virtual std::vector<double> cellDimensions(const CellID& cellID) const;
 
     protected:
+      /// determine the position from the decoded cell indices and the stagger layer
+      Vector3D positionFromBins(FieldID ix, FieldID iy, int layer) const;
+      /// determine the cell indices from the local position and the stagger layer
+      void binsFromPosition(const Vector3D& localPosition, int layer, int& ix, int& iy) const;
+
       /// the stagger mode:  0=off ; 1=cycle through 3 different offsets (H3)
       //  2=cycle through 4 differnt offsets (H4)
       int _stagger;
@@ -25,8 +25,10 @@
 
 #include <map>
 #include <set>
+#include <cmath>
 #include <string>
 #include <vector>
+#include <typeinfo>
 
 namespace dd4hep {
   namespace DDSegmentation {
@@ -83,6 +85,19 @@ namespace dd4hep {
       /// Determine the cell ID based on the position
       virtual CellID cellID(const Vector3D& localPosition, const Vector3D& globalPosition,
                             const VolumeID& volumeID) const = 0;
+      /// Determine the local positions of an array of cell IDs: local[i] = position(cells[i])
+      /** Batch version of position(): amortizes the virtual dispatch and the field lookup.
+       *  The default implementation loops over the single cell call. Specialized
+       *  implementations use it as well for sub-classes overriding only position().
+       */
+      virtual void positions(const CellID* cells, std::size_t count, Vector3D* local) const;
+      /// Determine the cell IDs of an array of positions: cells[i] = cellID(local[i], global[i], volIDs[i])
+      /** Batch version of cellID(): amortizes the virtual dispatch and the field lookup.
+       *  The default implementation loops over the single cell call. Specialized
+       *  implementations use it as well for sub-classes overriding only cellID().
+       */
+      virtual void cellIDs(const Vector3D* local, const Vector3D* global, const VolumeID* volIDs,
+                           std::size_t count, CellID* cells) const;
       /// Determine the volume ID from the full cell ID by removing all local fields
       virtual VolumeID volumeID(const CellID& cellID) const;
       /// Calculates the neighbours of the given cell ID and adds them to the list of neighbours
@@ -155,6 +170,18 @@ namespace dd4hep {
       static double binToPosition(FieldID bin, double cellSize, double offset = 0.);
       /// Helper method to convert a 1D position to a cell ID
       static int positionToBin(double position, double cellSize, double offset = 0.);
+      /// Helper method to convert a 1D position to a cell ID without cell size check (inlined for batch loops)
+      static int positionToBinFast(double position, double cellSize, double offset = 0.)  {
+        return int(std::floor((position + 0.5 * cellSize - offset) / cellSize));
+      }
+      /// Helper method to check the cell size once before batch conversions with positionToBinFast
+      static void checkCellSize(double cellSize);
+      /// Check if the object is of exactly this type and not a sub-class
+      /** Batch kernels fall back to the single cell calls for sub-classes, which may override them.
+       */
+      bool isExactType(const std::type_info& type) const  {
+        return typeid(*this) == type;
+      }
 
       /// Helper method to convert a bin number to a 1D position given a vector of binBoundaries
       static double binToPosition(FieldID bin, std::vector<double> const& cellBoundaries, double offset = 0.);
@@ -12,8 +12,22 @@
 //==========================================================================
 
 #include <DD4hep/FieldTypes.h>
+#include <DD4hep/Printout.h>
+#include <DD4hep/DD4hepUnits.h>
 #include <DD4hep/detail/Handle.inl>
+
+// C/C++ include files
 #include <cmath>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <algorithm>
+
+// POSIX include files
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 using namespace dd4hep;
 
@@ -36,6 +50,7 @@ DD4HEP_INSTANTIATE_HANDLE(ConstantField);
 DD4HEP_INSTANTIATE_HANDLE(SolenoidField);
 DD4HEP_INSTANTIATE_HANDLE(DipoleField);
 DD4HEP_INSTANTIATE_HANDLE(MultipoleField);
+DD4HEP_INSTANTIATE_HANDLE(FieldMap);
 
 /// Compute  the field components at a given location and add to given field
 void ConstantField::fieldComponents(const double* /* pos */, double* field) {
@@ -64,6 +79,16 @@ void SolenoidField::fieldComponents(const double* pos, double* field) {
   }
 }
 
+/// Declare the box outside of which the field vanishes
+bool SolenoidField::boundingBox(double lower[3], double upper[3]) const   {
+  double r = std::max(innerRadius, outerRadius);
+  lower[0] = lower[1] = -r;
+  upper[0] = upper[1] =  r;
+  lower[2] = minZ;
+  upper[2] = maxZ;
+  return true;
+}
+
 /// Initializing constructor
 DipoleField::DipoleField() : zmax(INFINITY), zmin(-INFINITY), rmax(INFINITY) {
   field_type = CartesianField::MAGNETIC;
@@ -90,6 +115,15 @@ void DipoleField::fieldComponents(const double* pos, double* field) {
   }
 }
 
+/// Declare the box outside of which the field vanishes
+bool DipoleField::boundingBox(double lower[3], double upper[3]) const   {
+  lower[0] = lower[1] = -rmax;
+  upper[0] = upper[1] =  rmax;
+  lower[2] = zmin;
+  upper[2] = zmax;
+  return true;
+}
+
 namespace   {
   constexpr static unsigned char FIELD_INITIALIZED   = 1<<0;
   constexpr static unsigned char FIELD_IDENTITY      = 1<<1;
@@ -166,3 +200,231 @@ void MultipoleField::fieldComponents(const double* pos, double* field) {
     field[2] += f.Z();
   }
 }
+
+/// Initializing constructor
+FieldMap::FieldMap()   {
+  field_type = CartesianField::MAGNETIC;
+}
+
+/// Default destructor
+FieldMap::~FieldMap()   {
+  unmap();
+}
+
+/// Release the memory mapped file if any
+void FieldMap::unmap()   {
+  if ( mapping )  {
+    ::munmap(mapping, mapSize);
+    mapping = nullptr;
+    mapSize = 0;
+  }
+  values = storage.empty() ? nullptr : storage.data();
+}
+
+/// Number of stored values including the padding of the bricks
+std::size_t FieldMap::numValues() const   {
+  std::size_t num = header.components;
+  for( int i = 0; i < 3; ++i )  {
+    std::size_t block = std::size_t(1) << (i < 2 || header.grid == GRID_XYZ ? header.blockShift : 0);
+    num *= ((header.nodes[i] + block - 1) / block) * block;
+  }
+  return num;
+}
+
+/// Derive the lookup constants from the header
+void FieldMap::prepare()   {
+  int dim = header.grid == GRID_RZ ? 2 : 3;
+  if ( header.grid != GRID_XYZ && header.grid != GRID_RZ )
+    except("FieldMap","+++ Invalid grid type: %u", header.grid);
+  if ( header.components != unsigned(dim == 3 ? 3 : 2) )
+    except("FieldMap","+++ Invalid number of field components: %u", header.components);
+  if ( header.blockShift > 8 )
+    except("FieldMap","+++ Invalid brick size: 2^%u nodes", header.blockShift);
+  for( int i = 0; i < 3; ++i )  {
+    if ( i < dim )  {
+      if ( header.nodes[i] < 2 || !(header.step[i] > 0e0) )
+        except("FieldMap","+++ Invalid grid axis %d: %u nodes with step %g mm",
+               i, header.nodes[i], header.step[i]);
+      shift[i]   = header.blockShift;
+      lower[i]   = header.minimum[i] * dd4hep::mm;
+      inverse[i] = 1e0 / (header.step[i] * dd4hep::mm);
+    }
+    else  {
+      header.nodes[i] = 1;
+      shift[i]   = 0;
+      lower[i]   = 0e0;
+      inverse[i] = 0e0;
+    }
+    mask[i]   = (1U << shift[i]) - 1;
+    blocks[i] = (header.nodes[i] + mask[i]) >> shift[i];
+    last[i]   = double(header.nodes[i] - 1);
+  }
+}
+
+/// Define the grid (internal units) and allocate the node values (initialized to zero)
+void FieldMap::setGrid(GridType type, const unsigned nodes[3], const double minimum[3], const double step[3],
+                       unsigned block_shift)   {
+  unmap();
+  header = Header();
+  header.grid       = type;
+  header.components = type == GRID_RZ ? 2 : 3;
+  header.blockShift = block_shift;
+  for( int i = 0; i < 3; ++i )  {
+    header.nodes[i]   = nodes[i];
+    header.minimum[i] = minimum[i] / dd4hep::mm;
+    header.step[i]    = step[i] / dd4hep::mm;
+  }
+  prepare();
+  storage.assign(numValues(), 0e0);
+  values = storage.data();
+}
+
+/// Declare the box outside of which the field vanishes
+bool FieldMap::boundingBox(double lower_edge[3], double upper_edge[3]) const   {
+  // Widen the box by a small fraction of a cell to be robust against rounding
+  constexpr static double margin = 1e-6;
+  if ( !values )
+    return false;
+  if ( header.grid == GRID_XYZ )  {
+    for( int i = 0; i < 3; ++i )  {
+      lower_edge[i] = lower[i] - margin / inverse[i];
+      upper_edge[i] = lower[i] + (last[i] + margin) / inverse[i];
+    }
+    return true;
+  }
+  double r = lower[0] + (last[0] + margin) / inverse[0];
+  lower_edge[0] = lower_edge[1] = -r;
+  upper_edge[0] = upper_edge[1] =  r;
+  lower_edge[2] = lower[1] - margin / inverse[1];
+  upper_edge[2] = lower[1] + (last[1] + margin) / inverse[1];
+  return true;
+}
+
+/// Set the field at a grid node (internal units). Only allowed for maps not loaded from file
+void FieldMap::setNode(unsigned i, unsigned j, unsigned k, const double* value)   {
+  if ( mapping || storage.empty() )
+    except("FieldMap","+++ The node values of a memory mapped or undefined field map cannot be changed.");
+  if ( i >= header.nodes[0] || j >= header.nodes[1] || k >= header.nodes[2] )
+    except("FieldMap","+++ Node (%u,%u,%u) is outside the grid.", i, j, k);
+  float* node = storage.data() + nodeIndex(i, j, k);
+  for( unsigned c = 0; c < header.components; ++c )
+    node[c] = float(value[c] / dd4hep::tesla);
+}
+
+/// Load the field map from a binary file. The node values are memory mapped
+void FieldMap::load(const std::string& file_name)   {
+  struct stat buff;
+  int fd = ::open(file_name.c_str(), O_RDONLY);
+  if ( fd < 0 )
+    except("FieldMap","+++ Failed to open field map file %s: %s", file_name.c_str(), std::strerror(errno));
+  if ( ::fstat(fd, &buff) != 0 || std::size_t(buff.st_size) < sizeof(Header) )  {
+    ::close(fd);
+    except("FieldMap","+++ The file %s is not a valid field map.", file_name.c_str());
+  }
+  void* mem = ::mmap(nullptr, buff.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if ( mem == MAP_FAILED )
+    except("FieldMap","+++ Failed to map field map file %s: %s", file_name.c_str(), std::strerror(errno));
+
+  Header hdr;
+  std::memcpy(&hdr, mem, sizeof(Header));
+  if ( std::memcmp(hdr.magic, Header().magic, sizeof(hdr.magic)) != 0 || hdr.version != 1 )  {
+    ::munmap(mem, buff.st_size);
+    except("FieldMap","+++ The file %s is not a valid field map.", file_name.c_str());
+  }
+  unmap();
+  storage.clear();
+  header = hdr;
+  try  {
+    prepare();
+  }
+  catch(...)  {
+    ::munmap(mem, buff.st_size);
+    throw;
+  }
+  if ( std::size_t(buff.st_size) < sizeof(Header) + numValues()*sizeof(float) )  {
+    ::munmap(mem, buff.st_size);
+    except("FieldMap","+++ The field map file %s is truncated.", file_name.c_str());
+  }
+  mapping = mem;
+  mapSize = buff.st_size;
+  values  = reinterpret_cast<const float*>(static_cast<const char*>(mem) + sizeof(Header));
+  ::madvise(mem, mapSize, MADV_WILLNEED);
+  printout(INFO,"FieldMap","+++ Mapped %s field map %s: %u x %u x %u nodes.",
+           header.grid == GRID_RZ ? "RZ" : "XYZ", file_name.c_str(),
+           header.nodes[0], header.nodes[1], header.nodes[2]);
+}
+
+/// Save the field map to a binary file
+void FieldMap::save(const std::string& file_name)  const   {
+  if ( !values )
+    except("FieldMap","+++ Cannot save an undefined field map to %s.", file_name.c_str());
+  std::ofstream out(file_name, std::ios::binary|std::ios::trunc);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  out.write(reinterpret_cast<const char*>(values), numValues()*sizeof(float));
+  if ( !out.good() )
+    except("FieldMap","+++ Failed to write field map file %s.", file_name.c_str());
+}
+
+/// Compute  the field components at a given location and add to given field
+void FieldMap::fieldComponents(const double* pos, double* field) {
+  if ( !values ) return;
+  const double fscale = scale * dd4hep::tesla;
+  if ( header.grid == GRID_XYZ )  {
+    const double u = (pos[0] - lower[0]) * inverse[0];
+    const double v = (pos[1] - lower[1]) * inverse[1];
+    const double w = (pos[2] - lower[2]) * inverse[2];
+    // Negated comparisons also reject NaN coordinates
+    if ( !(u >= 0e0 && u <= last[0] && v >= 0e0 && v <= last[1] && w >= 0e0 && w <= last[2]) )
+      return;
+    const unsigned i = std::min(unsigned(u), header.nodes[0] - 2);
+    const unsigned j = std::min(unsigned(v), header.nodes[1] - 2);
+    const unsigned k = std::min(unsigned(w), header.nodes[2] - 2);
+    const double tx = u - i, ty = v - j, tz = w - k;
+    const double sx = 1e0 - tx, sy = 1e0 - ty, sz = 1e0 - tz;
+    const std::size_t idx[8] = {
+      nodeIndex(i, j,   k  ), nodeIndex(i+1, j,   k  ),
+      nodeIndex(i, j+1, k  ), nodeIndex(i+1, j+1, k  ),
+      nodeIndex(i, j,   k+1), nodeIndex(i+1, j,   k+1),
+      nodeIndex(i, j+1, k+1), nodeIndex(i+1, j+1, k+1) };
+    const double wgt[8] = {
+      sx*sy*sz, tx*sy*sz, sx*ty*sz, tx*ty*sz,
+      sx*sy*tz, tx*sy*tz, sx*ty*tz, tx*ty*tz };
+    double b[3] = { 0e0, 0e0, 0e0 };
+    for( int n = 0; n < 8; ++n )  {
+      const float* node = values + idx[n];
+      b[0] += wgt[n] * node[0];
+      b[1] += wgt[n] * node[1];
+      b[2] += wgt[n] * node[2];
+    }
+    field[0] += b[0] * fscale;
+    field[1] += b[1] * fscale;
+    field[2] += b[2] * fscale;
+  }
+  else  {
+    const double r = std::sqrt(pos[0]*pos[0] + pos[1]*pos[1]);
+    const double u = (r      - lower[0]) * inverse[0];
+    const double v = (pos[2] - lower[1]) * inverse[1];
+    if ( !(u >= 0e0 && u <= last[0] && v >= 0e0 && v <= last[1]) )
+      return;
+    const unsigned i = std::min(unsigned(u), header.nodes[0] - 2);
+    const unsigned j = std::min(unsigned(v), header.nodes[1] - 2);
+    const double tr = u - i, tz = v - j;
+    const double sr = 1e0 - tr, sz = 1e0 - tz;
+    const std::size_t idx[4] = {
+      nodeIndex(i, j, 0), nodeIndex(i+1, j, 0), nodeIndex(i, j+1, 0), nodeIndex(i+1, j+1, 0) };
+    const double wgt[4] = { sr*sz, tr*sz, sr*tz, tr*tz };
+    double b[2] = { 0e0, 0e0 };
+    for( int n = 0; n < 4; ++n )  {
+      const float* node = values + idx[n];
+      b[0] += wgt[n] * node[0];
+      b[1] += wgt[n] * node[1];
+    }
+    if ( r > 0e0 )  {
+      const double br = b[0] * fscale / r;
+      field[0] += br * pos[0];
+      field[1] += br * pos[1];
+    }
+    field[2] += b[1] * fscale;
+  }
+}
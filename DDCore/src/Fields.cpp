@@ -16,6 +16,11 @@
 #include <DD4hep/InstanceCount.h>
 #include <DD4hep/detail/Handle.inl>
 
+// C/C++ include files
+#include <atomic>
+#include <limits>
+#include <algorithm>
+
 using namespace dd4hep;
 
 typedef CartesianField::Object CartesianFieldObject;
@@ -25,8 +30,77 @@ typedef OverlayedField::Object OverlayedFieldObject;
 DD4HEP_INSTANTIATE_HANDLE(OverlayedFieldObject);
 
 namespace {
-  void calculate_combined_field(std::vector<CartesianField>& v, const Position& pos, double* field) {
-    for (const auto& i : v ) i.value(pos, field);
+
+  typedef OverlayedField::Object::Bounds FieldBounds;
+
+  /// Source of unique tags for the component setups of overlayed fields
+  std::atomic<unsigned long> s_fieldGeneration { 0 };
+
+  /// Per-thread cache of the magnetic field components contributing in a region
+  struct FieldCache  {
+    const OverlayedField::Object* owner { nullptr };
+    unsigned long generation { 0 };
+    /// Open box around the last point not crossed by any component bounding box
+    double lower[3] { 0e0, 0e0, 0e0 };
+    double upper[3] { 0e0, 0e0, 0e0 };
+    /// Components contributing inside the box
+    std::vector<CartesianField::Object*> active;
+  };
+
+  inline bool inside(const FieldBounds& b, const double* pos)  {
+    return pos[0] >= b.lower[0] && pos[0] <= b.upper[0] &&
+      pos[1] >= b.lower[1] && pos[1] <= b.upper[1] &&
+      pos[2] >= b.lower[2] && pos[2] <= b.upper[2];
+  }
+
+  inline bool contributes(const std::vector<FieldBounds>& b, std::size_t i, const double* pos)  {
+    // Bounds are transient: fields read from file without them are treated as unbounded
+    return i >= b.size() || !b[i].bounded || inside(b[i], pos);
+  }
+
+  FieldBounds field_bounds(const CartesianField& field)  {
+    FieldBounds b;
+    b.bounded = field.data<CartesianField::Object>()->boundingBox(b.lower, b.upper);
+    return b;
+  }
+
+  void calculate_combined_field(const std::vector<CartesianField>& v,
+                                const std::vector<FieldBounds>& b,
+                                const Position& pos, double* field) {
+    double p[3] = { pos.X(), pos.Y(), pos.Z() };
+    for ( std::size_t i = 0; i < v.size(); ++i )  {
+      if ( contributes(b, i, p) )
+        v[i].data<CartesianField::Object>()->fieldComponents(p, field);
+    }
+  }
+
+  /// Collect the components contributing at pos and the region where this set does not change
+  void update_cache(FieldCache& cache, const OverlayedField::Object* obj, const double* pos)  {
+    const auto& v = obj->magnetic_components;
+    const auto& b = obj->magnetic_bounds;
+    cache.owner      = obj;
+    cache.generation = obj->generation;
+    cache.active.clear();
+    for ( int k = 0; k < 3; ++k )  {
+      cache.lower[k] = -std::numeric_limits<double>::infinity();
+      cache.upper[k] =  std::numeric_limits<double>::infinity();
+    }
+    for ( std::size_t i = 0; i < v.size(); ++i )  {
+      if ( contributes(b, i, pos) )
+        cache.active.emplace_back(v[i].data<CartesianField::Object>());
+      if ( i >= b.size() || !b[i].bounded )
+        continue;
+      for ( int k = 0; k < 3; ++k )  {
+        for ( double plane : { b[i].lower[k], b[i].upper[k] } )  {
+          if ( plane < pos[k] )
+            cache.lower[k] = std::max(cache.lower[k], plane);
+          else if ( plane > pos[k] )
+            cache.upper[k] = std::min(cache.upper[k], plane);
+          else   // Point on a boundary: empty region, never reused
+            cache.lower[k] = cache.upper[k] = pos[k];
+        }
+      }
+    }
   }
 }
 
@@ -42,6 +116,11 @@ CartesianField::Object::~Object() {
   InstanceCount::decrement(this);
 }
 
+/// Declare the box outside of which the field vanishes. Default: not bounded
+bool CartesianField::Object::boundingBox(double /* lower */[3], double /* upper */[3]) const   {
+  return false;
+}
+
 /// Access the field type (string)
 const char* CartesianField::type() const {
   return m_element->GetTitle();
@@ -117,16 +196,21 @@ void OverlayedField::add(CartesianField field) {
       if (isEle) {
         std::vector < CartesianField > &v = o->electric_components;
         v.emplace_back(field);
+        o->electric_bounds.resize(v.size()-1, FieldBounds { {0e0,0e0,0e0}, {0e0,0e0,0e0}, false });
+        o->electric_bounds.emplace_back(field_bounds(field));
         o->field_type |= field.ELECTRIC;
         o->electric = (v.size() == 1) ? field : CartesianField();
       }
       if (isMag) {
         std::vector < CartesianField > &v = o->magnetic_components;
         v.emplace_back(field);
+        o->magnetic_bounds.resize(v.size()-1, FieldBounds { {0e0,0e0,0e0}, {0e0,0e0,0e0}, false });
+        o->magnetic_bounds.emplace_back(field_bounds(field));
         o->field_type |= field.MAGNETIC;
         o->magnetic = (v.size() == 1) ? field : CartesianField();
       }
       if ( isMag || isEle )  {
+        o->generation = ++s_fieldGeneration;
         return;
       }
       except("OverlayedField","add: Attempt to add an unknown field type.");
@@ -145,28 +229,48 @@ void OverlayedField::magneticField(const Position& pos, double* field) const   {
     if ( f.isValid() )
       f.value(pos, field);
     else
-      calculate_combined_field(obj->magnetic_components, pos, field);
+      calculate_combined_field(obj->magnetic_components, obj->magnetic_bounds, pos, field);
     return;
   }
   except("OverlayedField","add: Attempt to add an invalid field.");
 }
 
+/// Returns the 3 magnetic field components (x, y, z) using the per-thread lookup cache.
+void OverlayedField::cachedMagneticField(const double* pos, double* field) const   {
+  static thread_local FieldCache cache;
+  const Object* obj = data<Object>();
+  field[0] = field[1] = field[2] = 0.0;
+  if ( !obj )  {
+    except("OverlayedField","magneticField: Attempt to access an invalid field.");
+  }
+  if ( cache.owner != obj || cache.generation != obj->generation ||
+       !(pos[0] > cache.lower[0] && pos[0] < cache.upper[0] &&
+         pos[1] > cache.lower[1] && pos[1] < cache.upper[1] &&
+         pos[2] > cache.lower[2] && pos[2] < cache.upper[2]) )  {
+    update_cache(cache, obj, pos);
+  }
+  for ( CartesianField::Object* f : cache.active )
+    f->fieldComponents(pos, field);
+}
+
 /// Returns the 3 electric field components (x, y, z).
 void OverlayedField::combinedElectric(const Position& pos, double* field) const {
   field[0] = field[1] = field[2] = 0.;
-  calculate_combined_field(data<Object>()->electric_components, pos, field);
+  Object* o = data<Object>();
+  calculate_combined_field(o->electric_components, o->electric_bounds, pos, field);
 }
 
 /// Returns the 3  magnetic field components (x, y, z).
 void OverlayedField::combinedMagnetic(const Position& pos, double* field) const {
   field[0] = field[1] = field[2] = 0.;
-  calculate_combined_field(data<Object>()->magnetic_components, pos, field);
+  Object* o = data<Object>();
+  calculate_combined_field(o->magnetic_components, o->magnetic_bounds, pos, field);
 }
 
 /// Returns the 3 electric (val[0]-val[2]) and magnetic field components (val[3]-val[5]).
 void OverlayedField::electromagneticField(const Position& pos, double* field) const {
   Object* o = data<Object>();
   field[0] = field[1] = field[2] = 0.;
-  calculate_combined_field(o->electric_components, pos, field);
-  calculate_combined_field(o->magnetic_components, pos, field + 3);
+  calculate_combined_field(o->electric_components, o->electric_bounds, pos, field);
+  calculate_combined_field(o->magnetic_components, o->magnetic_bounds, pos, field + 3);
 }
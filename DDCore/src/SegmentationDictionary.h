@@ -96,6 +96,8 @@ typedef dd4hep::DDSegmentation::CellID CellID;
 
 #pragma link C++ class dd4hep::DDSegmentation::BitFieldElement+;
 #pragma link C++ class dd4hep::DDSegmentation::BitFieldCoder+;
+#pragma link C++ class dd4hep::DDSegmentation::BitFieldDecoder+;
+#pragma link C++ class dd4hep::DDSegmentation::BitFieldDecoder::Field+;
 
 #endif  // __CINT__
 #endif  // __HAVE_DDSEGMENTATION__
@@ -20,6 +20,7 @@
 #include <DD4hep/detail/SegmentationsInterna.h>
 
 // C/C++ include files
+#include <vector>
 
 using namespace dd4hep;
 
@@ -68,6 +69,14 @@ Position Segmentation::position(const CellID& cell) const {
   return Position(access()->segmentation->position(cell));
 }
 
+/// determine the local positions of an array of cell IDs
+void Segmentation::position(const CellID* cells, std::size_t count, Position* positions) const {
+  std::vector<DDSegmentation::Vector3D> local(count);
+  access()->segmentation->positions(cells, count, local.data());
+  for ( std::size_t i = 0; i < count; ++i )
+    positions[i].SetCoordinates(local[i].X, local[i].Y, local[i].Z);
+}
+
 /// determine the cell ID based on the local position
 CellID Segmentation::cellID(const Position& localPosition, const Position& globalPosition, const CellID & volID) const {
   return access()->segmentation->cellID(localPosition, globalPosition, volID);
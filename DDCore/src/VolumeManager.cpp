@@ -23,6 +23,7 @@
 // C/C++ includes
 #include <set>
 #include <cmath>
+#include <algorithm>
 #include <sstream>
 #include <iomanip>
 
@@ -405,6 +406,9 @@ VolumeManager::VolumeManager(const Detector& description, const std::string& nam
     obj_ptr->flags = flags;
     p.populate(elt);
     node_count = p.numNodes();
+    if ( (flags & FREEZE) == FREEZE )  {
+      obj_ptr->freeze();
+    }
   }
   printout(INFO, "VolumeManager", " - populating volume ids - done. %ld nodes.",node_count);
 }
@@ -466,6 +470,7 @@ VolumeManager VolumeManager::addSubdetector(DetElement det, Readout ro) {
       mo.sysID   = id.second;
       mo.detMask = mo.sysID;
       o.managers[mo.sysID] = mgr;
+      if ( o.top ) o.top->unfreeze();
       det.callAtUpdate(DetElement::PLACEMENT_CHANGED|DetElement::PLACEMENT_DETECTOR,
                        &mo,&Object::update);
     }
@@ -527,6 +532,7 @@ bool VolumeManager::adoptPlacement(VolumeID sys_id, VolumeManagerContext* contex
   if ( i == o.volumes.end()) {
     o.volumes[vid] = context;
     o.detMask |= mask;
+    if ( o.top ) o.top->unfreeze();
     err << "Inserted new volume:" << std::setw(6) << std::left << o.volumes.size()
         << " Ptr:"  << (void*) pv.ptr()
         << " ["     << pv.name() << "]"
@@ -601,6 +607,32 @@ bool VolumeManager::adoptPlacement(VolumeManagerContext* context) {
   return false;
 }
 
+/// Compact all registered placements into a flat lookup table
+std::size_t VolumeManager::freeze()   {
+  if ( isValid() )  {
+    Object& o = _data();
+    if ( o.top && o.top != ptr() && (o.flags & ONE) == ONE )
+      return o.top->freeze();
+    return o.freeze();
+  }
+  except("VolumeManager","freeze: Failed to build lookup table [Invalid Manager Handle]");
+  return 0;
+}
+
+/// Drop the flat lookup table and fall back to the tree lookup
+void VolumeManager::unfreeze()   {
+  if ( isValid() )  {
+    _data().unfreeze();
+    return;
+  }
+  except("VolumeManager","unfreeze: Failed to drop lookup table [Invalid Manager Handle]");
+}
+
+/// Check if the flat lookup table is in use
+bool VolumeManager::isFrozen() const   {
+  return isValid() && _data().frozen;
+}
+
 /// Lookup the context, which belongs to a registered physical volume.
 VolumeManagerContext* VolumeManager::lookupContext(VolumeID volume_id) const {
   if (isValid()) {
@@ -612,6 +644,12 @@ VolumeManagerContext* VolumeManager::lookupContext(VolumeID volume_id) const {
       return VolumeManager(o.top).lookupContext(volume_id);
     }
     VolumeID id = volume_id;
+    /// If the lookup table is frozen, the flat table contains all entries
+    if ( o.frozen )  {
+      if ( (c = o.searchFlat(id)) != 0 )
+        return c;
+      except("VolumeManager","lookupContext: Failed to search Volume context %016llX [Unknown identifier]", (void*)volume_id);
+    }
     /// First look in our own volume cache if the entry is found.
     c = o.search(id);
     if (c)
@@ -740,3 +778,60 @@ VolumeManagerContext* VolumeManagerObject::search(const VolumeID& vol_id) const
   return (i == volumes.end()) ? 0 : (*i).second;
 }
 
+
+/// Search the flat lookup table for a matching ID (only valid if frozen)
+VolumeManagerContext* VolumeManagerObject::searchFlat(const VolumeID& vol_id) const {
+  const FlatEntry* entries = flatVolumes.data();
+  for( const auto& sec : flatSections )  {
+    if ( (vol_id & sec.sysMask) != sec.sysBits )
+      continue;
+    VolumeID key = vol_id & sec.mask;
+    const FlatEntry* first = entries + sec.begin;
+    const FlatEntry* last  = entries + sec.end;
+    const FlatEntry* i = std::lower_bound(first, last, key,
+                                          [](const FlatEntry& e, VolumeID k) { return e.first < k; });
+    if ( i != last && i->first == key )
+      return i->second;
+  }
+  return 0;
+}
+
+/// Build the flat lookup table from this manager and all subdetector managers
+std::size_t VolumeManagerObject::freeze()   {
+  auto add_section = [this](const VolumeManagerObject& o)  {
+    FlatSection sec;
+    sec.mask  = o.detMask;
+    sec.begin = flatVolumes.size();
+    if ( o.system )   {
+      sec.sysMask = o.system->mask();
+      sec.sysBits = (o.sysID << o.system->offset()) & sec.sysMask;
+    }
+    /// std::map iteration order is already sorted by identifier.
+    /// Registered identifiers satisfy (id&mask)==id, hence id&detMask==id
+    for( const auto& v : o.volumes )
+      flatVolumes.emplace_back(v.first, v.second);
+    sec.end = flatVolumes.size();
+    if ( sec.end > sec.begin ) flatSections.emplace_back(sec);
+  };
+  unfreeze();
+  std::size_t count = volumes.size();
+  for( const auto& j : subdetectors )
+    count += j.second->volumes.size();
+  flatVolumes.reserve(count);
+  /// Keep the search order of the tree walk: own volumes first, then the subdetectors
+  add_section(*this);
+  for( const auto& j : subdetectors )
+    add_section(*j.second.ptr());
+  flatVolumes.shrink_to_fit();
+  frozen = true;
+  printout(DEBUG,"VolumeManager","+++ Frozen lookup table of %s: %ld entries in %ld sections.",
+           detector.isValid() ? detector.name() : "----", flatVolumes.size(), flatSections.size());
+  return flatVolumes.size();
+}
+
+/// Invalidate the flat lookup table
+void VolumeManagerObject::unfreeze()   {
+  frozen = false;
+  flatVolumes.clear();
+  flatSections.clear();
+}
@@ -47,6 +47,7 @@
 
 // C/C++ include files
 #include <filesystem>
+#include <memory>
 #include <iostream>
 #include <climits>
 #include <set>
@@ -258,6 +259,39 @@ static Ref_t create_MultipoleField(Detector& description, xml_h e) {
 }
 DECLARE_XMLELEMENT(MultipoleMagnet,create_MultipoleField)
 
+/** Factory for tabulated field maps:
+ *
+ *  <field type="FieldMapXYZ" name="..." file="map.bin" scale="1.0"/>
+ *  <field type="FieldMapRZ"  name="..." file="map.bin"/>
+ *
+ *  The file is in the binary format of FieldMap (see DD4hep/FieldTypes.h).
+ *  Relative file names are resolved with respect to the location of the xml file.
+ */
+static Ref_t create_FieldMap(Detector& /* description */, xml_h e) {
+  xml_comp_t  c(e);
+  CartesianField obj;
+  std::string type  = c.typeStr();
+  std::string fname = c.attr<std::string>(_U(file));
+  std::error_code ec;
+  if ( fname.find("://") == std::string::npos && !std::filesystem::exists(fname, ec) )
+    fname = xml::DocumentHandler::system_path(e, fname);
+
+  std::unique_ptr<FieldMap> ptr(new FieldMap());
+  ptr->load(fname);
+  FieldMap::GridType grid = type == "FieldMapRZ" ? FieldMap::GRID_RZ : FieldMap::GRID_XYZ;
+  if ( ptr->gridType() != grid )  {
+    except("Compact","+++ Field %s: the map %s does not contain a %s grid.",
+           c.nameStr().c_str(), fname.c_str(), type.c_str());
+  }
+  if ( c.hasAttr(_U(scale)) )
+    ptr->scale = c.attr<double>(_U(scale));
+  ptr->field_type = CartesianField::MAGNETIC;
+  obj.assign(ptr.release(), c.nameStr(), type);
+  return obj;
+}
+DECLARE_XMLELEMENT(FieldMapXYZ,create_FieldMap)
+DECLARE_XMLELEMENT(FieldMapRZ,create_FieldMap)
+
 static long load_Compact(Detector& description, xml_h element) {
   Converter<Compact>converter(description);
   converter(element);
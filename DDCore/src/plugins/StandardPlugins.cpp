@@ -824,6 +824,25 @@ static long load_volmgr(Detector& description, int, char**) {
 DECLARE_APPLY(DD4hep_VolumeManager,load_volmgr)
 DECLARE_APPLY(DD4hepVolumeManager,load_volmgr)
 
+/// Basic entry point to compact the volume manager lookup into a flat table
+/**
+ *  Factory: DD4hep_VolumeManagerFreeze
+ *
+ *  Should be called once the geometry is closed and the volume manager
+ *  is populated. Registering new placements afterwards invalidates the table.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \date    17/10/2026
+ */
+static long freeze_volmgr(Detector& description, int, char**) {
+  VolumeManager mgr = VolumeManager::getVolumeManager(description);
+  std::size_t num_entries = mgr.freeze();
+  printout(INFO,"VolumeManager","+++ Volume manager lookup frozen: %ld entries.", num_entries);
+  return 1;
+}
+DECLARE_APPLY(DD4hep_VolumeManagerFreeze,freeze_volmgr)
+
 /// Basic entry point to dump a dd4hep geometry to a ROOT file
 /**
  *  Factory: DD4hep_Geometry2ROOT
@@ -0,0 +1,116 @@
+//==========================================================================
+//  AIDA Detector description implementation 
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DD4hep/Detector.h>
+#include <DD4hep/Printout.h>
+#include <DD4hep/Factories.h>
+#include <DD4hep/VolumeManager.h>
+#include <DD4hep/detail/VolumeManagerInterna.h>
+
+// C/C++ include files
+#include <chrono>
+#include <random>
+#include <vector>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+using namespace dd4hep;
+
+namespace  {
+
+  /// Benchmark of the VolumeManager context lookup: tree walk versus frozen flat table
+  /**
+   *  All registered volume identifiers are collected and looked up in random
+   *  order, first using the std::map tree walk, then using the frozen flat table.
+   *  Both lookups must return the identical context for every identifier.
+   *  The frozen state of the volume manager is restored at the end.
+   *
+   *  Test: geoPluginRun -input file:<compact.xml> -volmgr  \
+   *                     -plugin DD4hep_VolumeManagerLookupBenchmark [-iterations <number>]
+   *
+   *  @author  M.Frank
+   *  @version 1.0
+   */
+  struct VolumeManagerBenchmark  {
+    using clock_t = std::chrono::high_resolution_clock;
+    VolumeManager          manager;
+    std::vector<VolumeID>  identifiers;
+    std::size_t            iterations { 10 };
+
+    /// Initializing constructor
+    VolumeManagerBenchmark(Detector& description, int argc, char** argv)
+      : manager(VolumeManager::getVolumeManager(description))
+    {
+      for( int i = 0; i < argc && argv[i]; ++i )   {
+        if ( 0 == ::strncmp(argv[i], "-iterations", 4) && i+1 < argc )
+          iterations = std::max(1L, ::atol(argv[++i]));
+      }
+      collect(*manager.ptr());
+      for( const auto& j : manager->subdetectors )
+        collect(*j.second.ptr());
+      std::shuffle(identifiers.begin(), identifiers.end(), std::mt19937_64(12345));
+    }
+    /// Collect all registered identifiers of a manager section
+    void collect(const detail::VolumeManagerObject& o)   {
+      for( const auto& v : o.volumes )
+        identifiers.emplace_back(v.first);
+    }
+    /// Time one pass of lookups over all identifiers
+    double time_lookups(std::vector<VolumeManagerContext*>& result)  const  {
+      result.clear();
+      result.reserve(identifiers.size());
+      auto start = clock_t::now();
+      for( std::size_t n = 0; n < iterations; ++n )   {
+        for( VolumeID id : identifiers )
+          result.emplace_back(manager.lookupContext(id));
+        if ( n+1 < iterations ) result.clear();
+      }
+      std::chrono::duration<double, std::nano> ns = clock_t::now() - start;
+      return ns.count() / double(iterations * std::max(identifiers.size(), std::size_t(1)));
+    }
+    /// Execute the benchmark
+    long run()   {
+      std::vector<VolumeManagerContext*> tree, flat;
+      bool was_frozen = manager.isFrozen();
+      if ( identifiers.empty() )   {
+        printout(WARNING,"VolumeManagerBenchmark","+++ No placements registered. Nothing to benchmark.");
+        return 1;
+      }
+      manager.unfreeze();
+      double tree_ns = time_lookups(tree);
+      manager.freeze();
+      double flat_ns = time_lookups(flat);
+      if ( !was_frozen ) manager.unfreeze();
+
+      std::size_t errors = 0;
+      for( std::size_t i = 0; i < identifiers.size(); ++i )
+        errors += (tree[i] != flat[i]) ? 1 : 0;
+      printout(INFO,"VolumeManagerBenchmark","+++ %ld identifiers x %ld iterations",
+               identifiers.size(), iterations);
+      printout(INFO,"VolumeManagerBenchmark","+++ Tree   lookup: %9.2f ns/call", tree_ns);
+      printout(INFO,"VolumeManagerBenchmark","+++ Frozen lookup: %9.2f ns/call  speedup: %6.2f",
+               flat_ns, flat_ns > 0e0 ? tree_ns/flat_ns : 0e0);
+      printout(errors ? ERROR : INFO,"VolumeManagerBenchmark",
+               "+++ %ld mismatching contexts between tree and frozen lookup.", errors);
+      return errors == 0 ? 1 : 0;
+    }
+    /// Action routine to execute the benchmark
+    static long execute(Detector& description, int argc, char** argv)   {
+      VolumeManagerBenchmark bench(description, argc, argv);
+      return bench.run();
+    }
+  };
+}
+DECLARE_APPLY(DD4hep_VolumeManagerLookupBenchmark,VolumeManagerBenchmark::execute)
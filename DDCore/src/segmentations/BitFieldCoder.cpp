@@ -222,6 +222,55 @@ namespace dd4hep{
 
 
 
+    BitFieldDecoder::Field BitFieldDecoder::compile(const BitFieldElement& element) {
+      Field f ;
+      f.mask   = element.mask() ;
+      f.offset = element.offset() ;
+      f.sign   = element.isSigned() ? ( CellID(1) << ( element.width() - 1 ) ) : CellID(0) ;
+      return f ;
+    }
+
+    BitFieldDecoder::BitFieldDecoder(const BitFieldCoder& coder) {
+      _fields.reserve( coder.size() ) ;
+      for( const auto& element : coder.fields() )
+        _fields.emplace_back( compile( element ) ) ;
+    }
+
+    BitFieldDecoder::BitFieldDecoder(const BitFieldCoder& coder, const std::vector<std::string>& names) {
+      _fields.reserve( names.size() ) ;
+      for( const auto& name : names )
+        _fields.emplace_back( compile( coder[ name ] ) ) ;
+    }
+
+    void BitFieldDecoder::decode(const CellID* cells, size_t count, size_t idx, FieldID* column) const {
+      const CellID   mask   = _fields[idx].mask ;
+      const unsigned offset = _fields[idx].offset ;
+      const CellID   sign   = _fields[idx].sign ;
+      for( size_t i = 0 ; i < count ; ++i )
+        column[i] = FieldID( ( ( cells[i] & mask ) >> offset ) ^ sign ) - FieldID( sign ) ;
+    }
+
+    void BitFieldDecoder::decode(const CellID* cells, size_t count, FieldID* const* columns) const {
+      // field by field: every inner loop is a streaming, vectorizable kernel
+      for( size_t f = 0 ; f < _fields.size() ; ++f )
+        decode( cells, count, f, columns[f] ) ;
+    }
+
+    void BitFieldDecoder::encode(const FieldID* const* columns, size_t count, CellID* cells) const {
+      CellID joined = 0 ;
+      for( const auto& f : _fields )
+        joined |= f.mask ;
+      for( size_t i = 0 ; i < count ; ++i )
+        cells[i] &= ~joined ;
+      for( size_t f = 0 ; f < _fields.size() ; ++f ) {
+        const CellID   mask   = _fields[f].mask ;
+        const unsigned offset = _fields[f].offset ;
+        const FieldID* column = columns[f] ;
+        for( size_t i = 0 ; i < count ; ++i )
+          cells[i] |= ( CellID( column[i] ) << offset ) & mask ;
+      }
+    }
+
   } // namespace
 
 } // namespace
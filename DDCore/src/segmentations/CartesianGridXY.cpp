@@ -75,6 +75,36 @@ CellID CartesianGridXY::cellID(const Vector3D& localPosition,
 	return cID;
 }
 
+/// determine the positions of an array of cell IDs
+void CartesianGridXY::positions(const CellID* cells, std::size_t count, Vector3D* local) const {
+	if (!isExactType(typeid(CartesianGridXY))) return Segmentation::positions(cells, count, local);
+	const BitFieldDecoder dec(*_decoder, { _xId, _yId });
+	const BitFieldDecoder::Field fx = dec.field(0), fy = dec.field(1);
+	const double sizeX = _gridSizeX, offX = _offsetX;
+	const double sizeY = _gridSizeY, offY = _offsetY;
+	for (std::size_t i = 0; i < count; ++i) {
+		local[i].X = fx.value(cells[i]) * sizeX + offX;
+		local[i].Y = fy.value(cells[i]) * sizeY + offY;
+		local[i].Z = 0.;
+	}
+}
+
+/// determine the cell IDs of an array of positions
+void CartesianGridXY::cellIDs(const Vector3D* local, const Vector3D* global, const VolumeID* volIDs,
+                              std::size_t count, CellID* cells) const {
+	if (!isExactType(typeid(CartesianGridXY))) return Segmentation::cellIDs(local, global, volIDs, count, cells);
+	const BitFieldElement& fx = (*_decoder)[_xId];
+	const BitFieldElement& fy = (*_decoder)[_yId];
+	checkCellSize(_gridSizeX);
+	checkCellSize(_gridSizeY);
+	for (std::size_t i = 0; i < count; ++i) {
+		CellID cID = volIDs[i];
+		fx.set( cID, positionToBinFast(local[i].X, _gridSizeX, _offsetX) );
+		fy.set( cID, positionToBinFast(local[i].Y, _gridSizeY, _offsetY) );
+		cells[i] = cID;
+	}
+}
+
   std::vector<double> CartesianGridXY::cellDimensions(const CellID& /* cellID */) const {
   return {_gridSizeX, _gridSizeY};
 }
@@ -67,6 +67,40 @@ Vector3D CartesianGridXYZ::position(const CellID& cID) const {
 	return cID ;
 }
 
+/// determine the positions of an array of cell IDs
+void CartesianGridXYZ::positions(const CellID* cells, std::size_t count, Vector3D* local) const {
+	if (!isExactType(typeid(CartesianGridXYZ))) return Segmentation::positions(cells, count, local);
+	const BitFieldDecoder dec(*_decoder, { _xId, _yId, _zId });
+	const BitFieldDecoder::Field fx = dec.field(0), fy = dec.field(1), fz = dec.field(2);
+	const double sizeX = _gridSizeX, offX = _offsetX;
+	const double sizeY = _gridSizeY, offY = _offsetY;
+	const double sizeZ = _gridSizeZ, offZ = _offsetZ;
+	for (std::size_t i = 0; i < count; ++i) {
+		local[i].X = fx.value(cells[i]) * sizeX + offX;
+		local[i].Y = fy.value(cells[i]) * sizeY + offY;
+		local[i].Z = fz.value(cells[i]) * sizeZ + offZ;
+	}
+}
+
+/// determine the cell IDs of an array of positions
+void CartesianGridXYZ::cellIDs(const Vector3D* local, const Vector3D* global, const VolumeID* volIDs,
+                               std::size_t count, CellID* cells) const {
+	if (!isExactType(typeid(CartesianGridXYZ))) return Segmentation::cellIDs(local, global, volIDs, count, cells);
+	const BitFieldElement& fx = (*_decoder)[_xId];
+	const BitFieldElement& fy = (*_decoder)[_yId];
+	const BitFieldElement& fz = (*_decoder)[_zId];
+	checkCellSize(_gridSizeX);
+	checkCellSize(_gridSizeY);
+	checkCellSize(_gridSizeZ);
+	for (std::size_t i = 0; i < count; ++i) {
+		CellID cID = volIDs[i];
+		fx.set( cID, positionToBinFast(local[i].X, _gridSizeX, _offsetX) );
+		fy.set( cID, positionToBinFast(local[i].Y, _gridSizeY, _offsetY) );
+		fz.set( cID, positionToBinFast(local[i].Z, _gridSizeZ, _offsetZ) );
+		cells[i] = cID;
+	}
+}
+
 std::vector<double> CartesianGridXYZ::cellDimensions(const CellID&) const {
   return {_gridSizeX, _gridSizeY, _gridSizeZ};
 }
@@ -97,6 +97,42 @@ Vector3D CylindricalGridPhiZ::position(const CellID& cID) const {
 	return cID ;
 }
 
+/// determine the positions of an array of cell IDs
+void CylindricalGridPhiZ::positions(const CellID* cells, std::size_t count, Vector3D* local) const {
+	if (!isExactType(typeid(CylindricalGridPhiZ))) return Segmentation::positions(cells, count, local);
+	const BitFieldDecoder dec(*_decoder, { _phiId, _zId });
+	const BitFieldDecoder::Field fphi = dec.field(0), fz = dec.field(1);
+	const double sizePhi = _gridSizePhi, offPhi = _offsetPhi;
+	const double sizeZ = _gridSizeZ, offZ = _offsetZ;
+	const double R = _radius;
+	for (std::size_t i = 0; i < count; ++i) {
+		double phi = fphi.value(cells[i]) * sizePhi + offPhi;
+		local[i].X = R*cos(phi);
+		local[i].Y = R*sin(phi);
+		local[i].Z = fz.value(cells[i]) * sizeZ + offZ;
+	}
+}
+
+/// determine the cell IDs of an array of positions
+void CylindricalGridPhiZ::cellIDs(const Vector3D* local, const Vector3D* global, const VolumeID* volIDs,
+                                  std::size_t count, CellID* cells) const {
+	if (!isExactType(typeid(CylindricalGridPhiZ))) return Segmentation::cellIDs(local, global, volIDs, count, cells);
+	const BitFieldElement& fphi = (*_decoder)[_phiId];
+	const BitFieldElement& fz   = (*_decoder)[_zId];
+	checkCellSize(_gridSizePhi);
+	checkCellSize(_gridSizeZ);
+	for (std::size_t i = 0; i < count; ++i) {
+		double phi = atan2(local[i].Y,local[i].X);
+		if (!_phiIsSigned && phi < _offsetPhi) {
+		  phi += 2*M_PI;
+		}
+		CellID cID = volIDs[i];
+		fphi.set( cID, positionToBinFast(phi, _gridSizePhi, _offsetPhi) );
+		fz.set( cID,   positionToBinFast(local[i].Z, _gridSizeZ, _offsetZ) );
+		cells[i] = cID;
+	}
+}
+
 std::vector<double> CylindricalGridPhiZ::cellDimensions(const CellID&) const {
   return {_radius*_gridSizePhi, _gridSizeZ};
 }
@@ -57,6 +57,37 @@ CellID GridPhiEta::cellID(const Vector3D& /* localPosition */, const Vector3D& g
   return cID;
 }
 
+void GridPhiEta::positions(const CellID* aCellIDs, std::size_t aCount, Vector3D* aPositions) const {
+  if (!isExactType(typeid(GridPhiEta))) return Segmentation::positions(aCellIDs, aCount, aPositions);
+  const BitFieldDecoder dec(*_decoder, { m_etaID, m_phiID });
+  const BitFieldDecoder::Field fEta = dec.field(0), fPhi = dec.field(1);
+  const double sizeEta = m_gridSizeEta, offEta = m_offsetEta;
+  const double sizePhi = 2.*M_PI/(double)m_phiBins, offPhi = m_offsetPhi;
+  for (std::size_t i = 0; i < aCount; ++i) {
+    double lEta = fEta.value(aCellIDs[i]) * sizeEta + offEta;
+    double lPhi = fPhi.value(aCellIDs[i]) * sizePhi + offPhi;
+    aPositions[i] = Util::positionFromREtaPhi(1.0, lEta, lPhi);
+  }
+}
+
+void GridPhiEta::cellIDs(const Vector3D* aLocalPositions, const Vector3D* aGlobalPositions, const VolumeID* aVolumeIDs,
+                         std::size_t aCount, CellID* aCellIDs) const {
+  if (!isExactType(typeid(GridPhiEta))) return Segmentation::cellIDs(aLocalPositions, aGlobalPositions, aVolumeIDs, aCount, aCellIDs);
+  const BitFieldElement& fEta = (*_decoder)[m_etaID];
+  const BitFieldElement& fPhi = (*_decoder)[m_phiID];
+  const double sizePhi = 2 * M_PI / (double) m_phiBins;
+  checkCellSize(m_gridSizeEta);
+  checkCellSize(sizePhi);
+  for (std::size_t i = 0; i < aCount; ++i) {
+    double lEta = Util::etaFromXYZ(aGlobalPositions[i]);
+    double lPhi = Util::phiFromXYZ(aGlobalPositions[i]);
+    CellID cID = aVolumeIDs[i];
+    fEta.set( cID, positionToBinFast(lEta, m_gridSizeEta, m_offsetEta) );
+    fPhi.set( cID, positionToBinFast(lPhi, sizePhi, m_offsetPhi) );
+    aCellIDs[i] = cID;
+  }
+}
+
 double GridPhiEta::eta(const CellID& cID) const {
   CellID etaValue = _decoder->get(cID, m_etaID);
   return binToPosition(etaValue, m_gridSizeEta, m_offsetEta);
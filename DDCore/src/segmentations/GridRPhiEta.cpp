@@ -53,6 +53,43 @@ CellID GridRPhiEta::cellID(const Vector3D& /* localPosition */, const Vector3D&
   return cID;
 }
 
+void GridRPhiEta::positions(const CellID* aCellIDs, std::size_t aCount, Vector3D* aPositions) const {
+  if (!isExactType(typeid(GridRPhiEta))) return Segmentation::positions(aCellIDs, aCount, aPositions);
+  const BitFieldDecoder dec(*_decoder, { m_rID, m_etaID, m_phiID });
+  const BitFieldDecoder::Field fR = dec.field(0), fEta = dec.field(1), fPhi = dec.field(2);
+  const double sizeR = m_gridSizeR, offR = m_offsetR;
+  const double sizeEta = m_gridSizeEta, offEta = m_offsetEta;
+  const double sizePhi = 2.*M_PI/(double)m_phiBins, offPhi = m_offsetPhi;
+  for (std::size_t i = 0; i < aCount; ++i) {
+    double lR   = fR.value(aCellIDs[i])   * sizeR   + offR;
+    double lEta = fEta.value(aCellIDs[i]) * sizeEta + offEta;
+    double lPhi = fPhi.value(aCellIDs[i]) * sizePhi + offPhi;
+    aPositions[i] = Util::positionFromREtaPhi(lR, lEta, lPhi);
+  }
+}
+
+void GridRPhiEta::cellIDs(const Vector3D* aLocalPositions, const Vector3D* aGlobalPositions, const VolumeID* aVolumeIDs,
+                          std::size_t aCount, CellID* aCellIDs) const {
+  if (!isExactType(typeid(GridRPhiEta))) return Segmentation::cellIDs(aLocalPositions, aGlobalPositions, aVolumeIDs, aCount, aCellIDs);
+  const BitFieldElement& fR   = (*_decoder)[m_rID];
+  const BitFieldElement& fEta = (*_decoder)[m_etaID];
+  const BitFieldElement& fPhi = (*_decoder)[m_phiID];
+  const double sizePhi = 2 * M_PI / (double) m_phiBins;
+  checkCellSize(m_gridSizeR);
+  checkCellSize(m_gridSizeEta);
+  checkCellSize(sizePhi);
+  for (std::size_t i = 0; i < aCount; ++i) {
+    double lRadius = Util::radiusFromXYZ(aGlobalPositions[i]);
+    double lEta = Util::etaFromXYZ(aGlobalPositions[i]);
+    double lPhi = Util::phiFromXYZ(aGlobalPositions[i]);
+    CellID cID = aVolumeIDs[i];
+    fEta.set( cID, positionToBinFast(lEta, m_gridSizeEta, m_offsetEta) );
+    fPhi.set( cID, positionToBinFast(lPhi, sizePhi, m_offsetPhi) );
+    fR.set  ( cID, positionToBinFast(lRadius, m_gridSizeR, m_offsetR) );
+    aCellIDs[i] = cID;
+  }
+}
+
 double GridRPhiEta::r(const CellID& cID) const {
   CellID rValue = _decoder->get(cID, m_rID);
   return binToPosition(rValue, m_gridSizeR, m_offsetR);
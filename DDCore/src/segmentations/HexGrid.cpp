@@ -55,14 +55,11 @@ namespace dd4hep {
     HexGrid::~HexGrid() {
     }
 
-    /// determine the position based on the cell ID
-    Vector3D HexGrid::position(const CellID& cID) const {
-        int layer=0;
-	if (_stagger) layer= _decoder->get(cID,_staggerKeyword);
-		
+    /// determine the position from the decoded cell indices and the stagger layer
+    Vector3D HexGrid::positionFromBins(FieldID ix, FieldID iy, int layer) const {
 	Vector3D cellPosition;
-	cellPosition.X = _decoder->get(cID,_xId )*1.5*_sideLength+_offsetX+_sideLength/2.;
-	cellPosition.Y = _decoder->get(cID,_yId )*std::sqrt(3)/2.*_sideLength+ _offsetY+_sideLength*std::sqrt(3)/2.;
+	cellPosition.X = ix*1.5*_sideLength+_offsetX+_sideLength/2.;
+	cellPosition.Y = iy*std::sqrt(3)/2.*_sideLength+ _offsetY+_sideLength*std::sqrt(3)/2.;
 	if (_stagger==0)
 	  cellPosition.X+=_sideLength;
 	else if (_stagger==1)
@@ -86,17 +83,32 @@ namespace dd4hep {
 	return cellPosition;
     }
 
+    /// determine the position based on the cell ID
+    Vector3D HexGrid::position(const CellID& cID) const {
+        int layer=0;
+	if (_stagger) layer= _decoder->get(cID,_staggerKeyword);
+	return positionFromBins(_decoder->get(cID,_xId ), _decoder->get(cID,_yId ), layer);
+    }
+
+    /// determine the positions of an array of cell IDs
+    void HexGrid::positions(const CellID* cells, std::size_t count, Vector3D* local) const {
+	if (!isExactType(typeid(HexGrid))) return Segmentation::positions(cells, count, local);
+	const BitFieldDecoder dec(*_decoder, { _xId, _yId });
+	const BitFieldDecoder::Field fx = dec.field(0), fy = dec.field(1);
+	BitFieldDecoder::Field flayer;
+	if (_stagger) flayer = BitFieldDecoder(*_decoder, { _staggerKeyword }).field(0);
+	for (std::size_t i = 0; i < count; ++i) {
+	  int layer = _stagger ? flayer.value(cells[i]) : 0;
+	  local[i] = positionFromBins(fx.value(cells[i]), fy.value(cells[i]), layer);
+	}
+    }
+
     inline double positive_modulo(double i, double n) {
       return std::fmod(std::fmod(i,n) + n,n);
     }
 
-    
-    /// determine the cell ID based on the position
-    CellID HexGrid::cellID(const Vector3D& localPosition, const Vector3D& /* globalPosition */, const VolumeID& vID) const {
-        CellID cID = vID ;
-	int layer=0;
-	if (_stagger) layer= _decoder->get(cID,_staggerKeyword);
-
+    /// determine the cell indices from the local position and the stagger layer
+    void HexGrid::binsFromPosition(const Vector3D& localPosition, int layer, int& ix, int& iy) const {
 	double x=localPosition.X-_offsetX;
 	double y=localPosition.Y-_offsetY;
 	if (_stagger==0)
@@ -122,16 +134,44 @@ namespace dd4hep {
 	
 	double a=positive_modulo(y/(std::sqrt(3)*_sideLength),1);
 	double b=positive_modulo(x/(3*_sideLength),1);
-	int ix = std::floor(x/(3*_sideLength/2.))+		
+	ix = std::floor(x/(3*_sideLength/2.))+		
 	  (b<0.5)*(-std::abs(a-.5)<(b-.5)*3)+(b>0.5)*(std::abs(a-.5)-.5<(b-1)*3);
-	int iy=std::floor(y/(std::sqrt(3)*_sideLength/2.));
+	iy=std::floor(y/(std::sqrt(3)*_sideLength/2.));
 	iy-=(ix+iy)&1;
-	
+    }
+
+    /// determine the cell ID based on the position
+    CellID HexGrid::cellID(const Vector3D& localPosition, const Vector3D& /* globalPosition */, const VolumeID& vID) const {
+        CellID cID = vID ;
+	int layer=0;
+	if (_stagger) layer= _decoder->get(cID,_staggerKeyword);
+
+	int ix = 0, iy = 0;
+	binsFromPosition(localPosition, layer, ix, iy);
 	_decoder->set( cID,_xId, ix );
 	_decoder->set( cID,_yId, iy );
 	return cID ;
     }
 
+    /// determine the cell IDs of an array of positions
+    void HexGrid::cellIDs(const Vector3D* local, const Vector3D* global, const VolumeID* volIDs,
+                          std::size_t count, CellID* cells) const {
+	if (!isExactType(typeid(HexGrid))) return Segmentation::cellIDs(local, global, volIDs, count, cells);
+	const BitFieldElement& fx = (*_decoder)[_xId];
+	const BitFieldElement& fy = (*_decoder)[_yId];
+	BitFieldDecoder::Field flayer;
+	if (_stagger) flayer = BitFieldDecoder(*_decoder, { _staggerKeyword }).field(0);
+	for (std::size_t i = 0; i < count; ++i) {
+	  CellID cID = volIDs[i];
+	  int layer = _stagger ? flayer.value(cID) : 0;
+	  int ix = 0, iy = 0;
+	  binsFromPosition(local[i], layer, ix, iy);
+	  fx.set( cID, ix );
+	  fy.set( cID, iy );
+	  cells[i] = cID;
+	}
+    }
+
     std::vector<double> HexGrid::cellDimensions(const CellID&) const {
       return {2*_sideLength, std::sqrt(3)*_sideLength};
     }
@@ -79,6 +79,40 @@ Vector3D PolarGridRPhi::position(const CellID& cID) const {
 	return cID;
 }
 
+/// determine the positions of an array of cell IDs
+void PolarGridRPhi::positions(const CellID* cells, std::size_t count, Vector3D* local) const {
+	if (!isExactType(typeid(PolarGridRPhi))) return Segmentation::positions(cells, count, local);
+	const BitFieldDecoder dec(*_decoder, { _rId, _phiId });
+	const BitFieldDecoder::Field fr = dec.field(0), fphi = dec.field(1);
+	const double sizeR = _gridSizeR, offR = _offsetR;
+	const double sizePhi = _gridSizePhi, offPhi = _offsetPhi;
+	for (std::size_t i = 0; i < count; ++i) {
+		double R   = fr.value(cells[i])   * sizeR   + offR;
+		double phi = fphi.value(cells[i]) * sizePhi + offPhi;
+		local[i].X = R * cos(phi);
+		local[i].Y = R * sin(phi);
+		local[i].Z = 0.;
+	}
+}
+
+/// determine the cell IDs of an array of positions
+void PolarGridRPhi::cellIDs(const Vector3D* local, const Vector3D* global, const VolumeID* volIDs,
+                            std::size_t count, CellID* cells) const {
+	if (!isExactType(typeid(PolarGridRPhi))) return Segmentation::cellIDs(local, global, volIDs, count, cells);
+	const BitFieldElement& fr   = (*_decoder)[_rId];
+	const BitFieldElement& fphi = (*_decoder)[_phiId];
+	checkCellSize(_gridSizeR);
+	checkCellSize(_gridSizePhi);
+	for (std::size_t i = 0; i < count; ++i) {
+		double phi = atan2(local[i].Y,local[i].X);
+		double R = sqrt( local[i].X * local[i].X + local[i].Y * local[i].Y );
+		CellID cID = volIDs[i];
+		fr.set(cID,   positionToBinFast(R, _gridSizeR, _offsetR));
+		fphi.set(cID, positionToBinFast(phi, _gridSizePhi, _offsetPhi));
+		cells[i] = cID;
+	}
+}
+
 std::vector<double> PolarGridRPhi::cellDimensions(const CellID& cID) const {
   const double rPhiSize = binToPosition(_decoder->get(cID,_rId), _gridSizeR, _offsetR)*_gridSizePhi;
   return {_gridSizeR, rPhiSize};
@@ -62,6 +62,19 @@ namespace dd4hep {
       throw std::runtime_error("This segmentation type:"+_type+" does not support sub-segmentations.");
     }
 
+    /// Determine the local positions of an array of cell IDs
+    void Segmentation::positions(const CellID* cells, std::size_t count, Vector3D* local) const {
+      for (std::size_t i = 0; i < count; ++i)
+        local[i] = position(cells[i]);
+    }
+
+    /// Determine the cell IDs of an array of positions
+    void Segmentation::cellIDs(const Vector3D* local, const Vector3D* global, const VolumeID* volIDs,
+                               std::size_t count, CellID* cells) const {
+      for (std::size_t i = 0; i < count; ++i)
+        cells[i] = cellID(local[i], global[i], volIDs[i]);
+    }
+
     /// Determine the volume ID from the full cell ID by removing all local fields
     VolumeID Segmentation::volumeID(const CellID& cID) const {
       map<std::string, StringParameter>::const_iterator it;
@@ -148,10 +161,15 @@ namespace dd4hep {
 
     /// Helper method to convert a 1D position to a cell ID
     int Segmentation::positionToBin(double position, double cellSize, double offset) {
+      checkCellSize(cellSize);
+      return positionToBinFast(position, cellSize, offset);
+    }
+
+    /// Helper method to check the cell size once before batch conversions
+    void Segmentation::checkCellSize(double cellSize) {
       if (cellSize <= 1e-10) {
         throw runtime_error("Invalid cell size: 0.0");
       }
-      return int(floor((position + 0.5 * cellSize - offset) / cellSize));
     }
 
     /// Helper method to convert a bin number to a 1D position given a vector of binBoundaries
@@ -66,6 +66,10 @@ namespace dd4hep {
       bool                           m_merge_history;
       /// Property: Flag to indicate to merge 
       bool                           m_merge_particles;
+      /// Property: Flag to merge deposits into a hashed mapping (DepositHashMapping) instead of a vector
+      bool                           m_hashed_deposits;
+      /// Property: Merge the containers of one item by a parallel pairwise reduction
+      bool                           m_parallel_merge;
 
       /// Fully qualified keys of all containers to be manipulated
       std::set<Key::key_type>        m_keys  { };
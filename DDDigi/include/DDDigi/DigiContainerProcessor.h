@@ -19,8 +19,10 @@
 #include <DDDigi/DigiEventAction.h>
 #include <DDDigi/DigiDepositMonitor.h>
 #include <DDDigi/DigiParallelWorker.h>
+#include <DDDigi/DigiRandomGenerator.h>
 
 /// C/C++ include files
+#include <optional>
 #include <set>
 
 /// Namespace for the AIDA detector description toolkit
@@ -85,6 +87,8 @@ namespace dd4hep {
         predicate_t& operator = (const predicate_t& copy) = default;
         /// Check if a deposit should be processed
         bool operator()(const deposit_t& deposit)   const;
+        /// Evaluate the predicate for all rows of a column container (1: process, 0: skip)
+        void select(const DepositColumns& columns, std::vector<unsigned char>& selection)  const;
         static bool always_true(const deposit_t&)        { return true; }
         static bool not_killed (const deposit_t& depo)   { return 0 == (depo.second.flag&EnergyDeposit::KILLED); }
       };
@@ -112,6 +116,8 @@ namespace dd4hep {
         const std::type_info& input_type()  const;
         /// String form of the input data type
         std::string input_type_name()  const;
+        /// Number of items in the input container (0 if the type is unknown)
+        std::size_t input_size()  const;
         /// Access input data by type
         template <typename DATA> DATA* get_input(bool exc=false);
         /// Access input data by type
@@ -120,6 +126,10 @@ namespace dd4hep {
 
       /// Monitoring object
       DigiDepositMonitor* m_monitor { nullptr };
+      /// Property: Use reproducible random streams per deposit instead of the shared event generator
+      bool                m_cell_random { false };
+      /// Processor identifier keying the reproducible random streams (hash of the name)
+      uint64_t            m_random_id   { 0 };
 
     protected:
       /// Define standard assignments and constructors
@@ -139,6 +149,16 @@ namespace dd4hep {
       virtual void adopt_monitor(DigiDepositMonitor* monitor);
       /// Main functional callback adapter
       virtual void execute(context_t& context, work_t& work, const predicate_t& predicate)  const;
+      /// Key of the reproducible random streams of a container entry: processor, container item/mask and sequence
+      uint64_t random_key(Key container, std::size_t sequence)  const;
+      /// Reproducible random stream of one deposit: keyed by input, cell, container, sequence and processor
+      DigiCellRandom cell_random(const context_t& context, Key container, CellID cell, std::size_t sequence)  const;
+      /// Random generator to be used for one deposit
+      /** If reproducible streams are enabled, the cell stream is constructed in 'stream'
+       *  and returned. Otherwise the shared event generator is returned.
+       */
+      DigiRandomGenerator& random_generator(const context_t& context, std::optional<DigiCellRandom>& stream,
+                                            Key container, CellID cell, std::size_t sequence)  const;
     };
 
     /// Check if a deposit should be processed
@@ -159,6 +179,8 @@ namespace dd4hep {
     protected:
       std::function<void(context_t& context, DepositVector& cont,  work_t& work, const predicate_t& predicate)>	m_handleVector;
       std::function<void(context_t& context, DepositMapping& cont, work_t& work, const predicate_t& predicate)>	m_handleMapping;
+      std::function<void(context_t& context, DepositHashMapping& cont, work_t& work, const predicate_t& predicate)>	m_handleHashMapping;
+      std::function<void(context_t& context, DepositColumns& cont, work_t& work, const predicate_t& predicate)>	m_handleColumns;
 
     public:
       /// Standard constructor
@@ -175,6 +197,19 @@ namespace dd4hep {
                                        std::placeholders::_3,           \
                                        std::placeholders::_4);          \
     this->m_handleMapping = std::bind( &X<DepositMapping>, this,        \
+                                       std::placeholders::_1,           \
+                                       std::placeholders::_2,           \
+                                       std::placeholders::_3,           \
+                                       std::placeholders::_4);          \
+    this->m_handleHashMapping = std::bind( &X<DepositHashMapping>, this,\
+                                       std::placeholders::_1,           \
+                                       std::placeholders::_2,           \
+                                       std::placeholders::_3,           \
+                                       std::placeholders::_4)
+
+    /// Bind the (non-template) handler of deposit columns. Processors without it reject DepositColumns
+#define DEPOSIT_PROCESSOR_BIND_COLUMN_HANDLER(X)                        \
+    this->m_handleColumns = std::bind( &X, this,                        \
                                        std::placeholders::_1,           \
                                        std::placeholders::_2,           \
                                        std::placeholders::_3,           \
@@ -19,7 +19,11 @@
 /// C/C++ include files
 #include <cstdint>
 #include <memory>
+#include <memory_resource>
+#include <iterator>
 #include <limits>
+#include <atomic>
+#include <vector>
 #include <mutex>
 #include <map>
 #include <any>
@@ -40,6 +44,8 @@ namespace dd4hep {
     class EnergyDeposit;
     class ParticleMapping;
     class DepositMapping;
+    class DepositHashMapping;
+    class DepositColumns;
     class DigiEvent;
     class DataSegment;
 
@@ -613,12 +619,20 @@ namespace dd4hep {
       std::size_t merge(DepositMapping&& updates);
       /// Merge new deposit map onto existing map (destroys inputs. not thread safe!)
       std::size_t merge(const DepositMapping& updates);
+      /// Merge new deposit map onto existing map (destroys inputs. not thread safe!)
+      std::size_t merge(DepositHashMapping&& updates);
+      /// Merge deposit columns onto existing vector (destroys inputs. not thread safe!)
+      std::size_t merge(DepositColumns&& updates);
       /// Merge new deposit map onto existing vector (keep inputs. not thread safe!)
       std::size_t insert(const DepositVector& updates);
       /// Merge new deposit map onto existing map (keep inputs. not thread safe!)
       std::size_t insert(const DepositMapping& updates);
+      /// Merge new deposit map onto existing map (keep inputs. not thread safe!)
+      std::size_t insert(const DepositHashMapping& updates);
       /// Emplace entry
       void emplace(CellID cell, EnergyDeposit&& deposit);
+      /// Reserve space for count deposits
+      void reserve(std::size_t count)     { this->data.reserve(count);       }
 
       /// Access container size
       std::size_t size()  const           { return this->data.size();        }
@@ -662,7 +676,7 @@ namespace dd4hep {
      */
     class DepositMapping : public SegmentEntry  {
     public: 
-      using container_t    = std::multimap<CellID, EnergyDeposit>;
+      using container_t    = std::pmr::multimap<CellID, EnergyDeposit>;
       using value_type     = container_t::value_type;
       using mapped_type    = container_t::mapped_type;
       using key_type       = container_t::key_type;
@@ -674,6 +688,8 @@ namespace dd4hep {
     public: 
       /// Initializing constructor
       DepositMapping(const std::string& name, Key::mask_type mask, data_type_t typ);
+      /// Initializing constructor with memory resource (e.g. the event arena)
+      DepositMapping(const std::string& name, Key::mask_type mask, data_type_t typ, std::pmr::memory_resource* resource);
       /// Default constructor
       DepositMapping() = default;
       /// Disable move constructor
@@ -725,6 +741,312 @@ namespace dd4hep {
     {
     }
 
+    /// Initializing constructor with memory resource (e.g. the event arena)
+    inline DepositMapping::DepositMapping(const std::string& nam, Key::mask_type msk, data_type_t typ, std::pmr::memory_resource* resource)
+      : SegmentEntry(nam, msk, typ), data(resource)
+    {
+    }
+
+    /// Energy deposit mapping with a flat hash index for digitization
+    /**
+     *  Same interface as DepositMapping, but the deposits are stored contiguously
+     *  in insertion order and the cell identifiers are indexed by an open addressing
+     *  hash table with linear probing. Merging and insertion do not allocate per
+     *  deposit and a lookup typically touches a single cache line of the index.
+     *
+     *  As for DepositMapping, insert and emplace may add several deposits with the
+     *  same cell identifier; lookups return the first one. Iteration follows the
+     *  insertion order, not the order of the cell identifiers.
+     *
+     *  Single entries are removed by marking them and dropping them from the index.
+     *  Iteration skips marked entries. The storage is compacted once more than half
+     *  of the entries are marked, hence removal has constant amortized cost.
+     *  Only if cells have several deposits (insert) the removal of the first one
+     *  searches the storage for the next deposit of the cell.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DepositHashMapping : public SegmentEntry  {
+    public: 
+      using container_t    = std::vector<std::pair<const CellID, EnergyDeposit> >;
+      using value_type     = container_t::value_type;
+      using mapped_type    = container_t::value_type::second_type;
+      using key_type       = container_t::value_type::first_type;
+
+      /// Forward iterator over the deposits skipping removed entries
+      template <typename ITER> class basic_iterator  {
+        friend class DepositHashMapping;
+        template <typename OTHER> friend class basic_iterator;
+        /// Current position in the storage
+        ITER                 pos   { };
+        /// End of the storage
+        ITER                 last  { };
+        /// Removal mark of the current position. NULL if no entry was removed
+        const unsigned char* mark  { nullptr };
+        /// Advance to the next entry not removed
+        void skip()  {
+          if ( mark ) while ( pos != last && *mark ) { ++pos; ++mark; }
+        }
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = typename std::iterator_traits<ITER>::value_type;
+        using difference_type   = typename std::iterator_traits<ITER>::difference_type;
+        using pointer           = typename std::iterator_traits<ITER>::pointer;
+        using reference         = typename std::iterator_traits<ITER>::reference;
+
+        /// Default constructor
+        basic_iterator() = default;
+        /// Initializing constructor
+        basic_iterator(ITER p, ITER l, const unsigned char* m) : pos(p), last(l), mark(m)  { skip(); }
+        /// Conversion from iterator to const_iterator
+        template <typename OTHER> basic_iterator(const basic_iterator<OTHER>& c)
+          : pos(c.pos), last(c.last), mark(c.mark)  { }
+        /// Dereference operator
+        reference operator*()  const                 { return *pos;                       }
+        /// Member access operator
+        pointer   operator->() const                 { return &(*pos);                    }
+        /// Pre-increment operator
+        basic_iterator& operator++()   {
+          ++pos;
+          if ( mark ) { ++mark; skip(); }
+          return *this;
+        }
+        /// Post-increment operator
+        basic_iterator operator++(int)               { basic_iterator c(*this); ++(*this); return c; }
+        /// Equality operator
+        bool operator==(const basic_iterator& c) const  { return pos == c.pos;            }
+        /// Inequality operator
+        bool operator!=(const basic_iterator& c) const  { return pos != c.pos;            }
+      };
+      using iterator       = basic_iterator<container_t::iterator>;
+      using const_iterator = basic_iterator<container_t::const_iterator>;
+
+    protected:
+      /// Deposit storage in insertion order
+      container_t                data   { };
+      /// Hash index: entry number + 1 of the first deposit of a cell. 0 marks empty slots
+      std::vector<std::uint32_t> index  { };
+      /// Removal marks of the storage entries. Empty as long as nothing was removed
+      std::vector<unsigned char> removed        { };
+      /// Number of removed entries still present in the storage
+      std::size_t                num_removed    { 0 };
+      /// Number of deposits added for cells already present (see insert)
+      std::size_t                num_duplicates { 0 };
+
+      /// Hash function for cell identifiers (the low bits of cell IDs are poorly distributed)
+      static std::size_t hash(CellID cell)  {
+        cell ^= cell >> 33;
+        cell *= 0xff51afd7ed558ccdULL;
+        cell ^= cell >> 33;
+        return std::size_t(cell);
+      }
+      /// Index slot of a cell or the empty slot where it would be placed
+      std::size_t slot(CellID cell)  const;
+      /// Release an index slot (backward shift deletion: no tombstones in the index)
+      void release(std::size_t slot);
+      /// Resize the hash index to hold count entries at a load factor below 1/2
+      void rehash(std::size_t count);
+      /// Drop the removed entries from the storage and rebuild the index
+      void compact();
+      /// Ensure the hash index can take one more entry
+      void grow()  {
+        if ( 2*(data.size()+1) > index.size() ) this->rehash(2*data.size()+2);
+      }
+      /// Removal marks for iterators
+      const unsigned char* marks()  const  {
+        return this->removed.empty() ? nullptr : this->removed.data();
+      }
+      /// Add entry at the end of the storage and index it if the cell is new
+      template <typename DEPOSIT> void add(CellID cell, DEPOSIT&& deposit);
+      /// Merge entry: update the deposit of an existing cell or add a new one
+      template <typename DEPOSIT> void update(CellID cell, DEPOSIT&& deposit);
+
+    public: 
+      /// Initializing constructor
+      DepositHashMapping(const std::string& name, Key::mask_type mask, data_type_t typ);
+      /// Default constructor
+      DepositHashMapping() = default;
+      /// Disable move constructor
+      DepositHashMapping(DepositHashMapping&& copy) = default;
+      /// Disable copy constructor
+      DepositHashMapping(const DepositHashMapping& copy) = default;      
+      /// Default destructor
+      virtual ~DepositHashMapping() = default;
+      /// Disable move assignment
+      DepositHashMapping& operator=(DepositHashMapping&& copy) = default;
+      /// Disable copy assignment
+      DepositHashMapping& operator=(const DepositHashMapping& copy) = default;      
+
+      /// Merge new deposit map onto existing map (not thread safe!)
+      std::size_t merge(DepositHashMapping&& updates);
+      /// Merge new deposit map onto existing map (not thread safe!)
+      std::size_t insert(const DepositHashMapping& updates);
+      /// Merge new deposit map onto existing map (not thread safe!)
+      std::size_t merge(DepositMapping&& updates);
+      /// Merge new deposit map onto existing map (not thread safe!)
+      std::size_t insert(const DepositMapping& updates);
+      /// Merge new deposit map onto existing map (not thread safe!)
+      std::size_t merge(DepositVector&& updates);
+      /// Merge new deposit map onto existing map (not thread safe!)
+      std::size_t insert(const DepositVector& updates);
+      /// Emplace entry
+      void emplace(CellID cell, EnergyDeposit&& deposit);
+      /// Reserve space for count deposits
+      void reserve(std::size_t count);
+
+      /// Access container size
+      std::size_t size()  const           { return this->data.size() - this->num_removed;       }
+      /// Check container if empty
+      bool        empty() const           { return this->size() == 0;                            }
+      /// Access energy deposit by key
+      const EnergyDeposit& get(CellID cell)   const;
+      /// Find the first deposit of a cell. Returns end() if the cell is not present
+      iterator find(CellID cell);
+      /// Find the first deposit of a cell. Returns end() if the cell is not present (CONST)
+      const_iterator find(CellID cell)  const;
+
+      /** Iteration support */
+      /// Begin iteration
+      iterator begin()                    { return iterator(data.begin(), data.end(), marks());       }
+      /// End iteration
+      iterator end()                      { return iterator(data.end(), data.end(), nullptr);        }
+      /// Begin iteration (CONST)
+      const_iterator begin() const        { return const_iterator(data.begin(), data.end(), marks()); }
+      /// End iteration (CONST)
+      const_iterator end()   const        { return const_iterator(data.end(), data.end(), nullptr);  }
+      /// Remove entry. Invalidates all iterators (constant amortized cost)
+      void remove(iterator position);
+      /// Remove all entries matching the predicate in one pass. Invalidates all iterators
+      template <typename PREDICATE> std::size_t remove_if(PREDICATE pred);
+    };
+
+    /// Initializing constructor
+    inline DepositHashMapping::DepositHashMapping(const std::string& nam, Key::mask_type msk, data_type_t typ)
+      : SegmentEntry(nam, msk, typ)
+    {
+    }
+
+    /// Remove all entries matching the predicate in one pass. Invalidates all iterators
+    template <typename PREDICATE> inline std::size_t DepositHashMapping::remove_if(PREDICATE pred)   {
+      std::size_t len = this->size();
+      container_t entries;
+      entries.reserve(len);
+      for( auto& entry : *this )   {
+        if ( !pred(entry) )
+          entries.emplace_back(entry.first, std::move(entry.second));
+      }
+      this->data = std::move(entries);
+      this->removed.clear();
+      this->num_removed = 0;
+      this->index.clear();
+      this->rehash(this->data.size());
+      return len - this->data.size();
+    }
+
+    /// Energy deposit container with a structure-of-arrays layout for digitization
+    /**
+     *  The deposit quantities are stored in separate columns indexed by the
+     *  row number: all energies, all times etc. are contiguous in memory.
+     *  Loops over one or few quantities (energy cuts, zero suppression,
+     *  smearing, ADC conversion) only load the data they use and the compiler
+     *  can vectorize them. The deposit history is stored out-of-line in its
+     *  own column and is only touched when deposits are merged or converted.
+     *
+     *  The columns are public and must always have the same length.
+     *  Use emplace/reserve/clear to keep them consistent.
+     *
+     *  Conversions from and to the other deposit containers are provided
+     *  by the merge and insert members. The conversion of DepositVector to
+     *  columns and back preserves the order of the deposits.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DepositColumns : public SegmentEntry  {
+    public: 
+      /// Cell identifiers
+      std::vector<CellID>         cell          { };
+      /// Total energy deposits
+      std::vector<double>         deposit       { };
+      /// Errors of the energy deposits
+      std::vector<double>         depositError  { };
+      /// Proper creation time of the deposits
+      std::vector<double>         time          { };
+      /// Length of the track segments contributing to the deposits
+      std::vector<double>         length        { };
+      /// Hit positions: x, y and z coordinates
+      std::vector<double>         x             { };
+      std::vector<double>         y             { };
+      std::vector<double>         z             { };
+      /// Hit directions: x, y and z components
+      std::vector<double>         px            { };
+      std::vector<double>         py            { };
+      std::vector<double>         pz            { };
+      /// Deposit flags (see EnergyDeposit)
+      std::vector<uint64_t>       flag          { };
+      /// Source masks of the deposits
+      std::vector<Key::mask_type> mask          { };
+      /// Out-of-line deposit history
+      std::vector<History>        history       { };
+
+    public: 
+      /// Initializing constructor
+      DepositColumns(const std::string& name, Key::mask_type mask, data_type_t typ);
+      /// Default constructor
+      DepositColumns() = default;
+      /// Disable move constructor
+      DepositColumns(DepositColumns&& copy) = default;
+      /// Disable copy constructor
+      DepositColumns(const DepositColumns& copy) = default;      
+      /// Default destructor
+      virtual ~DepositColumns() = default;
+      /// Disable move assignment
+      DepositColumns& operator=(DepositColumns&& copy) = default;
+      /// Disable copy assignment
+      DepositColumns& operator=(const DepositColumns& copy) = default;      
+
+      /// Append deposits to the columns (destroys inputs. not thread safe!)
+      std::size_t merge(DepositColumns&& updates);
+      /// Append deposits to the columns (destroys inputs. not thread safe!)
+      std::size_t merge(DepositVector&& updates);
+      /// Append deposits to the columns (destroys inputs. not thread safe!)
+      std::size_t merge(DepositMapping&& updates);
+      /// Append deposits to the columns (destroys inputs. not thread safe!)
+      std::size_t merge(DepositHashMapping&& updates);
+      /// Append deposits to the columns (keep inputs. not thread safe!)
+      std::size_t insert(const DepositVector& updates);
+      /// Append deposits to the columns (keep inputs. not thread safe!)
+      std::size_t insert(const DepositMapping& updates);
+      /// Append deposits to the columns (keep inputs. not thread safe!)
+      std::size_t insert(const DepositHashMapping& updates);
+      /// Emplace entry
+      void emplace(CellID cell, EnergyDeposit&& deposit);
+      /// Emplace entry (keep input)
+      void emplace(CellID cell, const EnergyDeposit& deposit);
+      /// Reserve space for count deposits
+      void reserve(std::size_t count);
+      /// Remove all deposits
+      void clear();
+
+      /// Access container size
+      std::size_t size()  const           { return this->cell.size();        }
+      /// Check container if empty
+      bool        empty() const           { return this->cell.empty();       }
+      /// Assemble the energy deposit of a given row (copies the history)
+      EnergyDeposit at(std::size_t row)   const;
+      /// Assemble the energy deposit of a given row (moves the history out of the container)
+      EnergyDeposit extract(std::size_t row);
+    };
+
+    /// Initializing constructor
+    inline DepositColumns::DepositColumns(const std::string& nam, Key::mask_type msk, data_type_t typ)
+      : SegmentEntry(nam, msk, typ)
+    {
+    }
+
     class ADCValue   {
     public:
       using value_t = uint32_t;
@@ -952,9 +1274,70 @@ namespace dd4hep {
       this->data = std::make_shared<header_data>();
     }
 
+    /// Read-only view of a data container shared between events
+    /**
+     *  Data segments may hold shared views instead of owned containers
+     *  e.g. for pile-up events, which are decoded once and then used for many
+     *  signal events (see DigiPileupInput). Views are never modified.
+     *  Consumers, which accept views (e.g. DigiContainerCombine), copy their content.
+     */
+    template <typename T> using shared_view_t = std::shared_ptr<const T>;
+
+    ///  Keys of the data items expected in the event data segments
+    /**
+     *  Keys declared here are resolved to pre-allocated slots when a data segment
+     *  of an event is created. Data items of these keys are published to their slot
+     *  with an atomic state change: parallel writers of distinct containers never
+     *  block each other. Items with undeclared keys are inserted to a locked map.
+     *
+     *  Keys may be declared explicitly at configuration time. If learning is
+     *  enabled, the keys of every processed event are added when the event is
+     *  deleted, so that from the second event on all regular containers have slots.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class SegmentLayout   {
+    public:
+      using keys_t = std::shared_ptr<const std::vector<Key> >;
+
+    protected:
+      /// Lock protecting the key map
+      mutable std::mutex                   m_lock   { };
+      /// Sorted keys by segment identifier
+      std::map<Key::segment_type, keys_t>  m_keys   { };
+      /// Flag to add the keys of processed events
+      bool                                 m_learn  { true };
+
+    public:
+      /// Default constructor
+      SegmentLayout() = default;
+      /// Disable copy constructor
+      SegmentLayout(const SegmentLayout& copy) = delete;
+      /// Disable copy assignment
+      SegmentLayout& operator=(const SegmentLayout& copy) = delete;
+      /// Default destructor
+      ~SegmentLayout() = default;
+
+      /// Enable or disable learning the keys of processed events
+      void set_learning(bool value)         {  this->m_learn = value;  }
+      /// Declare key of a data item in the segment with the given identifier
+      void declare(Key::segment_type id, Key key);
+      /// Add the keys of a (finished) data segment
+      void learn(const DataSegment& segment);
+      /// Access the sorted keys of a segment. May be empty, but never null
+      keys_t keys(Key::segment_type id)  const;
+    };
 
-    ///  Data segment definition (locked map)
+    ///  Data segment definition (slotted and locked map)
     /**
+     *  Data items with keys declared in the SegmentLayout are stored in pre-allocated
+     *  slots, which are published and looked up without locking.
+     *  All other data items are stored in a map protected by the segment lock.
+     *  Iteration visits both in the order of the keys.
+     *
+     *  Erasing data items must not be concurrent with accesses to the same items.
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -963,9 +1346,62 @@ namespace dd4hep {
     class DataSegment   {
     public:
       using key_t = Key::key_type;
-      using container_map_t = std::map<Key, std::any>;
-      using iterator        = container_map_t::iterator;
-      using const_iterator  = container_map_t::const_iterator;
+      using container_map_t = std::pmr::map<Key, std::any>;
+      using value_type      = container_map_t::value_type;
+
+      /// Pre-allocated data slot
+      class slot_t   {
+      public:
+        enum state_t : int  { EMPTY = 0, BUSY = 1, VALID = 2 };
+        /// Publication state of the slot
+        std::atomic<int> state  { EMPTY };
+        /// Slot data
+        value_type       value;
+        /// Initializing constructor
+        slot_t(Key key) : value(key, std::any()) {}
+        /// Check if the slot holds published data
+        bool valid()  const   {  return this->state.load(std::memory_order_acquire) == VALID;  }
+      };
+
+      /// Iterator over slots and map entries in the order of the keys
+      template <typename SLOT, typename ITER, typename VALUE> class iterator_t  {
+        SLOT* slot      { nullptr };
+        SLOT* slot_end  { nullptr };
+        ITER  iter      { };
+        ITER  iter_end  { };
+        /// Skip slots without published data
+        void skip()                 {  while( slot != slot_end && !slot->valid() ) ++slot;  }
+        /// Check if the current entry is a slot or a map entry
+        bool use_slot()  const      {  return slot != slot_end && (iter == iter_end || slot->value.first < iter->first);  }
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = VALUE;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = VALUE*;
+        using reference         = VALUE&;
+        /// Default constructor
+        iterator_t() = default;
+        /// Initializing constructor
+        iterator_t(SLOT* s, SLOT* se, ITER i, ITER ie) : slot(s), slot_end(se), iter(i), iter_end(ie)  {  skip();  }
+        /// Access to the current entry
+        reference operator*()  const    {  return use_slot() ? slot->value : *iter;    }
+        /// Access to the current entry
+        pointer   operator->() const    {  return &(this->operator*());              }
+        /// Move to the next entry
+        iterator_t& operator++()        {
+          if ( use_slot() ) { ++slot; skip(); }
+          else ++iter;
+          return *this;
+        }
+        /// Move to the next entry
+        iterator_t  operator++(int)     {  iterator_t tmp(*this); ++(*this); return tmp;  }
+        /// Equality operator
+        bool operator==(const iterator_t& o)  const  {  return slot == o.slot && iter == o.iter;  }
+        /// Inequality operator
+        bool operator!=(const iterator_t& o)  const  {  return !(*this == o);  }
+      };
+      using iterator        = iterator_t<slot_t, container_map_t::iterator, value_type>;
+      using const_iterator  = iterator_t<const slot_t, container_map_t::const_iterator, const value_type>;
 
     private:
       /// Call on failed any-casts
@@ -977,14 +1413,29 @@ namespace dd4hep {
       std::any* get_item(Key key, bool exc);
       /// Access data item by key  (CONST)
       const std::any* get_item(Key key, bool exc)  const;
+      /// Access slot by key (nullptr if the key has no slot)
+      slot_t* find_slot(Key key)  const;
+
+      /// Segment lock if not supplied externally
+      std::mutex        own_lock;
+      /// Pre-allocated slots sorted by key
+      slot_t*           slots     { nullptr };
+      /// Number of pre-allocated slots
+      std::size_t       num_slots { 0 };
+      /// Memory resource of the slots
+      std::pmr::memory_resource* resource { nullptr };
 
     public:
+      /// Data items without pre-allocated slot (protected by the lock)
       container_map_t   data;
+      /// Lock protecting the map of data items without slot
       std::mutex&       lock;
       Key::segment_type id  { 0 };
     public:
-      /// Initializing constructor
-      DataSegment(std::mutex& lock, Key::segment_type id);
+      /// Initializing constructor with external lock (no slots)
+      DataSegment(std::mutex& lock, Key::segment_type id, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+      /// Initializing constructor with segment lock and pre-allocated slots for the sorted keys
+      DataSegment(Key::segment_type id, std::pmr::memory_resource* resource, const std::vector<Key>& slot_keys);
       /// Default constructor
       DataSegment() = delete;
       /// Disable move constructor
@@ -992,13 +1443,13 @@ namespace dd4hep {
       /// Disable copy constructor
       DataSegment(const DataSegment& copy) = delete;      
       /// Default destructor
-      virtual ~DataSegment() = default;
+      virtual ~DataSegment();
       /// Disable move assignment
       DataSegment& operator=(DataSegment&& copy) = delete;
       /// Disable copy assignment
       DataSegment& operator=(const DataSegment& copy) = delete;      
 
-      /** Locked operations */
+      /** Locked operations (lock-free for keys with slots) */
       /// Emplace data item (locked)
       bool emplace_any(Key key, std::any&& data);
       /// Emplace arbitrary data item
@@ -1033,21 +1484,23 @@ namespace dd4hep {
       template<typename T> const T* pointer(Key key)  const;
 
       /// Access container size
-      std::size_t size()  const           { return this->data.size();        }
+      std::size_t size()  const;
       /// Check container if empty
-      bool        empty() const           { return this->data.empty();       }
+      bool        empty() const           { return 0 == this->size();        }
+      /// Number of pre-allocated slots
+      std::size_t slot_count()  const     { return this->num_slots;          }
       /// Begin iteration
-      iterator begin()                    { return this->data.begin();       }
+      iterator begin()                    { return iterator(slots, slots+num_slots, data.begin(), data.end());     }
       /// End iteration
-      iterator end()                      { return this->data.end();         }
+      iterator end()                      { return iterator(slots+num_slots, slots+num_slots, data.end(), data.end()); }
       /// Find entry by key
-      iterator find(Key key)              { return this->data.find(key);     }
+      iterator find(Key key);
       /// Begin iteration (CONST)
-      const_iterator begin() const        { return this->data.begin();       }
+      const_iterator begin() const        { return const_iterator(slots, slots+num_slots, data.begin(), data.end());     }
       /// End iteration (CONST)
-      const_iterator end()   const        { return this->data.end();         }
+      const_iterator end()   const        { return const_iterator(slots+num_slots, slots+num_slots, data.end(), data.end()); }
       /// Find entry by key
-      const_iterator find(Key key) const  { return this->data.find(key);     }
+      const_iterator find(Key key) const;
     };
 
     /// Access data as reference by key. If not existing, an exception is thrown
@@ -1058,8 +1511,12 @@ namespace dd4hep {
     }
     /// Access data as reference by key. If not existing, an exception is thrown
     template<typename DATA> inline const DATA& DataSegment::get(Key key)  const   {
-      if ( const DATA* ptr = std::any_cast<DATA>(this->get_item(key, true)) )
+      const std::any* item = this->get_item(key, true);
+      if ( const DATA* ptr = std::any_cast<DATA>(item) )
         return *ptr;
+      /// Read-only shared views (e.g. pile-up input) are accessible as constant data
+      else if ( const auto* view = std::any_cast<shared_view_t<DATA> >(item) )
+        return **view;
       throw std::runtime_error(this->invalid_cast(std::move(key), typeid(DATA)));
     }
 
@@ -1071,8 +1528,11 @@ namespace dd4hep {
     }
     /// Access data as pointers by key. If not existing, nullptr is returned
     template<typename DATA> inline const DATA* DataSegment::pointer(Key key)  const   {
-      if ( const DATA* ptr = std::any_cast<DATA>(this->get_item(std::move(key), false)) )
+      const std::any* item = this->get_item(std::move(key), false);
+      if ( const DATA* ptr = std::any_cast<DATA>(item) )
         return ptr;
+      else if ( const auto* view = std::any_cast<shared_view_t<DATA> >(item) )
+        return view->get();
       return nullptr;
     }
 
@@ -1105,6 +1565,10 @@ namespace dd4hep {
       std::mutex  m_lock;
       /// String identifier of this event (for debug printouts)
       std::string m_id;
+      /// Memory resource for the event data (e.g. the event arena supplied by the kernel)
+      std::pmr::memory_resource* m_resource  { std::pmr::get_default_resource() };
+      /// Keys of the data items with pre-allocated slots (optional)
+      SegmentLayout*             m_layout    { nullptr };
       /// Reference to the general purpose data segment
       segment_t m_data;
       /// Reference to the counts data segment
@@ -1115,6 +1579,8 @@ namespace dd4hep {
       segment_t m_outputs;
       /// Reference to the deposit data segment
       segment_t m_deposits;
+      /// Identity of the input data of this event (combined from all input actions)
+      uint64_t  m_input_identity { 0 };
 
       /// Helper: Save access with segment creation if it does not exist
       DataSegment& access_segment(segment_t& seg, Key::segment_type id);
@@ -1134,10 +1600,20 @@ namespace dd4hep {
       DigiEvent(const DigiEvent& copy) = delete;
       /// Intializing constructor
       DigiEvent(int num);
+      /// Intializing constructor with memory resource for the event data
+      DigiEvent(int num, std::pmr::memory_resource* resource);
+      /// Intializing constructor with memory resource and segment layout for the event data
+      DigiEvent(int num, std::pmr::memory_resource* resource, SegmentLayout* layout);
       /// Default destructor
       virtual ~DigiEvent();
       /// String identifier of this event
       const char* id()   const    {   return this->m_id.c_str();   }
+      /// Memory resource for data with event lifetime
+      std::pmr::memory_resource* memory_resource()  const  {  return this->m_resource;  }
+      /// Add the identity of one input entry to the identity of the event (locked)
+      void add_input_identity(uint64_t identity);
+      /// Identity of the input data. Unlike the event number independent of the scheduling. 0 if not set
+      uint64_t input_identity()  const  {  return this->m_input_identity;  }
       /// Retrieve data segment from the event structure by name
       DataSegment& get_segment(const std::string& name);
       /// Retrieve data segment from the event structure by name (CONST)
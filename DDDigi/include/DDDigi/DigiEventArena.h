@@ -0,0 +1,98 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDDIGI_DIGIEVENTARENA_H
+#define DDDIGI_DIGIEVENTARENA_H
+
+/// C/C++ include files
+#include <memory_resource>
+#include <cstddef>
+#include <vector>
+#include <atomic>
+#include <mutex>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    /// Monotonic memory arena for the transient data of one event
+    /**
+     *  All data of an event are released together at the end of the event.
+     *  The arena hands out memory from large blocks by advancing a pointer,
+     *  deallocation is a no-op. When the event is done the kernel calls reset(),
+     *  which rewinds the arena, but keeps the blocks for the next event.
+     *  Hence after the first few events no more heap allocations are
+     *  necessary for containers allocated from the arena.
+     *
+     *  Several threads may work on the same event: allocations are locked.
+     *  The lock is only contended by threads of the same event.
+     *
+     *  Note: Containers allocated from the arena must not survive the event.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiEventArena : public std::pmr::memory_resource   {
+    protected:
+      struct block_t   {
+        std::byte*  data   { nullptr };
+        std::size_t length { 0 };
+      };
+      /// Allocation lock
+      std::mutex           m_lock;
+      /// Memory blocks owned by the arena
+      std::vector<block_t> m_blocks;
+      /// Index of the block currently used for allocations
+      std::size_t          m_current   { 0 };
+      /// Offset of the next free byte in the current block
+      std::size_t          m_offset    { 0 };
+      /// Size of the first block. Follow-up blocks grow geometrically
+      std::size_t          m_block_size;
+      /// Number of bytes allocated since the last reset
+      std::atomic<std::size_t> m_allocated { 0 };
+
+      /// Allocate bytes from the arena
+      virtual void* do_allocate(std::size_t bytes, std::size_t alignment)  override;
+      /// Deallocate bytes: no-op. Memory is recycled by reset()
+      virtual void  do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment)  override;
+      /// Memory resources are only equal if they are identical
+      virtual bool  do_is_equal(const std::pmr::memory_resource& other)  const noexcept  override;
+
+    public:
+      /// Initializing constructor
+      DigiEventArena(std::size_t block_size);
+      /// Inhibit move constructor
+      DigiEventArena(DigiEventArena&& copy) = delete;
+      /// Inhibit copy constructor
+      DigiEventArena(const DigiEventArena& copy) = delete;
+      /// Inhibit move assignment
+      DigiEventArena& operator=(DigiEventArena&& copy) = delete;
+      /// Inhibit copy assignment
+      DigiEventArena& operator=(const DigiEventArena& copy) = delete;
+      /// Default destructor. Releases all blocks
+      virtual ~DigiEventArena();
+
+      /// Rewind the arena. The blocks are kept for further usage
+      void reset();
+      /// Number of bytes allocated since the last reset (all threads)
+      std::size_t allocated()  const   {  return m_allocated.load(std::memory_order_relaxed);  }
+      /// Number of bytes the calling thread allocated from any arena (monotonic, never reset)
+      static std::size_t thread_allocated();
+      /// Total size of the memory blocks owned by the arena
+      std::size_t capacity()  const;
+    };
+  }    // End namespace digi
+}      // End namespace dd4hep
+#endif // DDDIGI_DIGIEVENTARENA_H
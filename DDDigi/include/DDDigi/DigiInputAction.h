@@ -47,6 +47,8 @@ namespace dd4hep {
       public:
 	/// Event counter for current file
 	int event_count  { 0 };
+	/// Index of the source in the list of inputs
+	int input_index  { INPUT_START };
       };
 
       /// Event frame base
@@ -114,6 +116,8 @@ namespace dd4hep {
       virtual void onOpenFile(input_source& source);
       /// Callback when a new event is processed
       virtual void onProcessEvent(input_source& source, event_frame& frame);
+      /// Add the identity of an input entry (input mask, source index, entry) to the event
+      void record_input(DigiEvent& event, const input_source& source, uint64_t entry)  const;
 
       /// Check if a event object should be loaded: Default YES unless inhibited by selection or veto
       bool object_loading_is_enabled(const std::string& nam)  const;
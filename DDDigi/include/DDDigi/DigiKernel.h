@@ -33,6 +33,8 @@ namespace dd4hep {
     /// Forward declarations
     class DigiAction;
     class DigiActionSequence;
+    class DigiProfiler;
+    class SegmentLayout;
     
     /// Class, which allows all DigiAction derivatives to access the DDG4 kernel structures.
     /**
@@ -50,6 +52,7 @@ namespace dd4hep {
     private:
       class Internals;
       class Processor;
+      class Pipeline;
       template <typename ACTION, typename ARGUMENT> class Wrapper;
 
       /// Internal only data structures;
@@ -118,6 +121,10 @@ namespace dd4hep {
       std::size_t events_done()  const;
       /// Access current number of events processing (events in flight)
       std::size_t events_processing()  const;
+      /// Access the action profiler. Returns null if profiling is disabled
+      DigiProfiler* profiler()  const;
+      /// Access the keys of the event data with pre-allocated segment slots. Returns null if disabled
+      SegmentLayout* segment_layout()  const;
 
       /// Register configure callback. Signature:   (function)()
       void register_configure(const std::function<void()>& callback)   const;
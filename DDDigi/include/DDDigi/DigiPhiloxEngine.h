@@ -0,0 +1,124 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDDIGI_DIGIPHILOXENGINE_H
+#define DDDIGI_DIGIPHILOXENGINE_H
+
+/// C/C++ include files
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    /// Counter based random engine (Philox-4x32-10)
+    /**
+     *  The random numbers are a pure function of (key, stream, counter):
+     *  the engine does not carry a sequential state. Hence
+     *  - blocks of random numbers are independent of each other and may be
+     *    computed in any order or in parallel (the fill loop vectorizes),
+     *  - threads may share one engine: every caller reserves its range of
+     *    counters with an atomic increment.
+     *
+     *  Each counter value produces two uniform numbers in ]0,1[ with 53 bit precision.
+     *
+     *  See: J.K.Salmon et al., Parallel random numbers: as easy as 1, 2, 3,
+     *       Proceedings of SC11, 2011.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiPhiloxEngine   {
+    public:
+      /// Philox-4x32 block
+      struct block_t   {
+        uint32_t v[4];
+      };
+
+    protected:
+      /// Key of the generator (the seed)
+      uint64_t              m_key     { 0 };
+      /// Stream identifier
+      uint64_t              m_stream  { 0 };
+      /// Next free counter
+      std::atomic<uint64_t> m_counter { 0 };
+
+    public:
+      /// Initializing constructor
+      DigiPhiloxEngine(uint64_t seed, uint64_t stream = 0);
+      /// Inhibit move constructor
+      DigiPhiloxEngine(DigiPhiloxEngine&& copy) = delete;
+      /// Inhibit copy constructor
+      DigiPhiloxEngine(const DigiPhiloxEngine& copy) = delete;
+      /// Inhibit move assignment
+      DigiPhiloxEngine& operator=(DigiPhiloxEngine&& copy) = delete;
+      /// Inhibit copy assignment
+      DigiPhiloxEngine& operator=(const DigiPhiloxEngine& copy) = delete;
+      /// Default destructor
+      ~DigiPhiloxEngine() = default;
+
+      /// Re-seed the engine and rewind the counter
+      void seed(uint64_t seed, uint64_t stream = 0);
+      /// Access the seed
+      uint64_t seed()  const    {  return m_key;  }
+      /// Fill buffer with uniform random numbers in ]0,1[
+      void   fill(double* buffer, std::size_t count);
+      /// Single uniform random number in ]0,1[
+      double operator()();
+
+      /// Philox-4x32-10 bijection of a counter block with a given key
+      static block_t philox(block_t counter, uint64_t key);
+      /// Convert 64 random bits to a double in ]0,1[
+      static double to_double(uint32_t hi, uint32_t lo);
+      /// Combine two 64 bit values to a well mixed 64 bit key (splitmix64 finalizer)
+      static uint64_t mix(uint64_t a, uint64_t b);
+      /// Stateless generation: uniform random numbers of (key, stream) starting with counter 'first'
+      static void uniform(uint64_t key, uint64_t stream, uint64_t first, double* buffer, std::size_t count);
+    };
+
+    /// Philox-4x32-10 bijection of a counter block with a given key
+    inline DigiPhiloxEngine::block_t DigiPhiloxEngine::philox(block_t ctr, uint64_t key)   {
+      constexpr uint32_t M0 = 0xD2511F53, M1 = 0xCD9E8D57;
+      constexpr uint32_t W0 = 0x9E3779B9, W1 = 0xBB67AE85;
+      uint32_t k0 = uint32_t(key), k1 = uint32_t(key >> 32);
+      for( int round = 0; round < 10; ++round )   {
+        uint64_t p0 = uint64_t(M0) * ctr.v[0];
+        uint64_t p1 = uint64_t(M1) * ctr.v[2];
+        ctr = block_t { { uint32_t(p1 >> 32) ^ ctr.v[1] ^ k0, uint32_t(p1),
+                          uint32_t(p0 >> 32) ^ ctr.v[3] ^ k1, uint32_t(p0) } };
+        k0 += W0;
+        k1 += W1;
+      }
+      return ctr;
+    }
+
+    /// Convert 64 random bits to a double in ]0,1[
+    inline double DigiPhiloxEngine::to_double(uint32_t hi, uint32_t lo)   {
+      uint64_t bits = (uint64_t(hi) << 32) | lo;
+      return (double(bits >> 11) + 0.5) * 0x1p-53;
+    }
+
+    /// Combine two 64 bit values to a well mixed 64 bit key (splitmix64 finalizer)
+    inline uint64_t DigiPhiloxEngine::mix(uint64_t a, uint64_t b)   {
+      uint64_t z = a ^ (b + 0x9E3779B97F4A7C15ULL + (a << 6) + (a >> 2));
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      return z ^ (z >> 31);
+    }
+  }    // End namespace digi
+}      // End namespace dd4hep
+#endif // DDDIGI_DIGIPHILOXENGINE_H
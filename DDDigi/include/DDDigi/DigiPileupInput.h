@@ -0,0 +1,132 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDDIGI_DIGIPILEUPINPUT_H
+#define DDDIGI_DIGIPILEUPINPUT_H
+
+/// Framework include files
+#include <DDDigi/DigiEventAction.h>
+#include <DDDigi/DigiData.h>
+
+/// C/C++ include files
+#include <memory>
+#include <mutex>
+#include <list>
+#include <map>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    /// Pile-up input with a shared pool of decoded minimum bias events
+    /**
+     *  The adopted reader action (e.g. DigiDDG4ROOT) decodes minimum bias events
+     *  into a private event. The containers of these events are kept in a pool
+     *  with a limited number of entries and a limited amount of memory.
+     *  The least recently used entries are evicted first.
+     *
+     *  For every signal event a Poisson distributed number of pile-up events
+     *  with mean "mean_pileup" is sampled from the pool. Each sampled event
+     *  is placed to the input segment as read-only shared views
+     *  (see shared_view_t) with the mask "first_mask + i", where i is the
+     *  index of the pile-up event within the signal event.
+     *  The views are intended to be consumed by the DigiContainerCombine.
+     *
+     *  The particle keys and the history records refer to the mask of the
+     *  containers. Hence a pooled event keeps one set of views per mask
+     *  it was placed with. The copy for a new mask is created on first use.
+     *
+     *  A decoded event may be used "max_reuse" times before it is dropped
+     *  from the pool and replaced by a newly decoded event (0: no limit).
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiPileupInput : public DigiEventAction {
+    public:
+      /// Decoded minimum bias event in the pool
+      class pool_event_t   {
+      public:
+        using views_t = std::vector<std::pair<Key, std::any> >;
+        /// Sequence number of the decoded event
+        std::size_t                        number  { 0 };
+        /// Shared views of the event containers by mask
+        std::map<Key::mask_type, views_t>  views   { };
+        /// Lock protecting the views while copies for new masks are added
+        std::mutex                         lock    { };
+        /// Approximate memory size of the containers
+        std::size_t                        bytes   { 0 };
+        /// Number of signal events, which used this event
+        std::size_t                        used    { 0 };
+        /// Flag if the memory of the event is accounted to the pool
+        bool                               pooled  { false };
+      };
+      using pool_entry_t = std::shared_ptr<pool_event_t>;
+
+    protected:
+      /// Property: Input data segment name
+      std::string             m_input_segment  { "inputs" };
+      /// Property: Mean number of pile-up events per signal event
+      double                  m_mean_pileup    { 1e0 };
+      /// Property: Maximal number of pile-up events per signal event (Truncation of the poisson tail)
+      std::size_t             m_max_pileup     { 100 };
+      /// Property: Mask of the first pile-up event. Subsequent events get incremented masks
+      int                     m_first_mask     { 0x1 };
+      /// Property: Maximal number of decoded events in the pool
+      std::size_t             m_pool_size      { 100 };
+      /// Property: Maximal memory of the decoded events in the pool [MB]
+      std::size_t             m_pool_memory    { 1024 };
+      /// Property: Maximal number of signal events using the same decoded event (0: unlimited)
+      std::size_t             m_max_reuse      { 10 };
+
+      /// Reader action to decode the minimum bias events
+      DigiEventAction*        m_reader         { nullptr };
+      /// Pool of decoded events ordered by the time of last usage (most recent first)
+      mutable std::list<pool_entry_t> m_pool   { };
+      /// Lock protecting the pool
+      mutable std::mutex      m_pool_lock      { };
+      /// Total memory of the events in the pool
+      mutable std::size_t     m_pool_bytes     { 0 };
+      /// Monitoring: Number of decoded events
+      mutable std::size_t     m_num_decoded    { 0 };
+      /// Monitoring: Number of pile-up events handed out
+      mutable std::size_t     m_num_used       { 0 };
+
+    protected:
+      /// Define standard assignments and constructors
+      DDDIGI_DEFINE_ACTION_CONSTRUCTORS(DigiPileupInput);
+
+      /// Decode the next minimum bias event using the reader action
+      pool_entry_t decode(context_t& context)  const;
+      /// Sample one pile-up event from the pool. Decode new events if necessary
+      pool_entry_t sample(context_t& context)  const;
+      /// Add newly decoded event to the pool and evict old events if the pool is full
+      void insert(pool_entry_t entry)  const;
+      /// Access the views of a pooled event with all keys moved to the requested mask
+      const pool_event_t::views_t& views(pool_event_t& entry, Key::mask_type mask)  const;
+
+    public:
+      /// Standard constructor
+      DigiPileupInput(const kernel_t& kernel, const std::string& nam);
+      /// Default destructor
+      virtual ~DigiPileupInput();
+      /// Adopt the reader action used to decode the minimum bias events
+      void adopt(DigiEventAction* action);
+      /// Callback to place the pile-up events to the input segment
+      virtual void execute(context_t& context)  const override;
+    };
+  }    // End namespace digi
+}      // End namespace dd4hep
+#endif // DDDIGI_DIGIPILEUPINPUT_H
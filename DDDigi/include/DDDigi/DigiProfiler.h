@@ -0,0 +1,167 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+#ifndef DDDIGI_DIGIPROFILER_H
+#define DDDIGI_DIGIPROFILER_H
+
+/// Framework include files
+#include <DDDigi/DigiKernel.h>
+#include <DDDigi/DigiContext.h>
+
+/// C/C++ include files
+#include <cstdint>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <map>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    /// Per-action timing and allocation profiler
+    /**
+     *  The profiler is enabled with the kernel property "profile".
+     *  Every action call executed by the action sequences, DigiSynchronize
+     *  and the container processor workers is measured:
+     *  - wall time and CPU time of the calling thread,
+     *  - number of calls,
+     *  - number of items in the input container (container processors only),
+     *  - bytes allocated from the event arena by the calling thread during the call,
+     *    including nested actions executed by the same thread. Allocations of
+     *    workers running on other threads are accounted to these workers.
+     *
+     *  Measurements are accumulated per action and per thread without locking.
+     *  At the end of DigiKernel::run() a summary table is printed and, if the
+     *  kernel property "profileTrace" is set, the calls are written to a
+     *  JSON file in the Chrome trace event format (chrome://tracing, perfetto).
+     *
+     *  If the profiler is disabled a measurement costs one pointer check.
+     *
+     *  Usage:
+     *  {
+     *    DigiProfiler::scope_t scope(action, context);
+     *    action.execute(context);
+     *  }
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiProfiler   {
+    public:
+      using clock_t = std::chrono::steady_clock;
+
+      /// Accumulated measurements of one action in one thread
+      class counter_t   {
+      public:
+        std::size_t calls  { 0 };
+        std::size_t items  { 0 };
+        std::size_t bytes  { 0 };
+        double      wall   { 0e0 };
+        double      cpu    { 0e0 };
+      };
+      /// Single call recorded for the trace
+      class trace_t   {
+      public:
+        const DigiAction* action  { nullptr };
+        int               event   { 0 };
+        std::int64_t      start   { 0 };
+        std::int64_t      length  { 0 };
+        std::size_t       items   { 0 };
+      };
+      /// Measurements of one thread
+      class thread_data_t   {
+      public:
+        std::size_t                              thread  { 0 };
+        std::map<const DigiAction*, counter_t>   counters  { };
+        std::vector<trace_t>                     traces    { };
+      };
+
+      /// Measurement of a single action call
+      class scope_t   {
+        DigiProfiler*      profiler  { nullptr };
+        const DigiAction*  action    { nullptr };
+        const DigiContext* context   { nullptr };
+        clock_t::time_point start    { };
+        double             cpu       { 0e0 };
+        std::size_t        bytes     { 0 };
+        std::size_t        items     { 0 };
+        /// Start the measurement
+        void begin();
+        /// Stop the measurement and record the result
+        void end();
+      public:
+        /// Initializing constructor: starts the measurement if the profiler of the kernel is enabled
+        scope_t(const DigiAction& act, const DigiContext& ctxt, std::size_t num_items = 0);
+        /// Inhibit copy constructor
+        scope_t(const scope_t& copy) = delete;
+        /// Inhibit copy assignment
+        scope_t& operator=(const scope_t& copy) = delete;
+        /// Default destructor: stops the measurement
+        ~scope_t()   {
+          if ( profiler ) end();
+        }
+      };
+
+    protected:
+      /// Lock to protect the thread data list
+      mutable std::mutex           m_lock;
+      /// Measurements of all threads
+      std::vector<std::unique_ptr<thread_data_t> > m_threads;
+      /// Start time of the profiling
+      clock_t::time_point          m_start;
+      /// Unique identifier of this profiler instance (and run)
+      std::size_t                  m_id         { 0 };
+      /// Maximal number of recorded trace entries per thread (0: no trace)
+      std::size_t                  m_trace_limit  { 0 };
+
+      /// Access the measurements of the current thread
+      thread_data_t& thread_data();
+
+    public:
+      /// Initializing constructor
+      DigiProfiler(std::size_t trace_limit);
+      /// Inhibit copy constructor
+      DigiProfiler(const DigiProfiler& copy) = delete;
+      /// Inhibit copy assignment
+      DigiProfiler& operator=(const DigiProfiler& copy) = delete;
+      /// Default destructor
+      ~DigiProfiler();
+
+      /// Clear all measurements and restart
+      void reset(std::size_t trace_limit);
+      /// Record one action call
+      void record(const DigiAction& action, const DigiContext& context,
+                  clock_t::time_point start, clock_t::time_point stop,
+                  double cpu, std::size_t items, std::size_t bytes);
+      /// Print the summary table of all actions
+      void print_summary()  const;
+      /// Write the recorded calls in the Chrome trace event format
+      bool write_trace(const std::string& file_name)  const;
+      /// CPU time of the calling thread in seconds
+      static double thread_cpu_time();
+    };
+
+    /// Initializing constructor: starts the measurement if the profiler of the kernel is enabled
+    inline DigiProfiler::scope_t::scope_t(const DigiAction& act, const DigiContext& ctxt, std::size_t num_items)
+      : profiler(ctxt.kernel.profiler()), action(&act), context(&ctxt), items(num_items)
+    {
+      if ( profiler ) begin();
+    }
+  }    // End namespace digi
+}      // End namespace dd4hep
+#endif // DDDIGI_DIGIPROFILER_H
@@ -34,6 +34,17 @@ namespace dd4hep {
 
     /// Base class for input actions to the digitization using ROOT
     /**
+     *  Read-ahead:
+     *  If the property "prefetch" is set to a value K > 0, a dedicated reader
+     *  thread reads and decompresses the next K entries of the input tree
+     *  into a bounded queue. The event actions only pop the decoded objects
+     *  from the queue and convert them without taking the global I/O lock.
+     *  The reader thread itself still serializes with other ROOT I/O
+     *  using the global I/O lock.
+     *
+     *  The TTreeCache size can be set with the property "cache_size" [bytes].
+     *  Implicit multi-threading for the decompression of the branches is enabled
+     *  with the property "implicit_mt".
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -50,18 +61,28 @@ namespace dd4hep {
 	Key          key;
 	TBranch&     branch;
 	TClass&      clazz;
+        /// Branch address used by the read-ahead thread
+        void*        object { nullptr };
         container_t(Key k, TBranch& b, TClass& c) : key(std::move(k)), branch(b), clazz(c) {}
       };
       class work_t   {
       public:
 	DataSegment& segment;
 	container_t& container;
+        /// Object read from the branch
+        void*        object;
       };
 
 
     protected:
       /// Connection parameters to the "current" input source
       mutable std::unique_ptr<internals_t> imp;
+      /// Property: Number of entries to be read ahead by a dedicated thread (0: synchronous reading)
+      int                                  m_prefetch     { 0 };
+      /// Property: Size of the TTreeCache in bytes (0: ROOT default)
+      long                                 m_cache_size   { 0 };
+      /// Property: Enable ROOT implicit multi-threading to decompress the branches
+      bool                                 m_implicit_mt  { false };
 
     protected:
       /// Define standard assignments and constructors
@@ -14,9 +14,12 @@
 #define DDDIGI_DIGIRANDOMGENERATOR_H
 
 /// Framework include files
+#include <DDDigi/DigiPhiloxEngine.h>
 
 /// C/C++ include files
 #include <functional>
+#include <cstdint>
+#include <cstddef>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -24,6 +27,9 @@ namespace dd4hep {
   /// Namespace for the Digitization part of the AIDA detector description toolkit
   namespace digi {
 
+    /// Forward declarations
+    class DigiCellRandom;
+
     /// Generic generator source with a random distribution
     /**
      *  Generate random numbers according to a given distribution
@@ -45,6 +51,25 @@ namespace dd4hep {
      *  I know this is not nice, but I did not see any other way to overcome
      *  the virtualization mechanism
      * 
+     *  Bulk generation:
+     *  ================
+     *  The fill_xxx functions generate a whole buffer of random numbers
+     *  at once. If the function object 'batch' is set (by default the kernel
+     *  uses a counter based engine: DigiPhiloxEngine), the uniform numbers
+     *  are produced by one call for the entire buffer and the
+     *  transformations are applied in tight loops without calls through
+     *  the std::function object for every number.
+     *  The bulk functions do not necessarily use the same algorithms
+     *  as the single shot functions, the results are statistically
+     *  equivalent, but not identical.
+     *
+     *  Reproducible streams:
+     *  =====================
+     *  cell_stream(...) returns a generator keyed by (seed, run, input, cell, processor).
+     *  'input' identifies the input data of the event (see DigiEvent::input_identity).
+     *  The numbers do neither depend on the order in which cells are processed
+     *  nor on the event number the input was assigned to. Hence results are
+     *  identical for any number of threads.
      *
      *  \author  M.Frank
      *  \version 1.0
@@ -53,6 +78,12 @@ namespace dd4hep {
     class DigiRandomGenerator {
     public:
       std::function<double()>  engine;
+      /// Optional bulk source of uniform random numbers in ]0,1[
+      std::function<void(double*, std::size_t)>  batch;
+      /// Seed of the reproducible random streams
+      uint64_t                 stream_seed  { 0 };
+      /// Run number keying the reproducible random streams
+      uint64_t                 stream_run   { 0 };
     public:
       /// Initializing constructor
       DigiRandomGenerator() = default;
@@ -71,7 +102,85 @@ namespace dd4hep {
       void   rannor(double& a, double& b)   const;
       void   sphere(double& x, double& y, double& z, double r)   const;
       void   circle(double &x, double &y, double r)  const;
+
+      /// Fill buffer with uniform random numbers in [x1, x2]
+      void   fill_uniform(double* buffer, std::size_t count, double x1 = 0.0, double x2 = 1.0)  const;
+      /// Fill buffer with exponentially distributed random numbers
+      void   fill_exponential(double* buffer, std::size_t count, double tau)  const;
+      /// Fill buffer with gaussian random numbers (Box-Muller)
+      void   fill_gaussian(double* buffer, std::size_t count, double mean = 0.0, double sigma = 1.0)  const;
+      /// Fill buffer with landau distributed random numbers
+      void   fill_landau(double* buffer, std::size_t count, double mean = 0.0, double sigma = 1.0)  const;
+      /// Fill buffer with poisson distributed random numbers
+      void   fill_poisson(double* buffer, std::size_t count, double mean)  const;
+
+      /// Reproducible random stream of a cell keyed by (seed, run, input, cell, processor)
+      DigiCellRandom cell_stream(uint64_t input, uint64_t cell, uint64_t processor)  const;
     };
+
+    /// Counter based random stream of a single cell
+    /**
+     *  The numbers are computed from the counter (cell, input, block-number)
+     *  with a key derived from seed, run, input and processor identifier
+     *  using the Philox-4x32-10 bijection (see DigiPhiloxEngine).
+     *  All distributions of the DigiRandomGenerator base are available.
+     *
+     *  The object is bound to itself: it can neither be copied nor moved.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiCellRandom : public DigiRandomGenerator   {
+    protected:
+      /// Philox key: seed, run, input and processor
+      uint64_t  m_key        { 0 };
+      /// Cell identifier
+      uint64_t  m_cell       { 0 };
+      /// Low word of the input identity
+      uint32_t  m_event      { 0 };
+      /// Next counter block
+      uint32_t  m_block      { 0 };
+      /// Number of buffered values
+      uint32_t  m_available  { 0 };
+      /// Buffered values of the last block
+      double    m_buffer[2]  { 0e0, 0e0 };
+
+    public:
+      /// Initializing constructor
+      DigiCellRandom(uint64_t key, uint32_t event, uint64_t cell);
+      /// Initializing constructor: stream of a cell keyed by (seed, run, input, cell, processor)
+      DigiCellRandom(const DigiRandomGenerator& generator, uint64_t input, uint64_t cell, uint64_t processor);
+      /// Inhibit move constructor
+      DigiCellRandom(DigiCellRandom&& copy) = delete;
+      /// Inhibit copy constructor
+      DigiCellRandom(const DigiCellRandom& copy) = delete;
+      /// Inhibit move assignment
+      DigiCellRandom& operator=(DigiCellRandom&& copy) = delete;
+      /// Inhibit copy assignment
+      DigiCellRandom& operator=(const DigiCellRandom& copy) = delete;
+      /// Default destructor
+      virtual ~DigiCellRandom() = default;
+      /// Next uniform random number of the stream in ]0,1[
+      double next();
+    };
+
+    /// Next uniform random number of the stream in ]0,1[
+    inline double DigiCellRandom::next()   {
+      if ( 0 == m_available )   {
+        DigiPhiloxEngine::block_t ctr { { uint32_t(m_cell), uint32_t(m_cell >> 32), m_event, m_block++ } };
+        DigiPhiloxEngine::block_t r = DigiPhiloxEngine::philox(ctr, m_key);
+        m_buffer[0] = DigiPhiloxEngine::to_double(r.v[0], r.v[1]);
+        m_buffer[1] = DigiPhiloxEngine::to_double(r.v[2], r.v[3]);
+        m_available = 2;
+      }
+      return m_buffer[2 - m_available--];
+    }
+
+    /// Reproducible random stream of a cell keyed by (seed, run, input, cell, processor)
+    inline DigiCellRandom DigiRandomGenerator::cell_stream(uint64_t input, uint64_t cell, uint64_t processor)  const   {
+      return DigiCellRandom(*this, input, cell, processor);
+    }
   }    // End namespace digi
 }      // End namespace dd4hep
 #endif // DDDIGI_DIGIRANDOMGENERATOR_H
@@ -114,6 +114,7 @@ namespace dd4hep {
       using worker_t    = DigiParallelWorker<processor_t, work_t, segment_t>;
       using workers_t   = DigiParallelWorkers<worker_t>;
       friend class DigiParallelWorker<processor_t, work_t, segment_t>;
+      class slice_call_t;
 
     protected:
 
@@ -128,6 +129,8 @@ namespace dd4hep {
       bool                 m_parallel          { false };
       /// Property: Flag if processors should be shared
       bool                 m_share_processor   { true };
+      /// Property: Partition the input in one pass and hand each worker only its slice
+      bool                 m_partition         { false };
 
       /**  Member variables                           */
       /// Data keys from the readout collection names
@@ -150,6 +153,8 @@ namespace dd4hep {
 
       /// Initialization function
       void initialize();
+      /// Partition the deposits by split identifier and let each worker process its slice
+      template <typename T> void process_slices(context_t& context, work_t& work, T& container)  const;
 
     public:
       /// Adopt new parallel worker handling single split identifier
@@ -68,6 +68,15 @@ namespace dd4hep {
       virtual void initialize();
       /// Callback to read event signalprocessor
       virtual double operator()(DigiCellContext& context)  const = 0;
+      /// Bulk callback: compute the values for 'count' cells with the given signals
+      /** Default implementation calls the single cell callback for every cell.
+       *  Sub-classes should override it using the bulk random number interface.
+       */
+      virtual void generate(DigiContext& context, const double* signals, double* values, std::size_t count)  const;
+      /// Apply the signal processor to all deposits of a container. Returns the number of modified entries
+      std::size_t apply(DigiContext& context, DepositVector& deposits)  const;
+      /// Apply the signal processor to all entries of a detector response. Returns the number of modified entries
+      std::size_t apply(DigiContext& context, DetectorResponse& response)  const;
     };
   }    // End namespace digi
 }      // End namespace dd4hep
@@ -44,6 +44,8 @@ namespace dd4hep {
       virtual ~DigiExponentialNoise();
       /// Callback to read event exponentialnoise
       virtual double operator()(DigiCellContext& context)  const  override;
+      /// Bulk callback to generate exponential noise for 'count' cells
+      virtual void generate(DigiContext& context, const double* signals, double* values, std::size_t count)  const  override;
     };
   }    // End namespace digi
 }      // End namespace dd4hep
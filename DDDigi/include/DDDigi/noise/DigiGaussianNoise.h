@@ -51,6 +51,8 @@ namespace dd4hep {
       virtual ~DigiGaussianNoise();
       /// Callback to read event gaussiannoise
       virtual double operator()(DigiCellContext& context)  const  override;
+      /// Bulk callback to generate gaussian noise for 'count' cells
+      virtual void generate(DigiContext& context, const double* signals, double* values, std::size_t count)  const  override;
     };
   }    // End namespace digi
 }      // End namespace dd4hep
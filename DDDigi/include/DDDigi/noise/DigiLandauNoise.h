@@ -51,6 +51,8 @@ namespace dd4hep {
       virtual ~DigiLandauNoise();
       /// Callback to read event landaunoise
       virtual double operator()(DigiCellContext& context)  const  override;
+      /// Bulk callback to generate landau noise for 'count' cells
+      virtual void generate(DigiContext& context, const double* signals, double* values, std::size_t count)  const  override;
     };
   }    // End namespace digi
 }      // End namespace dd4hep
@@ -49,6 +49,8 @@ namespace dd4hep {
       virtual ~DigiPoissonNoise();
       /// Callback to read event poissonnoise
       virtual double operator()(DigiCellContext& context)  const  override;
+      /// Bulk callback to generate poisson noise for 'count' cells
+      virtual void generate(DigiContext& context, const double* signals, double* values, std::size_t count)  const  override;
     };
   }    // End namespace digi
 }      // End namespace dd4hep
@@ -159,6 +159,11 @@ namespace dd4hep {
       template <typename ENGINE> void normalize(ENGINE& engine, size_t shots=10000);
       /// Retrieve the next random number of the sequence
       template <typename ENGINE> double operator()(ENGINE& engine);
+      /// Transform a buffer of normal distributed white noise (mean 0, sigma 1) in place to 1/f**alpha noise
+      /** Allows to generate the white noise in bulk, e.g. with DigiRandomGenerator::fill_gaussian
+       *  The filter is recursive: the buffer is the continuation of the sequence.
+       */
+      void transform(double* values, std::size_t count);
     };
 
     /// Retrieve the next random number of the sequence
@@ -84,8 +84,8 @@ namespace dd4hep {
       virtual ~Digi2ROOTProcessor() = default;
 
       void convert_particles(DigiContext& context, ParticleMapping& cont)  const;
-      void convert_deposits(DigiContext& context, DepositVector& cont, const predicate_t& predicate)  const;
-      void convert_deposits(DigiContext& context, DepositMapping& cont, const predicate_t& predicate)  const;
+      template <typename T>
+      void convert_deposits(DigiContext& context, T& cont, const predicate_t& predicate)  const;
       void convert_history(DigiContext& context, DepositsHistory& cont, work_t& work, const predicate_t& predicate)  const;
 
       /// Main functional callback
@@ -392,25 +392,9 @@ namespace dd4hep {
            ctxt.event->id(), cont.name.c_str(), vec->size(), cont.key.mask());
     }
 
+    template <typename T>
     void Digi2ROOTProcessor::convert_deposits(DigiContext&       ctxt,
-					      DepositMapping&    cont,
-					      const predicate_t& predicate)  const
-    {
-      auto& coll = internals->get_collection(cont);
-      auto* vec  = coll.get<persistent_deposits_t>();
-      vec->clear();
-      vec->reserve(cont.size());
-      for ( auto& depo : cont )   {
-	if ( predicate(depo) )   {
-	  vec->emplace_back(std::make_pair(depo.first, &depo.second));
-	}
-      }
-      info("%s+++ %-24s added %6ld entries from mask: %04X",
-           ctxt.event->id(), cont.name.c_str(), vec->size(), cont.key.mask());
-    }
-
-    void Digi2ROOTProcessor::convert_deposits(DigiContext&       ctxt,
-					      DepositVector&     cont,
+					      T&                 cont,
 					      const predicate_t& predicate)  const
     {
       auto& coll = internals->get_collection(cont);
@@ -444,6 +428,8 @@ namespace dd4hep {
         convert_deposits(ctxt, *m, predicate);
       else if ( auto* v = work.get_input<DepositVector>() )
         convert_deposits(ctxt, *v, predicate);
+      else if ( auto* hm = work.get_input<DepositHashMapping>() )
+        convert_deposits(ctxt, *hm, predicate);
       else if ( auto* h = work.get_input<DepositsHistory>() )
         convert_history(ctxt, *h, work, predicate);
       else
@@ -176,6 +176,7 @@ namespace dd4hep {
 	  auto sec = parent->input_section();
 	  stream->openFile(fname);
 	  auto source = std::make_unique<source_t>(sec, std::move(stream));
+	  source->input_index = m_curr_input;
 	  parent->info("+++ Opened EDM4HEP input file %s.", fname.c_str());
 	  parent->onOpenFile(*source);
 	  return source;
@@ -306,6 +307,7 @@ namespace dd4hep {
       /// Add frame to segment: Need to keep reference of the input data!
       std::any frm(std::move(frame));
       segment.emplace_any(Key("podio_frame", input_mask()), std::move(frm));
+      record_input(*event, *internals->m_source, internals->m_source->entry);
       info("%s+++ Read event ", event->id());
     }
 
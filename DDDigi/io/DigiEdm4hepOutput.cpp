@@ -348,6 +348,8 @@ namespace dd4hep {
         convert_deposits(ctxt, *m, predicate);
       else if ( const auto* v = work.get_input<DepositVector>() )
         convert_deposits(ctxt, *v, predicate);
+      else if ( const auto* hm = work.get_input<DepositHashMapping>() )
+        convert_deposits(ctxt, *hm, predicate);
       else if ( const auto* h = work.get_input<DepositsHistory>() )
         convert_history(ctxt, *h, work, predicate);
       else
@@ -41,6 +41,18 @@ DECLARE_DIGIACTION_NS(dd4hep::digi,DigiLockedAction)
 //#include <DDDigi/DigiSignalProcessorSequence.h>
 // DECLARE_DIGISIGNALPROCESSOR_NS(dd4hep::digi,DigiSignalProcessorSequence)
 
+#include <DDDigi/noise/DigiGaussianNoise.h>
+DECLARE_DIGIACTION_NS(dd4hep::digi,DigiGaussianNoise)
+
+#include <DDDigi/noise/DigiLandauNoise.h>
+DECLARE_DIGIACTION_NS(dd4hep::digi,DigiLandauNoise)
+
+#include <DDDigi/noise/DigiPoissonNoise.h>
+DECLARE_DIGIACTION_NS(dd4hep::digi,DigiPoissonNoise)
+
+#include <DDDigi/noise/DigiExponentialNoise.h>
+DECLARE_DIGIACTION_NS(dd4hep::digi,DigiExponentialNoise)
+
 #include <DDDigi/DigiStoreDump.h>
 DECLARE_DIGIACTION_NS(dd4hep::digi,DigiStoreDump)
 
@@ -51,6 +63,9 @@ DECLARE_DIGIACTION_NS(dd4hep::digi,DigiAttenuatorSequence)
 #include <DDDigi/DigiContainerCombine.h>
 DECLARE_DIGIACTION_NS(dd4hep::digi,DigiContainerCombine)
 
+#include <DDDigi/DigiPileupInput.h>
+DECLARE_DIGIACTION_NS(dd4hep::digi,DigiPileupInput)
+
 #include <DDDigi/DigiContainerDrop.h>
 DECLARE_DIGIACTION_NS(dd4hep::digi,DigiContainerDrop)
 
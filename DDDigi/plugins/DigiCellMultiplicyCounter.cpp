@@ -50,6 +50,8 @@ namespace dd4hep {
 	  count_deposits(context.event->id(), *m);
 	else if ( const auto* v = work.get_input<DepositVector>() )
 	  count_deposits(context.event->id(), *v);
+	else if ( const auto* h = work.get_input<DepositHashMapping>() )
+	  count_deposits(context.event->id(), *h);
 	else
 	  except("Request to handle unknown data type: %s", work.input_type_name().c_str());
       }
@@ -0,0 +1,108 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DDDigi/DigiContainerProcessor.h>
+#include <DDDigi/DigiSignalProcessor.h>
+
+/// C/C++ include files
+#include <atomic>
+#include <vector>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    /// Actor to apply signal processors (e.g. noise sources) to whole containers
+    /**
+     *  The signal processors are adopted as tools of type 'DigiSignalProcessor'
+     *  and are applied in the order of adoption. Each processor handles a
+     *  DepositVector or a DetectorResponse in one bulk call, which
+     *  draws the random numbers of the entire container at once.
+     *  Segment predicates are not supported: all entries are processed.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiContainerSignalProcessor : public DigiContainerProcessor   {
+    protected:
+      /// Adopted signal processors
+      std::vector<DigiSignalProcessor*> m_processors;
+      /// Monitoring: number of processed entries
+      mutable std::atomic<std::size_t>  m_num_entries  { 0 };
+      /// Monitoring: number of modified entries
+      mutable std::atomic<std::size_t>  m_num_updated  { 0 };
+
+    protected:
+      /// Define standard assignments and constructors
+      DDDIGI_DEFINE_ACTION_CONSTRUCTORS(DigiContainerSignalProcessor);
+
+      /// Apply all signal processors to one container
+      template <typename T> void apply(context_t& context, T& cont)  const   {
+        std::size_t updated = 0;
+        for( const auto* proc : m_processors )
+          updated += proc->apply(context, cont);
+        m_num_entries += cont.size();
+        m_num_updated += updated;
+        info("%s+++ %-32s Signal processing: %6ld entries, %ld processors, updated %6ld entries. mask: %04X",
+             context.event->id(), cont.name.c_str(), cont.size(), m_processors.size(), updated, cont.key.mask());
+      }
+
+    public:
+      /// Standard constructor
+      DigiContainerSignalProcessor(const DigiKernel& krnl, const std::string& nam)
+        : DigiContainerProcessor(krnl, nam)
+      {
+      }
+      /// Default destructor
+      virtual ~DigiContainerSignalProcessor()   {
+        info("+++ Signal processing: %ld entries processed, %ld entries updated.",
+             m_num_entries.load(), m_num_updated.load());
+        for( auto* proc : m_processors )
+          proc->release();
+        m_processors.clear();
+      }
+      /// Adopt signal processors as tools
+      virtual void adopt_tool(DigiAction* action, const std::string& typ)  override   {
+        auto* proc = dynamic_cast<DigiSignalProcessor*>(action);
+        if ( !proc )   {
+          except("+++ adopt_tool: Tool %s of type %s is no signal processor.",
+                 action ? action->c_name() : "(null)", typ.c_str());
+        }
+        proc->addRef();
+        proc->initialize();
+        m_processors.emplace_back(proc);
+      }
+      /// Main functional callback
+      virtual void execute(context_t& context, work_t& work, const predicate_t& predicate)  const override  {
+        if ( predicate.segmentation )   {
+          except("+++ Segment predicates are not supported by signal processing of %s.",
+                 work.input_type_name().c_str());
+        }
+        if ( auto* v = work.get_input<DepositVector>() )
+          apply(context, *v);
+        else if ( auto* r = work.get_input<DetectorResponse>() )
+          apply(context, *r);
+        else
+          except("%s+++ Request to handle unknown data type: %s",
+                 context.event->id(), work.input_type_name().c_str());
+      }
+    };
+  }    // End namespace digi
+}      // End namespace dd4hep
+//        Factory definition
+#include <DDDigi/DigiFactories.h>
+DECLARE_DIGIACTION_NS(dd4hep::digi,DigiContainerSignalProcessor)
@@ -0,0 +1,94 @@
+//==========================================================================
+//  AIDA Detector description implementation 
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DDDigi/DigiContext.h>
+#include <DDDigi/DigiContainerProcessor.h>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    /// Actor to convert energy deposits to and from the column layout
+    /** Actor to convert energy deposits to and from the column layout
+     *
+     *  Deposit vectors and mappings are converted to DepositColumns,
+     *  which may then be processed by the column handlers of the
+     *  deposit processors (energy cut, zero suppression, smearing, ADC response).
+     *  DepositColumns are converted back to a DepositVector for processors and
+     *  output actions, which do not support the column layout.
+     *
+     *  The selected deposits are placed in the output container
+     *  supplied by the arguments.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiDepositColumnCreator : public DigiContainerProcessor   {
+    public:
+      /// Standard constructor
+      using DigiContainerProcessor::DigiContainerProcessor;
+
+      template <typename OUT, typename T> void
+      create_deposits(const char* tag, OUT&& out, const T& cont, work_t& work, const predicate_t& predicate)  const  {
+	std::size_t start = out.size();
+	out.reserve(start + cont.size());
+	for( const auto& dep : cont )   {
+	  if ( predicate(dep) )    {
+	    EnergyDeposit depo(dep.second);
+	    out.emplace(dep.first, std::move(depo));
+	  }
+	}
+	std::size_t end = out.size();
+	work.environ.output.data.put(out.key, std::move(out));
+	info("%s+++ %-32s added %6ld entries (now: %6ld) from mask: %04X to mask: %04X",
+	     tag, cont.name.c_str(), end-start, end, cont.key.mask(), out.key.mask());
+      }
+      void create_deposits(const char* tag, DepositVector&& out, const DepositColumns& cont, work_t& work, const predicate_t& predicate)  const  {
+	std::vector<unsigned char> selection;
+	predicate.select(cont, selection);
+	std::size_t start = out.size();
+	out.reserve(start + cont.size());
+	for( std::size_t i = 0; i < cont.size(); ++i )   {
+	  if ( selection[i] )    {
+	    out.emplace(cont.cell[i], cont.at(i));
+	  }
+	}
+	std::size_t end = out.size();
+	work.environ.output.data.put(out.key, std::move(out));
+	info("%s+++ %-32s added %6ld entries (now: %6ld) from mask: %04X to mask: %04X",
+	     tag, cont.name.c_str(), end-start, end, cont.key.mask(), out.key.mask());
+      }
+      /// Main functional callback
+      virtual void execute(DigiContext& context, work_t& work, const predicate_t& predicate)  const override final  {
+	const char* tag = context.event->id();
+	Key::mask_type mask = work.environ.output.mask;
+	if ( const auto* v = work.get_input<DepositVector>() )
+	  create_deposits(tag, DepositColumns(v->name, mask, v->data_type), *v, work, predicate);
+	else if ( const auto* m = work.get_input<DepositMapping>() )
+	  create_deposits(tag, DepositColumns(m->name, mask, m->data_type), *m, work, predicate);
+	else if ( const auto* h = work.get_input<DepositHashMapping>() )
+	  create_deposits(tag, DepositColumns(h->name, mask, h->data_type), *h, work, predicate);
+	else if ( const auto* c = work.get_input<DepositColumns>() )
+	  create_deposits(tag, DepositVector(c->name, mask, c->data_type), *c, work, predicate);
+	else
+	  except("Request to handle unknown data type: %s", work.input_type_name().c_str());
+      }
+    };
+  }    // End namespace digi
+}      // End namespace dd4hep
+/// Factory instantiation:
+#include <DDDigi/DigiFactories.h>
+DECLARE_DIGIACTION_NS(dd4hep::digi,DigiDepositColumnCreator)
@@ -61,6 +61,12 @@ namespace dd4hep {
           }
           killed = total - m->size();
         }
+        else if ( auto* h = work.get_input<DepositHashMapping>() )   {
+          total  = h->size();
+          killed = h->remove_if([](const DepositHashMapping::value_type& e)  {
+            return (e.second.flag&EnergyDeposit::KILLED) != 0;
+          });
+        }
         else   {
           except("Request to handle unknown data type: %s", work.input_type_name().c_str());
         }
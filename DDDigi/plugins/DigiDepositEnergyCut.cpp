@@ -58,12 +58,33 @@ namespace dd4hep {
              context.event->id(), cont.name.c_str(), dropped, cont.size(), cont.key.mask());
       }
 
+      /// Energy cut on deposit columns: branch-free loop over the energy and flag columns
+      void cut_energy_columns(context_t& context, DepositColumns& cont, work_t& /* work */, const predicate_t& predicate)  const  {
+        std::vector<unsigned char> selection;
+        predicate.select(cont, selection);
+        const std::size_t    num_rows = cont.size();
+        const double         cutoff   = m_cutoff;
+        const double*        deposit  = cont.deposit.data();
+        const unsigned char* selected = selection.data();
+        uint64_t*            flag     = cont.flag.data();
+        std::size_t dropped = 0UL;
+        for( std::size_t i = 0; i < num_rows; ++i )   {
+          uint64_t kill = selected[i] & uint64_t(deposit[i] < cutoff);
+          flag[i] |= kill * EnergyDeposit::KILLED;
+          dropped += kill;
+        }
+        if ( m_monitor ) m_monitor->count_shift(cont.size(), dropped);
+        info("%s+++ %-32s dropped %6ld out of %6ld entries from mask: %04X",
+             context.event->id(), cont.name.c_str(), dropped, cont.size(), cont.key.mask());
+      }
+
       /// Standard constructor
       DigiDepositEnergyCut(const DigiKernel& krnl, const std::string& nam)
         : DigiDepositsProcessor(krnl, nam)
       {
         declareProperty("deposit_cutoff", m_cutoff);
         DEPOSIT_PROCESSOR_BIND_HANDLERS(DigiDepositEnergyCut::cut_energy);
+        DEPOSIT_PROCESSOR_BIND_COLUMN_HANDLER(DigiDepositEnergyCut::cut_energy_columns);
       }
     };
   }    // End namespace digi
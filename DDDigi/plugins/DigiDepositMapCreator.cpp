@@ -31,18 +31,24 @@ namespace dd4hep {
      *  \ingroup DD4HEP_DIGITIZATION
      */
     class DigiDepositMapCreator : public DigiContainerProcessor   {
+    protected:
+      /// Property: Create a hashed mapping (DepositHashMapping) instead of a DepositMapping
+      bool m_hashed  { false };
+
     public:
       /// Standard constructor
-      using DigiContainerProcessor::DigiContainerProcessor;
+      DigiDepositMapCreator(const kernel_t& krnl, const std::string& nam)
+        : DigiContainerProcessor(krnl, nam)
+      {
+        declareProperty("hashed", m_hashed);
+      }
 
-      template <typename T> void
-      create_deposits(const char* tag, const T& cont, work_t& work, const predicate_t& predicate)  const  {
-	Key key(cont.name, work.environ.output.mask);
-	DepositMapping m(cont.name, work.environ.output.mask, cont.data_type);
+      template <typename OUT, typename T> void
+      create_deposits(const char* tag, OUT&& m, const T& cont, work_t& work, const predicate_t& predicate)  const  {
 	std::size_t start = m.size();
 	for( const auto& dep : cont )   {
 	  if ( predicate(dep) )    {
-	    m.data.emplace(dep.first, EnergyDeposit());
+	    m.emplace(dep.first, EnergyDeposit());
 	  }
 	}
 	std::size_t end   = m.size();
@@ -50,12 +56,24 @@ namespace dd4hep {
 	info("%s+++ %-32s added %6ld entries (now: %6ld) from mask: %04X to mask: %04X",
 	     tag, cont.name.c_str(), end-start, end, cont.key.mask(), m.key.mask());
       }
+      template <typename T> void
+      create_deposits(DigiContext& context, const T& cont, work_t& work, const predicate_t& predicate)  const  {
+	const char* tag = context.event->id();
+	Key::mask_type mask = work.environ.output.mask;
+	if ( m_hashed )
+	  create_deposits(tag, DepositHashMapping(cont.name, mask, cont.data_type), cont, work, predicate);
+	else
+	  create_deposits(tag, DepositMapping(cont.name, mask, cont.data_type, context.event->memory_resource()),
+			  cont, work, predicate);
+      }
       /// Main functional callback
       virtual void execute(DigiContext& context, work_t& work, const predicate_t& predicate)  const override final  {
 	if ( const auto* m = work.get_input<DepositMapping>() )
-	  create_deposits(context.event->id(), *m, work, predicate);
+	  create_deposits(context, *m, work, predicate);
 	else if ( const auto* v = work.get_input<DepositVector>() )
-	  create_deposits(context.event->id(), *v, work, predicate);
+	  create_deposits(context, *v, work, predicate);
+	else if ( const auto* h = work.get_input<DepositHashMapping>() )
+	  create_deposits(context, *h, work, predicate);
 	else
 	  except("Request to handle unknown data type: %s", work.input_type_name().c_str());
       }
@@ -16,7 +16,9 @@
 #include <DD4hep/DD4hepUnits.h>
 
 /// C/C++ include files
+#include <iterator>
 #include <limits>
+#include <vector>
 
 /// Namespace for the AIDA detector description toolkit
 namespace dd4hep {
@@ -43,16 +45,28 @@ namespace dd4hep {
       template <typename T> void
       create_noise(DigiContext& context, T& cont, work_t& /* work */, const predicate_t& predicate)  const  {
         auto& random = context.randomGenerator();
+        std::vector<std::size_t> selected;
+        std::size_t sequence = 0UL;
+        selected.reserve(cont.size());
+        for( const auto& dep : cont )  {
+          if ( predicate(dep) ) selected.emplace_back(sequence);
+          ++sequence;
+        }
+        /// Generate the noise for all selected deposits in one go
+        std::vector<double> noise(selected.size());
+        if ( !m_cell_random )
+          random.fill_gaussian(noise.data(), noise.size(), m_mean, m_sigma);
         std::size_t updated = 0UL;
-        for( auto& dep : cont )  {
-          if ( predicate(dep) )  {
-            int flag = EnergyDeposit::DEPOSIT_NOISE;
-            double delta_E = random.gaussian(m_mean, m_sigma);
-            if ( m_monitor ) m_monitor->energy_shift(dep, delta_E);
-            dep.second.deposit += delta_E;
-            dep.second.flag |= flag;
-            ++updated;
-          }
+        auto dep = cont.begin();
+        for( std::size_t i = 0; i < selected.size(); ++i )  {
+          std::advance(dep, selected[i] - (i == 0 ? 0 : selected[i-1]));
+          if ( m_cell_random )
+            noise[i] = this->cell_random(context, cont.key, dep->first, selected[i]+1).gaussian(m_mean, m_sigma);
+          double delta_E = noise[i];
+          if ( m_monitor ) m_monitor->energy_shift(*dep, delta_E);
+          dep->second.deposit += delta_E;
+          dep->second.flag |= EnergyDeposit::DEPOSIT_NOISE;
+          ++updated;
         }
         info("%s+++ %-32s Noise on signal: %6ld entries, updated %6ld entries. mask: %04X",
              context.event->id(), cont.name.c_str(), cont.size(), updated, cont.key.mask());
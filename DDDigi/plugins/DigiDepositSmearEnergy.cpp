@@ -16,6 +16,7 @@
 #include <DD4hep/DD4hepUnits.h>
 
 /// C/C++ include files
+#include <cmath>
 #include <limits>
 
 /// Namespace for the AIDA detector description toolkit
@@ -96,17 +97,20 @@ namespace dd4hep {
         declareProperty("ionization_fluctuation",     m_ionization_fluctuation = false);
         declareProperty("modify_energy",              m_modify_energy = true);
         DEPOSIT_PROCESSOR_BIND_HANDLERS(DigiDepositSmearEnergy::smear);
+        DEPOSIT_PROCESSOR_BIND_COLUMN_HANDLER(DigiDepositSmearEnergy::smear_columns);
       }
 
       /// Create deposit mapping with updates on same cellIDs
       template <typename T> void
       smear(DigiContext& context, T& cont, work_t& /* work */, const predicate_t& predicate)  const  {
-        auto& random = context.randomGenerator();
-        std::size_t updated = 0UL;
+        std::size_t updated = 0UL, sequence = 0UL;
 
         for( auto& dep : cont )    {
+          ++sequence;
           if ( predicate(dep) )   {
             CellID cell = dep.first;
+            std::optional<DigiCellRandom> cell_rndm;
+            auto& random = this->random_generator(context, cell_rndm, cont.key, cell, sequence);
             EnergyDeposit& depo = dep.second;
             double deposit = depo.deposit;
             double delta_E = 0e0;
@@ -151,8 +155,104 @@ namespace dd4hep {
         info("%s+++ %-32s Smear energy: updated %6ld out of %6ld entries from mask: %04X",
              context.event->id(), cont.name.c_str(), updated, cont.size(), cont.key.mask());
       }
+
+      /// Smear deposit columns
+      /**
+       *  The energy dependent resolutions of all rows are computed first in a
+       *  vectorizable loop. The random numbers are drawn per row in the order
+       *  of the scalar handler and only for resolutions above threshold:
+       *  rows with zero or negative deposits get no intrinsic fluctuation.
+       *  With reproducible random streams the results are identical to the
+       *  ones obtained with the other deposit containers. Without, the
+       *  gaussian numbers of all rows are requested with one bulk call.
+       */
+      void smear_columns(DigiContext& context, DepositColumns& cont, work_t& work, const predicate_t& predicate)  const;
     };
 
+    /// Smear deposit columns
+    inline void DigiDepositSmearEnergy::smear_columns(DigiContext& context, DepositColumns& cont, work_t& /* work */, const predicate_t& predicate)  const  {
+      constexpr static double eps = std::numeric_limits<double>::epsilon();
+      const std::size_t num_rows = cont.size();
+      const double sigma_instrument = m_instrumentation_resolution / dd4hep::GeV;
+      const bool   use_instrument   = sigma_instrument > eps;
+      std::vector<unsigned char> selection;
+      std::vector<double> sigma_systematic(num_rows);
+      std::vector<double> sigma_intrinsic(num_rows);
+      std::vector<double> delta(num_rows, 0e0);
+      std::size_t updated = 0UL;
+
+      predicate.select(cont, selection);
+      /// Vectorizable part: energy dependent resolutions of all rows
+      const double* deposit = cont.deposit.data();
+      for( std::size_t i = 0; i < num_rows; ++i )   {
+        double energy = deposit[i] / dd4hep::GeV;
+        sigma_systematic[i] = m_systematic_resolution * energy;
+        sigma_intrinsic[i]  = energy > 0e0 ? m_intrinsic_fluctuation * std::sqrt(energy) : 0e0;
+      }
+      if ( m_cell_random || m_ionization_fluctuation )   {
+        /// Per-row random streams (and poisson numbers) follow the order of the scalar handler
+        for( std::size_t i = 0; i < num_rows; ++i )   {
+          if ( selection[i] )   {
+            std::optional<DigiCellRandom> cell_rndm;
+            auto& random = this->random_generator(context, cell_rndm, cont.key, cont.cell[i], i+1);
+            double delta_E = 0e0;
+            if ( sigma_systematic[i] > eps )   {
+              delta_E += sigma_systematic[i] * random.gaussian(0e0, 1e0);
+            }
+            if ( sigma_intrinsic[i] > eps )   {
+              delta_E += sigma_intrinsic[i] * random.gaussian(0e0, 1e0);
+            }
+            if ( use_instrument )   {
+              delta_E += sigma_instrument * random.gaussian(0e0, 1e0);
+            }
+            if ( m_ionization_fluctuation )   {
+              double energy    = deposit[i] / dd4hep::GeV;
+              double num_pairs = energy / (m_pair_ionization_energy/dd4hep::GeV);
+              delta_E += energy * (random.poisson(num_pairs)/num_pairs);
+            }
+            delta[i] = delta_E * dd4hep::GeV;
+          }
+        }
+      }
+      else   {
+        /// One bulk request for the gaussian numbers of all selected rows
+        std::size_t num_draws = 0;
+        for( std::size_t i = 0; i < num_rows; ++i )   {
+          if ( selection[i] )
+            num_draws += (sigma_systematic[i] > eps) + (sigma_intrinsic[i] > eps) + use_instrument;
+        }
+        std::vector<double> gauss(num_draws);
+        if ( num_draws > 0 )   {
+          context.randomGenerator().fill_gaussian(gauss.data(), gauss.size(), 0e0, 1e0);
+        }
+        const double* g = gauss.data();
+        for( std::size_t i = 0; i < num_rows; ++i )   {
+          if ( selection[i] )   {
+            double delta_E = 0e0;
+            if ( sigma_systematic[i] > eps ) delta_E += sigma_systematic[i] * *g++;
+            if ( sigma_intrinsic[i]  > eps ) delta_E += sigma_intrinsic[i]  * *g++;
+            if ( use_instrument )            delta_E += sigma_instrument    * *g++;
+            delta[i] = delta_E * dd4hep::GeV;
+          }
+        }
+      }
+      for( std::size_t i = 0; i < num_rows; ++i )   {
+        if ( selection[i] )   {
+          cont.depositError[i] = delta[i];
+          if ( m_monitor )   {
+            m_monitor->energy_shift(predicate_t::deposit_t(cont.cell[i], cont.at(i)), delta[i]);
+          }
+          if ( m_modify_energy )   {
+            cont.deposit[i] += delta[i];
+            cont.flag[i]    |= EnergyDeposit::ENERGY_SMEARED;
+          }
+          ++updated;
+        }
+      }
+      info("%s+++ %-32s Smear energy: updated %6ld out of %6ld entries from mask: %04X",
+           context.event->id(), cont.name.c_str(), updated, cont.size(), cont.key.mask());
+    }
+
     /// Actor to only set energy error (as above, but with preset option
     /**
      *
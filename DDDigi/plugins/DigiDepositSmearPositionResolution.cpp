@@ -59,12 +59,14 @@ namespace dd4hep {
       template <typename T> void
       smear(DigiContext& context, T& cont, work_t& /* work */, const predicate_t& predicate)  const  {
         VolumeManager volMgr = m_kernel.detectorDescription().volumeManager();
-        auto& random = context.randomGenerator();
-        std::size_t updated = 0UL;
+        std::size_t updated = 0UL, sequence = 0UL;
 
         for( auto& dep : cont )    {
+          ++sequence;
           if ( predicate(dep) )   {
             CellID cell = dep.first;
+            std::optional<DigiCellRandom> cell_rndm;
+            auto& random = this->random_generator(context, cell_rndm, cont.key, cell, sequence);
             EnergyDeposit& depo = dep.second;
             auto*     ctxt = volMgr.lookupContext(cell);
             Position  local_pos = ctxt->worldToLocal(depo.position);
@@ -65,14 +65,16 @@ namespace dd4hep {
       template <typename T> void
       smear(DigiContext& context, T& cont, work_t& /* work */, const predicate_t& predicate)  const  {
         constexpr double eps = detail::numeric_epsilon;
-        auto& random = context.randomGenerator();
         const auto& ev = *(context.event);
-        std::size_t updated = 0UL;
+        std::size_t updated = 0UL, sequence = 0UL;
 
         VolumeManager volMgr = m_kernel.detectorDescription().volumeManager();
         for( auto& dep : cont )    {
+          ++sequence;
           if ( predicate(dep) )   {
             CellID cell = dep.first;
+            std::optional<DigiCellRandom> cell_rndm;
+            auto& random = this->random_generator(context, cell_rndm, cont.key, cell, sequence);
             EnergyDeposit& depo = dep.second;
             auto*     ctxt = volMgr.lookupContext(cell);
             Direction part_momentum = depo.history.average_particle_momentum(ev);
@@ -44,11 +44,14 @@ namespace dd4hep {
       /// Create deposit mapping with updates on same cellIDs
       template <typename T> void
       smear(DigiContext& context, T& cont, work_t& /* work */, const predicate_t& predicate)  const  {
-        auto& random = context.randomGenerator();
         std::size_t killed  = 0UL;
         std::size_t updated = 0UL;
+        std::size_t sequence = 0UL;
         for( auto& dep : cont )  {
+          ++sequence;
           if ( predicate(dep) )  {
+            std::optional<DigiCellRandom> cell_rndm;
+            auto& random = this->random_generator(context, cell_rndm, cont.key, dep.first, sequence);
             int flag = EnergyDeposit::TIME_SMEARED;
             double delta_T = m_resolution_time * random.gaussian();
             if ( delta_T < m_window_time.first || delta_T > m_window_time.second )   {
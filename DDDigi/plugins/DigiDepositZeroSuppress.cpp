@@ -57,12 +57,34 @@ namespace dd4hep {
         info("%s+++ %-32s Zero suppression: entries: %6ld handled: %6ld killed %6ld entries from mask: %04X",
              context.event->id(), cont.name.c_str(), cont.size(), handled, killed, cont.key.mask());
       }
+      /// Zero suppression of deposit columns: branch-free loop over the energy and flag columns
+      void handle_columns(DigiContext& context, DepositColumns& cont, work_t& /* work */, const predicate_t& predicate)  const  {
+        std::vector<unsigned char> selection;
+        predicate.select(cont, selection);
+        const std::size_t    num_rows  = cont.size();
+        const double         threshold = m_energy_threshold / dd4hep::GeV;
+        const double*        deposit   = cont.deposit.data();
+        const unsigned char* selected  = selection.data();
+        uint64_t*            flag      = cont.flag.data();
+        std::size_t killed  = 0UL;
+        std::size_t handled = 0UL;
+        for( std::size_t i = 0; i < num_rows; ++i )   {
+          uint64_t use  = selected[i];
+          uint64_t kill = use & uint64_t(deposit[i] < threshold);
+          flag[i] |= use * EnergyDeposit::ZERO_SUPPRESSED | kill * EnergyDeposit::KILLED;
+          killed  += kill;
+          handled += use;
+        }
+        info("%s+++ %-32s Zero suppression: entries: %6ld handled: %6ld killed %6ld entries from mask: %04X",
+             context.event->id(), cont.name.c_str(), cont.size(), handled, killed, cont.key.mask());
+      }
       /// Standard constructor
       DigiDepositZeroSuppress(const DigiKernel& krnl, const std::string& nam)
         : DigiDepositsProcessor(krnl, nam)
       {
         declareProperty("threshold", m_energy_threshold);
         DEPOSIT_PROCESSOR_BIND_HANDLERS(DigiDepositZeroSuppress::handle_deposits);
+        DEPOSIT_PROCESSOR_BIND_COLUMN_HANDLER(DigiDepositZeroSuppress::handle_columns);
       }
     };
   }    // End namespace digi
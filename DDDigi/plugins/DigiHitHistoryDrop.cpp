@@ -100,6 +100,11 @@ namespace dd4hep {
               num_drop_hit += ret.first;
               num_drop_particle += ret.second;
             }
+            else if ( DepositHashMapping* hm = std::any_cast<DepositHashMapping>(&i.second) )    {
+              auto ret = drop_history(*hm);
+              num_drop_hit += ret.first;
+              num_drop_particle += ret.second;
+            }
             else if( DetectorHistory* h = std::any_cast<DetectorHistory>(&i.second) )    {
               auto [nhit, npart] = drop_history(*h);
               num_drop_hit += nhit;
@@ -73,6 +73,8 @@ namespace dd4hep {
 	  move_deposits(tag, *m, delta, predicate);
 	else if ( auto* v = work.get_input<DepositVector>() )
 	  move_deposits(tag, *v, delta, predicate);
+	else if ( auto* h = work.get_input<DepositHashMapping>() )
+	  move_deposits(tag, *h, delta, predicate);
 	else if ( auto* p = work.get_input<ParticleMapping>() )
 	  move_particles(tag, *p, delta);
 	else
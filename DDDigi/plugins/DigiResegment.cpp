@@ -149,6 +149,8 @@ namespace dd4hep {
           resegment_deposits(*m, work, predicate);
         else if ( const auto* v = work.get_input<DepositVector>() )
           resegment_deposits(*v, work, predicate);
+        else if ( const auto* h = work.get_input<DepositHashMapping>() )
+          resegment_deposits(*h, work, predicate);
         else
           except("Request to handle unknown data type: %s", work.input_type_name().c_str());
       }
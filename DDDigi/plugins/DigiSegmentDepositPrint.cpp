@@ -63,6 +63,8 @@ namespace dd4hep {
           print(format, *m, predicate);
         else if ( const auto* v = work.get_input<DepositVector>() )
           print(format, *v, predicate);
+        else if ( const auto* h = work.get_input<DepositHashMapping>() )
+          print(format, *h, predicate);
         else
           error("+++ Request to dump an invalid container %s", Key::key_name(work.input.key).c_str());
       }
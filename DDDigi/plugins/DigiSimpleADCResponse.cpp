@@ -16,6 +16,7 @@
 #include <DDDigi/DigiSegmentSplitter.h>
 
 /// C/C++ include files
+#include <algorithm>
 #include <cmath>
 #include <limits>
 
@@ -43,6 +44,7 @@ namespace dd4hep {
         declareProperty("response_postfix", m_response_postfix);
         declareProperty("history_postfix",  m_history_postfix);
         DEPOSIT_PROCESSOR_BIND_HANDLERS(DigiSimpleADCResponse::emulate_adc);
+        DEPOSIT_PROCESSOR_BIND_COLUMN_HANDLER(DigiSimpleADCResponse::emulate_adc_columns);
       }
 
       /// Create container with ADC counts and register it to the output segment
@@ -66,6 +68,37 @@ namespace dd4hep {
              response_name.c_str(), response.size(), input.name.c_str(), input.size());
         work.environ.output.data.put(response.key, std::move(response));
       }
+
+      /// Create container with ADC counts from deposit columns: the ADC conversion is vectorized
+      void emulate_adc_columns(DigiContext& context, const DepositColumns& input, work_t& work, const predicate_t& predicate)  const  {
+        const char* tag = context.event->id();
+        std::string postfix = predicate.segmentation ? "."+predicate.segmentation->identifier(predicate.id) : std::string();
+        std::string response_name = input.name + postfix + m_response_postfix;
+        DetectorResponse response(response_name, work.environ.output.mask);
+        std::vector<unsigned char> selection;
+        predicate.select(input, selection);
+
+        /// Same arithmetic as the scalar handler to obtain identical ADC counts
+        const std::size_t       num_rows   = input.size();
+        const double            offset     = m_adc_offset;
+        const ADCValue::value_t max_count  = ADCValue::value_t(m_adc_resolution);
+        const double*           deposit    = input.deposit.data();
+        std::vector<ADCValue::value_t> counts(num_rows);
+        for( std::size_t i = 0; i < num_rows; ++i )   {
+          ADCValue::value_t adc_count = std::round(((deposit[i] - offset) * m_adc_resolution) / m_signal_saturation);
+          counts[i] = std::min(adc_count, max_count);
+        }
+        response.data.reserve(num_rows);
+        for( std::size_t i = 0; i < num_rows; ++i )   {
+          if ( selection[i] )   {
+            CellID cell = input.cell[i];
+            response.emplace(cell, {counts[i], ADCValue::address_t(cell)});
+          }
+        }
+        info("%s+++ %-32s %6ld ADC values. Input: %-32s %6ld deposits", tag,
+             response_name.c_str(), response.size(), input.name.c_str(), input.size());
+        work.environ.output.data.put(response.key, std::move(response));
+      }
     };
   }    // End namespace digi
 }      // End namespace dd4hep
@@ -224,6 +224,13 @@ def _adopt_container_processor(self, action, processor_argument):
 # ---------------------------------------------------------------------------
 
 
+def _adopt_tool(self, action, tool_type):
+  " Helper to let actions adopt tools e.g. signal processors "
+  attr = _get_action(self).adopt_tool
+  attr(_get_action(action), tool_type)
+# ---------------------------------------------------------------------------
+
+
 def _adopt_segment_processor(self, action, processor_argument):
   " Helper to convert DigiActions objects to DigiEventAction "
   attr = _get_action(self).__adopt_segment_processor
@@ -330,10 +337,12 @@ _props('ActionHandle',
        add_list_property=_add_new_list_property,
        add_vector_property=_add_new_vector_property,
        add_mapped_property=_add_new_mapped_property,
-       adopt_container_processor=_adopt_container_processor)
+       adopt_container_processor=_adopt_container_processor,
+       adopt_tool=_adopt_tool)
 _props('DigiSynchronize', adopt=_adopt_event_action, adopt_action=_adopt_sequence_action)
 _props('DigiActionSequence', adopt=_adopt_event_action, adopt_action=_adopt_sequence_action)
 _props('DigiParallelActionSequence', adopt_action=_adopt_sequence_action)
+_props('DigiPileupInput', adopt=_adopt_event_action, adopt_action=_adopt_sequence_action)
 _props('DigiSequentialActionSequence', adopt_action=_adopt_sequence_action)
 _props('DigiContainerSequenceAction', adopt_container_processor=_adopt_container_processor)
 _props('DigiMultiContainerProcessor', adopt_processor=_adopt_processor)
@@ -74,6 +74,8 @@ void DigiAttenuator::execute(DigiContext& context, work_t& work, const predicate
     count = this->attenuate(*m, predicate);
   else if ( auto* v = work.get_input<DepositVector>() )
     count = this->attenuate(*v, predicate);
+  else if ( auto* hm = work.get_input<DepositHashMapping>() )
+    count = this->attenuate(*hm, predicate);
   else if ( auto* h = work.get_input<DetectorHistory>() )
     count = this->attenuate(*h, predicate);
   Key key { work.input.key };
@@ -20,9 +20,54 @@
 
 /// C/C++ include files
 #include <set>
+#include <functional>
 
 using namespace dd4hep::digi;
 
+namespace {
+
+  /// Single merge step of the parallel tree reduction
+  /**
+   *  \author  M.Frank
+   *  \version 1.0
+   *  \ingroup DD4HEP_DIGITIZATION
+   */
+  class merge_call_t : public ParallelWorker   {
+  public:
+    /// Merge work to be executed. Returns the number of merged items
+    std::function<std::size_t()> work;
+    /// Number of merged items after execution
+    mutable std::size_t count { 0 };
+  public:
+    /// Initializing constructor
+    merge_call_t(std::function<std::size_t()>&& w) : work(std::move(w))  {   }
+    /// Callback to execute the merge step
+    virtual void execute(void* /* data */) const override  {
+      count = work();
+    }
+  };
+
+  /// Access the data of a container, which may also be a read-only shared view
+  template <typename T> const T* data_cast(const std::any* data)   {
+    if ( const T* ptr = std::any_cast<T>(data) )
+      return ptr;
+    if ( const shared_view_t<T>* view = std::any_cast<shared_view_t<T> >(data) )
+      return view->get();
+    return nullptr;
+  }
+
+  /// Access the segment entry base of any known data container
+  const SegmentEntry* segment_entry(const std::any* data)   {
+    if ( auto* v = data_cast<DepositVector>(data) )      return v;
+    if ( auto* m = data_cast<DepositMapping>(data) )     return m;
+    if ( auto* h = data_cast<DepositHashMapping>(data) ) return h;
+    if ( auto* r = data_cast<DetectorResponse>(data) )   return r;
+    if ( auto* h = data_cast<DetectorHistory>(data) )    return h;
+    if ( auto* p = data_cast<ParticleMapping>(data) )    return p;
+    return nullptr;
+  }
+}
+
 /// Worker class to combine items of identical types as given by the input definition
 /**
  *  This is a utility class.
@@ -51,14 +96,16 @@ public:
   std::vector<Key>            used_keys;
 
   /// Input arguments
+  DigiContext&                context;
   DigiEvent&                  event;
   DataSegment&                inputs;
   DataSegment&                outputs;
   std::mutex&                 used_keys_lock;
 
   /// Initializing constructor
-  work_definition_t(const DigiContainerCombine* c, DigiEvent& ev, DataSegment& in, DataSegment& out, std::mutex& used_lock)
-    : combine(c), event(ev), inputs(in), outputs(out), used_keys_lock(used_lock)
+  work_definition_t(const DigiContainerCombine* c, DigiContext& ctxt, DigiEvent& ev,
+                    DataSegment& in, DataSegment& out, std::mutex& used_lock)
+    : combine(c), context(ctxt), event(ev), inputs(in), outputs(out), used_keys_lock(used_lock)
   {
     keys.reserve(inputs.size());
     work.reserve(inputs.size());
@@ -81,36 +128,157 @@ public:
     used_keys.emplace_back(key);
   }
 
+  /// Check if the containers of one item should be merged by a parallel tree reduction
+  bool use_tree(const std::vector<std::size_t>& sources)  const   {
+    return combine->m_parallel_merge && sources.size() > 2;
+  }
+
+  /// Check if a deposit work item is a read-only shared view
+  bool is_shared_view(const std::any* data)  const   {
+    return !( std::any_cast<DepositMapping>(data) ||
+              std::any_cast<DepositVector>(data)  ||
+              std::any_cast<DepositHashMapping>(data) );
+  }
+
+  /// Indices of all work items with the same item key as the work item at 'start'
+  template <typename T> std::vector<std::size_t> item_sources(size_t start)  const   {
+    std::vector<std::size_t> sources;
+    for( std::size_t j=start; j < keys.size(); ++j )   {
+      if ( keys[j].item() == keys[start].item() && data_cast<T>(work[j]) )
+        sources.emplace_back(j);
+    }
+    return sources;
+  }
+
+  /// Execute a set of merge calls in parallel using the kernel's task groups
+  void submit_calls(std::vector<merge_call_t>& calls)   {
+    std::vector<ParallelCall*> todo;
+    todo.reserve(calls.size());
+    for( auto& c : calls ) todo.emplace_back(&c);
+    if ( !todo.empty() )
+      combine->m_kernel.submit(context, todo, nullptr, true);
+  }
+
+  /// Parallel pairwise (tree) reduction of the work items 'sources' into the empty container 'output'
+  /**
+   *  Step 1: every input is filled into a private copy of the empty output container.
+   *  Step 2: neighbouring partial results are combined pairwise with doubling stride,
+   *          all combinations of one level run in parallel.
+   *  The final result is in the first partial container. The input order is preserved.
+   *  Both steps follow the erase_combined flag exactly as the sequential merge does:
+   *  merge() combines deposits of the same cell, insert() keeps them separate.
+   */
+  template <typename OUT, typename FILL>
+  void tree_merge(OUT& output, const std::vector<std::size_t>& sources, FILL fill,
+                  const char* tag, std::size_t& counter, int thr)   {
+    std::vector<OUT> partial(sources.size(), output);
+    std::vector<std::string> names;
+    std::vector<merge_call_t> calls;
+    calls.reserve(sources.size());
+    names.reserve(sources.size());
+    for( std::size_t i=0; i < sources.size(); ++i )   {
+      const SegmentEntry* entry = segment_entry(work[sources[i]]);
+      if ( entry->data_type != segment_entry(work[sources[0]])->data_type )
+        combine->except("+++ Digitization does not allow to mix data of different type!");
+      names.emplace_back(entry->name);
+      OUT* target = &partial[i];
+      std::any* source = work[sources[i]];
+      calls.emplace_back([&fill, target, source] { return fill(*target, *source); });
+    }
+    submit_calls(calls);
+    for( std::size_t i=0; i < sources.size(); ++i )   {
+      combine->info(format, thr, names[i].c_str(), keys[sources[i]].mask(), calls[i].count, tag);
+      used_keys_insert(keys[sources[i]]);
+      counter += calls[i].count;
+      cnt_conts++;
+    }
+    for( std::size_t stride=1; stride < partial.size(); stride *= 2 )   {
+      calls.clear();
+      for( std::size_t i=0; i+stride < partial.size(); i += 2*stride )   {
+        OUT* target = &partial[i];
+        OUT* source = &partial[i+stride];
+        calls.emplace_back([this, target, source] { return combine_one(*target, *source); });
+      }
+      submit_calls(calls);
+    }
+    output = std::move(partial[0]);
+  }
+
+  /// Fill one container into another one according to the erase_combined flag
+  /** Shared views are read-only: their content is always copied. */
+  template <typename IN, typename OUT> std::size_t fill_one(OUT& output, std::any& input)  const  {
+    if ( combine->m_erase_combined )   {
+      if ( IN* in = std::any_cast<IN>(&input) )
+        return output.merge(std::move(*in));
+    }
+    return output.insert(*data_cast<IN>(&input));
+  }
+
+  /// Combine two partial results of the tree reduction with the same semantics as fill_one
+  template <typename OUT> std::size_t combine_one(OUT& output, OUT& input)  const  {
+    if ( combine->m_erase_combined )
+      return output.merge(std::move(input));
+    return output.insert(input);
+  }
+
   /// Specialized deposit merger: implicitly assume identical item types are mapped sequentially
-  template<typename OUT, typename IN> void merge_depos(OUT& output, IN& input, int thr)  {
-    std::size_t cnt = 0;
-    const auto& nam = input.name;
+  template<typename IN, typename OUT> void merge_depos(OUT& output, std::any& data, int thr)  {
+    const IN& input = *data_cast<IN>(&data);
+    std::string nam = input.name;
     Key::mask_type mask = input.key.mask();
     if ( output.data_type == SegmentEntry::UNKNOWN )
       output.data_type = input.data_type;
     else if ( output.data_type != input.data_type )
       combine->except("+++ Digitization does not allow to mix data of different type!");
-    if ( combine->m_erase_combined )   {
-      cnt = output.merge(std::move(input));
-    }
-    else   {
-      cnt = output.insert(input);
-    }
+    std::size_t cnt = fill_one<IN>(output, data);
     combine->info(this->format, thr, nam.c_str(), mask, cnt, "deposits"); 
     this->cnt_depos += cnt;
     this->cnt_conts++;
   }
 
   /// Generic deposit merger: implicitly assume identical item types are mapped sequentially
-  void merge(const std::string& nam, size_t start, int thr)  {
+  template <typename OUT> void merge(const std::string& nam, size_t start, int thr)  {
     Key key = keys[start];
-    DepositVector out(nam, combine->m_deposit_mask, SegmentEntry::UNKNOWN);
+    OUT out(nam, combine->m_deposit_mask, SegmentEntry::UNKNOWN);
+    std::vector<std::size_t> sources;
+    for( std::size_t j = start; j < keys.size() && combine->m_parallel_merge; ++j )   {
+      if ( keys[j].item() == key.item() )   {
+        if ( !(data_cast<DepositMapping>(work[j]) ||
+               data_cast<DepositVector>(work[j])  ||
+               data_cast<DepositHashMapping>(work[j])) )
+          break;
+        sources.emplace_back(j);
+      }
+    }
+    // Shared views are copied, not merged: with erase_combined the tree reduction would
+    // merge them with the other inputs, hence such mixtures are combined sequentially.
+    for( std::size_t j : sources )   {
+      if ( combine->m_erase_combined && is_shared_view(work[j]) )   {
+        sources.clear();
+        break;
+      }
+    }
+    if ( use_tree(sources) )   {
+      out.data_type = segment_entry(work[sources[0]])->data_type;
+      tree_merge(out, sources, [this](OUT& o, std::any& in)   {
+        if ( data_cast<DepositMapping>(&in) )
+          return fill_one<DepositMapping>(o, in);
+        else if ( data_cast<DepositVector>(&in) )
+          return fill_one<DepositVector>(o, in);
+        return fill_one<DepositHashMapping>(o, in);
+      }, "deposits", cnt_depos, thr);
+      key.set_mask(combine->m_deposit_mask);
+      outputs.emplace(std::move(key), std::move(out));
+      return;
+    }
     for( std::size_t j = start; j < keys.size(); ++j )   {
       if ( keys[j].item() == key.item() )   {
-        if ( DepositMapping* m = std::any_cast<DepositMapping>(work[j]) )
-          merge_depos(out, *m, thr);
-        else if ( DepositVector* v = std::any_cast<DepositVector>(work[j]) )
-          merge_depos(out, *v, thr);
+        if ( data_cast<DepositMapping>(work[j]) )
+          merge_depos<DepositMapping>(out, *work[j], thr);
+        else if ( data_cast<DepositVector>(work[j]) )
+          merge_depos<DepositVector>(out, *work[j], thr);
+        else if ( data_cast<DepositHashMapping>(work[j]) )
+          merge_depos<DepositHashMapping>(out, *work[j], thr);
         else
           break;
         used_keys_insert(keys[j]);
@@ -120,17 +288,35 @@ public:
     outputs.emplace(std::move(key), std::move(out));
   }
 
+  /// Deposit merger: select the output container type according to the properties
+  void merge(const std::string& nam, size_t start, int thr)  {
+    if ( combine->m_hashed_deposits )
+      merge<DepositHashMapping>(nam, start, thr);
+    else
+      merge<DepositVector>(nam, start, thr);
+  }
+
   /// Merge history records: implicitly assume identical item types are mapped sequentially
   void merge_hist(const std::string& nam, size_t start, int thr)  {
     std::size_t cnt;
     Key key = keys[start];
     DetectorHistory out(nam, combine->m_deposit_mask);
+    std::vector<std::size_t> sources;
+    if ( combine->m_parallel_merge ) sources = item_sources<DetectorHistory>(start);
+    if ( use_tree(sources) )   {
+      tree_merge(out, sources, [this](DetectorHistory& o, std::any& in)   {
+        return fill_one<DetectorHistory>(o, in);
+      }, "histories", cnt_hist, thr);
+      key.set_mask(combine->m_deposit_mask);
+      outputs.emplace(std::move(key), std::move(out));
+      return;
+    }
     for( std::size_t j=start; j < keys.size(); ++j )   {
       if ( keys[j].item() == key.item() )   {
-        DetectorHistory* next = std::any_cast<DetectorHistory>(work[j]);
+        const DetectorHistory* next = data_cast<DetectorHistory>(work[j]);
         if ( next )   {
           std::string next_name = next->name;
-          cnt = (combine->m_erase_combined) ? out.merge(std::move(*next)) : out.insert(*next);
+          cnt = fill_one<DetectorHistory>(out, *work[j]);
           combine->info(format, thr, next_name.c_str(), keys[j].mask(), cnt, "histories");
           used_keys_insert(keys[j]);
           cnt_hist += cnt;
@@ -147,12 +333,22 @@ public:
     std::size_t cnt;
     Key key = keys[start];
     DetectorResponse out(nam, combine->m_deposit_mask);
+    std::vector<std::size_t> sources;
+    if ( combine->m_parallel_merge ) sources = item_sources<DetectorResponse>(start);
+    if ( use_tree(sources) )   {
+      tree_merge(out, sources, [this](DetectorResponse& o, std::any& in)   {
+        return fill_one<DetectorResponse>(o, in);
+      }, "responses", cnt_response, thr);
+      key.set_mask(combine->m_deposit_mask);
+      outputs.emplace(std::move(key), std::move(out));
+      return;
+    }
     for( std::size_t j=start; j < keys.size(); ++j )   {
       if ( keys[j].item() == key.item() )   {
-        DetectorResponse* next = std::any_cast<DetectorResponse>(work[j]);
+        const DetectorResponse* next = data_cast<DetectorResponse>(work[j]);
         if ( next )   {
           std::string next_name = next->name;
-          cnt = (combine->m_erase_combined) ? out.merge(std::move(*next)) : out.insert(*next);
+          cnt = fill_one<DetectorResponse>(out, *work[j]);
           combine->info(format, thr, next_name.c_str(), keys[j].mask(), cnt, "responses"); 
           used_keys_insert(keys[j]);
           cnt_response += cnt;
@@ -169,12 +365,22 @@ public:
     std::size_t cnt;
     Key key = keys[start];
     ParticleMapping out(nam, combine->m_deposit_mask);
+    std::vector<std::size_t> sources;
+    if ( combine->m_parallel_merge ) sources = item_sources<ParticleMapping>(start);
+    if ( use_tree(sources) )   {
+      tree_merge(out, sources, [this](ParticleMapping& o, std::any& in)   {
+        return fill_one<ParticleMapping>(o, in);
+      }, "particles", cnt_parts, thr);
+      key.set_mask(combine->m_deposit_mask);
+      outputs.emplace(std::move(key), std::move(out));
+      return;
+    }
     for( std::size_t j=start; j < keys.size(); ++j )   {
       if ( keys[j].item() == key.item() )   {
-        ParticleMapping* next = std::any_cast<ParticleMapping>(work[j]);
+        const ParticleMapping* next = data_cast<ParticleMapping>(work[j]);
         if ( next )   {
           std::string next_name = next->name;
-          cnt = (combine->m_erase_combined) ? out.merge(std::move(*next)) : out.insert(*next);
+          cnt = fill_one<ParticleMapping>(out, *work[j]);
           combine->info(format, thr, next_name.c_str(), keys[j].mask(), cnt, "particles"); 
           used_keys_insert(keys[j]);
           cnt_parts += cnt;
@@ -193,23 +399,27 @@ public:
       if ( keys[i].item() != itm )
         continue;
       /// Merge deposit mapping
-      if ( DepositMapping* depom = std::any_cast<DepositMapping>(work[i]) )   {
+      if ( const DepositMapping* depom = data_cast<DepositMapping>(work[i]) )   {
         if ( combine->m_merge_deposits  ) merge(depom->name+opt, i, thr);
       }
+      /// Merge hashed deposit mapping
+      else if ( const DepositHashMapping* depoh = data_cast<DepositHashMapping>(work[i]) )   {
+        if ( combine->m_merge_deposits  ) merge(depoh->name+opt, i, thr);
+      }
       /// Merge deposit vector
-      else if ( DepositVector* depov = std::any_cast<DepositVector>(work[i]) )   {
+      else if ( const DepositVector* depov = data_cast<DepositVector>(work[i]) )   {
         if ( combine->m_merge_deposits  ) merge(depov->name+opt, i, thr);
       }
       /// Merge detector response
-      else if ( DetectorResponse* resp = std::any_cast<DetectorResponse>(work[i]) )   {
+      else if ( const DetectorResponse* resp = data_cast<DetectorResponse>(work[i]) )   {
         if ( combine->m_merge_response  ) merge_response(resp->name+opt, i, thr);
       }
       /// Merge response history
-      else if ( DetectorHistory* hist = std::any_cast<DetectorHistory>(work[i]) )   {
+      else if ( const DetectorHistory* hist = data_cast<DetectorHistory>(work[i]) )   {
         if ( combine->m_merge_history   ) merge_hist(hist->name+opt, i, thr);
       }
       /// Merge particle container
-      else if ( ParticleMapping* parts = std::any_cast<ParticleMapping>(work[i]) )   {
+      else if ( const ParticleMapping* parts = data_cast<ParticleMapping>(work[i]) )   {
         if ( combine->m_merge_particles ) merge_parts(parts->name+opt, i, thr);
       }
       break;
@@ -251,6 +461,8 @@ DigiContainerCombine::DigiContainerCombine(const DigiKernel& krnl, const std::st
   declareProperty("merge_response",   m_merge_response  = true);
   declareProperty("merge_history",    m_merge_history   = true);
   declareProperty("merge_particles",  m_merge_particles = false);
+  declareProperty("hashed_deposits",  m_hashed_deposits = false);
+  declareProperty("parallel_merge",   m_parallel_merge  = false);
   m_kernel.register_initialize(std::bind(&DigiContainerCombine::initialize,this));
   InstanceCount::increment(this);
 }
@@ -307,7 +519,7 @@ std::size_t DigiContainerCombine::combine_containers(DigiContext& context,
                                                      DataSegment& inputs,
                                                      DataSegment& outputs)  const
 {
-  work_definition_t def(this, event, inputs, outputs, m_used_keys_lock);
+  work_definition_t def(this, context, event, inputs, outputs, m_used_keys_lock);
   if ( m_parallel )  {
     have_workers(def.items.size());
     m_kernel.submit(context, m_workers.get_group(), def.items.size(), &def);
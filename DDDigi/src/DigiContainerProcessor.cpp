@@ -16,10 +16,12 @@
 #include <DDDigi/DigiData.h>
 #include <DDDigi/DigiKernel.h>
 #include <DDDigi/DigiContext.h>
+#include <DDDigi/DigiProfiler.h>
 #include <DDDigi/DigiContainerProcessor.h>
 #include <DDDigi/DigiSegmentSplitter.h>
 
 /// C/C++ include files
+#include <algorithm>
 #include <sstream>
 
 using namespace dd4hep::digi;
@@ -66,6 +68,10 @@ template       DepositVector*    DigiContainerProcessor::work_t::get_input(bool
 template const DepositVector*    DigiContainerProcessor::work_t::get_input(bool exc)  const;
 template       DepositMapping*   DigiContainerProcessor::work_t::get_input(bool exc);
 template const DepositMapping*   DigiContainerProcessor::work_t::get_input(bool exc)  const;
+template       DepositHashMapping* DigiContainerProcessor::work_t::get_input(bool exc);
+template const DepositHashMapping* DigiContainerProcessor::work_t::get_input(bool exc)  const;
+template       DepositColumns*   DigiContainerProcessor::work_t::get_input(bool exc);
+template const DepositColumns*   DigiContainerProcessor::work_t::get_input(bool exc)  const;
 template       ParticleMapping*  DigiContainerProcessor::work_t::get_input(bool exc);
 template const ParticleMapping*  DigiContainerProcessor::work_t::get_input(bool exc)  const;
 template       DetectorHistory*  DigiContainerProcessor::work_t::get_input(bool exc);
@@ -83,22 +89,61 @@ std::string DigiContainerProcessor::work_t::input_type_name()  const   {
   return typeName(input.data->type());
 }
 
+/// Number of items in the input container (0 if the type is unknown)
+std::size_t DigiContainerProcessor::work_t::input_size()  const   {
+  if ( const auto* v = std::any_cast<DepositVector>(input.data) )      return v->size();
+  if ( const auto* m = std::any_cast<DepositMapping>(input.data) )     return m->size();
+  if ( const auto* h = std::any_cast<DepositHashMapping>(input.data) ) return h->size();
+  if ( const auto* c = std::any_cast<DepositColumns>(input.data) )     return c->size();
+  if ( const auto* p = std::any_cast<ParticleMapping>(input.data) )    return p->size();
+  if ( const auto* r = std::any_cast<DetectorResponse>(input.data) )   return r->size();
+  if ( const auto* h = std::any_cast<DetectorHistory>(input.data) )    return h->size();
+  return 0;
+}
+
 /// Access to default callback 
 const DigiContainerProcessor::predicate_t& DigiContainerProcessor::accept_all()  {
-  static predicate_t s_pred { std::bind(predicate_t::always_true, std::placeholders::_1), 0, nullptr };
+  static predicate_t s_pred { predicate_t::always_true, 0, nullptr };
   return s_pred;
 }
 
 /// Access to default callback 
 const DigiContainerProcessor::predicate_t& DigiContainerProcessor::accept_not_killed()  {
-  static predicate_t s_pred { std::bind(predicate_t::not_killed, std::placeholders::_1), 0, nullptr };
+  static predicate_t s_pred { predicate_t::not_killed, 0, nullptr };
   return s_pred;
 }
 
+/// Evaluate the predicate for all rows of a column container (1: process, 0: skip)
+void DigiContainerProcessor::predicate_t::select(const DepositColumns& columns, std::vector<unsigned char>& selection)  const   {
+  using function_t = bool (*)(const deposit_t&);
+  const std::size_t num_rows = columns.size();
+  const auto* func = this->callback.target<function_t>();
+  selection.resize(num_rows);
+  /// The standard predicates are evaluated directly on the columns
+  if ( this->segmentation )   {
+    for( std::size_t i = 0; i < num_rows; ++i )
+      selection[i] = this->segmentation->split_id(columns.cell[i]) == this->id;
+  }
+  else if ( func && *func == predicate_t::always_true )   {
+    std::fill(selection.begin(), selection.end(), 1);
+  }
+  else if ( func && *func == predicate_t::not_killed )   {
+    for( std::size_t i = 0; i < num_rows; ++i )
+      selection[i] = 0 == (columns.flag[i] & EnergyDeposit::KILLED);
+  }
+  else   {
+    /// User predicates require the assembled deposit
+    for( std::size_t i = 0; i < num_rows; ++i )
+      selection[i] = this->callback(deposit_t(columns.cell[i], columns.at(i)));
+  }
+}
+
 /// Standard constructor
 DigiContainerProcessor::DigiContainerProcessor(const kernel_t& kernel, const std::string& name)   
   : DigiAction(kernel, name)
 {
+  declareProperty("reproducible_random", m_cell_random = false);
+  m_random_id = detail::hash64(name);
   InstanceCount::increment(this);
 }
 
@@ -114,6 +159,36 @@ void DigiContainerProcessor::adopt_monitor(DigiDepositMonitor* monitor)    {
   m_monitor = monitor;
 }
 
+namespace {
+  /// Identity of the event input: the event number only if the inputs did not record their entries
+  uint64_t input_identity(const DigiEvent& event)   {
+    uint64_t identity = event.input_identity();
+    return identity ? identity : uint64_t(event.eventNumber);
+  }
+}
+
+/// Key of the reproducible random streams of a container entry: processor, container and sequence
+uint64_t DigiContainerProcessor::random_key(Key container, std::size_t sequence)  const   {
+  /// The streams follow the data item, not the segment it is stored in
+  container.set_segment(0);
+  return DigiPhiloxEngine::mix(DigiPhiloxEngine::mix(m_random_id, container.value()), sequence);
+}
+
+/// Reproducible random stream of one deposit: keyed by input, cell, container, sequence and processor
+DigiCellRandom DigiContainerProcessor::cell_random(const context_t& context, Key container, CellID cell, std::size_t sequence)  const   {
+  return context.randomGenerator().cell_stream(input_identity(*context.event), cell, random_key(container, sequence));
+}
+
+/// Random generator to be used for one deposit
+DigiRandomGenerator& DigiContainerProcessor::random_generator(const context_t& context,
+                                                              std::optional<DigiCellRandom>& stream,
+                                                              Key container, CellID cell, std::size_t sequence)  const   {
+  if ( !m_cell_random )
+    return context.randomGenerator();
+  stream.emplace(context.randomGenerator(), input_identity(*context.event), cell, random_key(container, sequence));
+  return *stream;
+}
+
 /// Main functional callback if specific work is known
 void DigiContainerProcessor::execute(context_t&         /* context   */,
                                      work_t&            /* work      */,
@@ -126,6 +201,13 @@ void DigiDepositsProcessor::execute(context_t& context, work_t& work, const pred
     m_handleVector(context,  *vector_data, work, predicate);
   else if ( auto* mapped_data = work.get_input<DepositMapping>() )
     m_handleMapping(context, *mapped_data, work, predicate);
+  else if ( auto* hashed_data = work.get_input<DepositHashMapping>() )
+    m_handleHashMapping(context, *hashed_data, work, predicate);
+  else if ( auto* column_data = work.get_input<DepositColumns>() )   {
+    if ( !m_handleColumns )
+      except("No handler for deposit columns: %s. Convert the container first.", work.input_type_name().c_str());
+    m_handleColumns(context, *column_data, work, predicate);
+  }
   else
     except("Request to handle unknown data type: %s", work.input_type_name().c_str());
 }
@@ -169,6 +251,7 @@ template <> void DigiParallelWorker<DigiContainerProcessor,
                                     std::size_t,
                                     DigiContainerSequence&>::execute(void* data) const  {
   calldata_t* arg  = reinterpret_cast<calldata_t*>(data);
+  DigiProfiler::scope_t scope(*action, arg->environ.context, arg->input_size());
   action->execute(arg->environ.context, *arg, predicate.m_worker_predicate);
 }
 
@@ -294,6 +377,7 @@ template <> void DigiParallelWorker<DigiContainerProcessor,
   auto* args = reinterpret_cast<calldata_t*>(data);
   auto& item = args->input_items[this->options];
   DigiContainerProcessor::work_t work { args->environ, item };
+  DigiProfiler::scope_t scope(*action, args->environ.context, work.input_size());
   action->execute(args->environ.context, work, predicate.m_worker_predicate);
 }
 
@@ -432,11 +516,13 @@ template <> void DigiParallelWorker<DigiContainerProcessor,
       tag = "mask accepted";
       if ( keys.empty() )  {
         DigiContainerProcessor::work_t  work { arg->environ, item };
+        DigiProfiler::scope_t scope(*action, work.environ.context, work.input_size());
         action->execute(work.environ.context, work, predicate.m_worker_predicate);
         continue;
       }
       else if ( std::find(keys.begin(), keys.end(), key) != keys.end() )    {
         DigiContainerProcessor::work_t work { arg->environ, item };
+        DigiProfiler::scope_t scope(*action, work.environ.context, work.input_size());
         action->execute(work.environ.context, work, predicate.m_worker_predicate);
         continue;
       }
@@ -19,6 +19,7 @@
 #include <DDDigi/DigiData.h>
 
 // C/C++ include files
+#include <algorithm>
 #include <mutex>
 
 namespace   {
@@ -202,6 +203,29 @@ std::size_t DepositVector::merge(DepositMapping&& updates)    {
   return update_size;
 }
 
+/// Merge new deposit map onto existing map
+std::size_t DepositVector::merge(DepositHashMapping&& updates)    {
+  std::size_t update_size = updates.size();
+  std::size_t newlen = std::max(2*data.size(), data.size()+updates.size());
+  data.reserve(newlen);
+  for( auto& c : updates )    {
+    data.emplace_back(c.first, std::move(c.second));
+  }
+  return update_size;
+}
+
+/// Merge deposit columns onto existing vector
+std::size_t DepositVector::merge(DepositColumns&& updates)    {
+  std::size_t update_size = updates.size();
+  std::size_t newlen = std::max(2*data.size(), data.size()+updates.size());
+  data.reserve(newlen);
+  for( std::size_t row = 0; row < update_size; ++row )    {
+    data.emplace_back(updates.cell[row], updates.extract(row));
+  }
+  updates.clear();
+  return update_size;
+}
+
 /// Merge new deposit map onto existing map (keep inputs)
 std::size_t DepositVector::insert(const DepositVector& updates)    {
   std::size_t update_size = updates.size();
@@ -224,6 +248,17 @@ std::size_t DepositVector::insert(const DepositMapping& updates)    {
   return update_size;
 }
 
+/// Merge new deposit map onto existing map (keep inputs)
+std::size_t DepositVector::insert(const DepositHashMapping& updates)    {
+  std::size_t update_size = updates.size();
+  std::size_t newlen = std::max(2*data.size(), data.size()+updates.size());
+  data.reserve(newlen);
+  for( const auto& c : updates )    {
+    data.emplace_back(c);
+  }
+  return update_size;
+}
+
 /// Access energy deposit by key
 const EnergyDeposit& DepositVector::get(CellID cell)   const    {
   for( const auto& c : data )    {
@@ -312,6 +347,368 @@ void DepositMapping::remove(iterator position)   {
   data.erase(position);
 }
 
+/// Index slot of a cell or the empty slot where it would be placed
+std::size_t DepositHashMapping::slot(CellID cell)  const   {
+  const std::size_t mask = index.size() - 1;
+  for( std::size_t i = hash(cell) & mask; ; i = (i + 1) & mask )   {
+    std::uint32_t entry = index[i];
+    if ( 0 == entry || data[entry-1].first == cell )
+      return i;
+  }
+}
+
+/// Release an index slot (backward shift deletion: no tombstones in the index)
+void DepositHashMapping::release(std::size_t hole)   {
+  const std::size_t mask = index.size() - 1;
+  for( std::size_t i = (hole + 1) & mask; index[i]; i = (i + 1) & mask )   {
+    std::size_t home = hash(data[index[i]-1].first) & mask;
+    /// Entries may only move towards their home slot
+    if ( ((i - home) & mask) >= ((i - hole) & mask) )   {
+      index[hole] = index[i];
+      hole = i;
+    }
+  }
+  index[hole] = 0;
+}
+
+/// Resize the hash index to hold count entries at a load factor below 1/2
+void DepositHashMapping::rehash(std::size_t count)   {
+  std::size_t capacity = 16;
+  while( capacity < 2*count ) capacity <<= 1;
+  if ( capacity <= index.size() )
+    return;
+  index.assign(capacity, 0);
+  num_duplicates = 0;
+  for( std::size_t i = 0; i < data.size(); ++i )   {
+    if ( !removed.empty() && removed[i] ) continue;
+    std::size_t s = slot(data[i].first);
+    if ( 0 == index[s] ) index[s] = std::uint32_t(i+1);
+    else ++num_duplicates;
+  }
+}
+
+/// Drop the removed entries from the storage and rebuild the index
+void DepositHashMapping::compact()   {
+  this->remove_if([](const value_type&) { return false; });
+}
+
+/// Add entry at the end of the storage and index it if the cell is new
+template <typename DEPOSIT> void DepositHashMapping::add(CellID cell, DEPOSIT&& deposit)   {
+  this->grow();
+  std::size_t s = slot(cell);
+  data.emplace_back(cell, std::forward<DEPOSIT>(deposit));
+  if ( !removed.empty() ) removed.emplace_back(0);
+  if ( 0 == index[s] ) index[s] = std::uint32_t(data.size());
+  else ++num_duplicates;
+}
+
+/// Merge entry: update the deposit of an existing cell or add a new one
+template <typename DEPOSIT> void DepositHashMapping::update(CellID cell, DEPOSIT&& deposit)   {
+  this->grow();
+  std::size_t s = slot(cell);
+  if ( index[s] )   {
+    data[index[s]-1].second.update_deposit_weighted(std::forward<DEPOSIT>(deposit));
+    return;
+  }
+  data.emplace_back(cell, std::forward<DEPOSIT>(deposit));
+  if ( !removed.empty() ) removed.emplace_back(0);
+  index[s] = std::uint32_t(data.size());
+}
+
+/// Reserve space for count deposits
+void DepositHashMapping::reserve(std::size_t count)   {
+  // Keep the geometric growth: repeated merges must not reallocate for every input
+  if ( count > data.capacity() )
+    data.reserve(std::max(count, 2*data.capacity()));
+  this->rehash(count);
+}
+
+/// Emplace entry
+void DepositHashMapping::emplace(CellID cell, EnergyDeposit&& deposit)    {
+  this->add(cell, std::move(deposit));
+}
+
+/// Merge new deposit map onto existing map
+std::size_t DepositHashMapping::merge(DepositHashMapping&& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(data.size() + update_size);
+  for( auto& dep : updates )
+    this->update(dep.first, std::move(dep.second));
+  return update_size;
+}
+
+/// Merge new deposit map onto existing map (keep inputs)
+std::size_t DepositHashMapping::insert(const DepositHashMapping& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(data.size() + update_size);
+  for( const auto& dep : updates )
+    this->add(dep.first, dep.second);
+  return update_size;
+}
+
+/// Merge new deposit map onto existing map
+std::size_t DepositHashMapping::merge(DepositMapping&& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(data.size() + update_size);
+  for( auto& dep : updates )
+    this->update(dep.first, std::move(dep.second));
+  return update_size;
+}
+
+/// Merge new deposit map onto existing map (keep inputs)
+std::size_t DepositHashMapping::insert(const DepositMapping& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(data.size() + update_size);
+  for( const auto& dep : updates )
+    this->add(dep.first, dep.second);
+  return update_size;
+}
+
+/// Merge new deposit map onto existing map
+std::size_t DepositHashMapping::merge(DepositVector&& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(data.size() + update_size);
+  for( auto& dep : updates )
+    this->update(dep.first, std::move(dep.second));
+  return update_size;
+}
+
+/// Merge new deposit map onto existing map (keep inputs)
+std::size_t DepositHashMapping::insert(const DepositVector& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(data.size() + update_size);
+  for( const auto& dep : updates )
+    this->add(dep.first, dep.second);
+  return update_size;
+}
+
+/// Find the first deposit of a cell
+DepositHashMapping::iterator DepositHashMapping::find(CellID cell)   {
+  if ( index.empty() ) return end();
+  std::uint32_t entry = index[slot(cell)];
+  return entry ? iterator(data.begin() + (entry-1), data.end(), marks() ? marks() + (entry-1) : nullptr) : end();
+}
+
+/// Find the first deposit of a cell (CONST)
+DepositHashMapping::const_iterator DepositHashMapping::find(CellID cell)  const   {
+  if ( index.empty() ) return end();
+  std::uint32_t entry = index[slot(cell)];
+  return entry ? const_iterator(data.begin() + (entry-1), data.end(), marks() ? marks() + (entry-1) : nullptr) : end();
+}
+
+/// Access energy deposit by key
+const EnergyDeposit& DepositHashMapping::get(CellID cell)   const    {
+  auto iter = this->find(cell);
+  if ( iter != end() )
+    return iter->second;
+  except("DepositHashMapping","Failed to access deposit by CellID. UNKNOWN ID: %016X", cell);
+  throw std::runtime_error("Failed to access deposit by CellID");
+}
+
+/// Remove entry. Invalidates all iterators
+void DepositHashMapping::remove(iterator position)   {
+  // The keys are const: mark the entry and drop it from the index
+  std::size_t entry = position.pos - data.begin();
+  if ( removed.empty() ) removed.assign(data.size(), 0);
+  if ( removed[entry] ) return;
+  removed[entry] = 1;
+  ++num_removed;
+
+  CellID cell = data[entry].first;
+  std::size_t s = slot(cell);
+  if ( index[s] != entry + 1 )   {
+    // A later deposit of a cell added several times
+    --num_duplicates;
+  }
+  else   {
+    release(s);
+    // Re-index the next deposit of the same cell if there is one
+    for( std::size_t i = entry + 1; num_duplicates > 0 && i < data.size(); ++i )   {
+      if ( !removed[i] && data[i].first == cell )   {
+        index[slot(cell)] = std::uint32_t(i+1);
+        --num_duplicates;
+        break;
+      }
+    }
+  }
+  if ( 2*num_removed > data.size() )
+    this->compact();
+}
+
+/// Emplace entry
+void DepositColumns::emplace(CellID cell_id, EnergyDeposit&& depo)    {
+  this->cell.emplace_back(cell_id);
+  this->deposit.emplace_back(depo.deposit);
+  this->depositError.emplace_back(depo.depositError);
+  this->time.emplace_back(depo.time);
+  this->length.emplace_back(depo.length);
+  this->x.emplace_back(depo.position.X());
+  this->y.emplace_back(depo.position.Y());
+  this->z.emplace_back(depo.position.Z());
+  this->px.emplace_back(depo.momentum.X());
+  this->py.emplace_back(depo.momentum.Y());
+  this->pz.emplace_back(depo.momentum.Z());
+  this->flag.emplace_back(depo.flag);
+  this->mask.emplace_back(depo.mask);
+  this->history.emplace_back(std::move(depo.history));
+}
+
+/// Emplace entry (keep input)
+void DepositColumns::emplace(CellID cell_id, const EnergyDeposit& depo)    {
+  EnergyDeposit copy(depo);
+  this->emplace(cell_id, std::move(copy));
+}
+
+/// Reserve space for count deposits
+void DepositColumns::reserve(std::size_t count)   {
+  this->cell.reserve(count);
+  this->deposit.reserve(count);
+  this->depositError.reserve(count);
+  this->time.reserve(count);
+  this->length.reserve(count);
+  this->x.reserve(count);
+  this->y.reserve(count);
+  this->z.reserve(count);
+  this->px.reserve(count);
+  this->py.reserve(count);
+  this->pz.reserve(count);
+  this->flag.reserve(count);
+  this->mask.reserve(count);
+  this->history.reserve(count);
+}
+
+/// Remove all deposits
+void DepositColumns::clear()   {
+  this->cell.clear();
+  this->deposit.clear();
+  this->depositError.clear();
+  this->time.clear();
+  this->length.clear();
+  this->x.clear();
+  this->y.clear();
+  this->z.clear();
+  this->px.clear();
+  this->py.clear();
+  this->pz.clear();
+  this->flag.clear();
+  this->mask.clear();
+  this->history.clear();
+}
+
+/// Assemble the energy deposit of a given row (copies the history)
+EnergyDeposit DepositColumns::at(std::size_t row)   const    {
+  if ( row >= this->size() )   {
+    except("DepositColumns","Failed to access deposit. Row %ld out of range [size: %ld]", row, this->size());
+  }
+  EnergyDeposit depo;
+  depo.position     = Position(x[row], y[row], z[row]);
+  depo.momentum     = Direction(px[row], py[row], pz[row]);
+  depo.length       = length[row];
+  depo.deposit      = deposit[row];
+  depo.depositError = depositError[row];
+  depo.time         = time[row];
+  depo.flag         = flag[row];
+  depo.mask         = mask[row];
+  depo.history      = history[row];
+  return depo;
+}
+
+/// Assemble the energy deposit of a given row (moves the history out of the container)
+EnergyDeposit DepositColumns::extract(std::size_t row)    {
+  EnergyDeposit depo;
+  depo.position     = Position(x[row], y[row], z[row]);
+  depo.momentum     = Direction(px[row], py[row], pz[row]);
+  depo.length       = length[row];
+  depo.deposit      = deposit[row];
+  depo.depositError = depositError[row];
+  depo.time         = time[row];
+  depo.flag         = flag[row];
+  depo.mask         = mask[row];
+  depo.history      = std::move(history[row]);
+  return depo;
+}
+
+/// Append deposits to the columns
+std::size_t DepositColumns::merge(DepositColumns&& updates)    {
+  std::size_t update_size = updates.size();
+  if ( this->empty() )   {
+    *this = std::move(updates);
+    return update_size;
+  }
+  auto append = [](auto& to, auto& from)  {
+    to.insert(to.end(), std::make_move_iterator(from.begin()), std::make_move_iterator(from.end()));
+  };
+  append(cell, updates.cell);
+  append(deposit, updates.deposit);
+  append(depositError, updates.depositError);
+  append(time, updates.time);
+  append(length, updates.length);
+  append(x, updates.x);
+  append(y, updates.y);
+  append(z, updates.z);
+  append(px, updates.px);
+  append(py, updates.py);
+  append(pz, updates.pz);
+  append(flag, updates.flag);
+  append(mask, updates.mask);
+  append(history, updates.history);
+  return update_size;
+}
+
+/// Append deposits to the columns
+std::size_t DepositColumns::merge(DepositVector&& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(this->size() + update_size);
+  for( auto& dep : updates )
+    this->emplace(dep.first, std::move(dep.second));
+  return update_size;
+}
+
+/// Append deposits to the columns
+std::size_t DepositColumns::merge(DepositMapping&& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(this->size() + update_size);
+  for( auto& dep : updates )
+    this->emplace(dep.first, std::move(dep.second));
+  return update_size;
+}
+
+/// Append deposits to the columns
+std::size_t DepositColumns::merge(DepositHashMapping&& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(this->size() + update_size);
+  for( auto& dep : updates )
+    this->emplace(dep.first, std::move(dep.second));
+  return update_size;
+}
+
+/// Append deposits to the columns (keep inputs)
+std::size_t DepositColumns::insert(const DepositVector& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(this->size() + update_size);
+  for( const auto& dep : updates )
+    this->emplace(dep.first, dep.second);
+  return update_size;
+}
+
+/// Append deposits to the columns (keep inputs)
+std::size_t DepositColumns::insert(const DepositMapping& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(this->size() + update_size);
+  for( const auto& dep : updates )
+    this->emplace(dep.first, dep.second);
+  return update_size;
+}
+
+/// Append deposits to the columns (keep inputs)
+std::size_t DepositColumns::insert(const DepositHashMapping& updates)    {
+  std::size_t update_size = updates.size();
+  this->reserve(this->size() + update_size);
+  for( const auto& dep : updates )
+    this->emplace(dep.first, dep.second);
+  return update_size;
+}
+
 /// Move particle
 void Particle::move_position(const Position& delta)    {
   this->start_position += delta;
@@ -401,10 +798,76 @@ std::size_t DetectorHistory::insert(const DetectorHistory& updates)   {
   return len;
 }
 
+/// Declare key of a data item in the segment with the given identifier
+void SegmentLayout::declare(Key::segment_type id, Key key)   {
+  std::lock_guard<std::mutex> guard(m_lock);
+  auto& keys = m_keys[id];
+  if ( keys && std::binary_search(keys->begin(), keys->end(), key) )   {
+    return;
+  }
+  auto updated = keys ? std::make_shared<std::vector<Key> >(*keys) : std::make_shared<std::vector<Key> >();
+  updated->insert(std::upper_bound(updated->begin(), updated->end(), key), key);
+  keys = std::move(updated);
+}
+
+/// Add the keys of a (finished) data segment
+void SegmentLayout::learn(const DataSegment& segment)   {
+  if ( !m_learn || segment.data.empty() )   {
+    return;
+  }
+  /// Only the keys without slot are new. The segment is no longer used: no need to lock
+  std::lock_guard<std::mutex> guard(m_lock);
+  auto& keys = m_keys[segment.id];
+  auto updated = keys ? std::make_shared<std::vector<Key> >(*keys) : std::make_shared<std::vector<Key> >();
+  for( const auto& entry : segment.data )
+    updated->emplace_back(entry.first);
+  std::sort(updated->begin(), updated->end());
+  updated->erase(std::unique(updated->begin(), updated->end()), updated->end());
+  keys = std::move(updated);
+}
+
+/// Access the sorted keys of a segment
+SegmentLayout::keys_t SegmentLayout::keys(Key::segment_type id)  const   {
+  static const keys_t s_empty = std::make_shared<const std::vector<Key> >();
+  std::lock_guard<std::mutex> guard(m_lock);
+  auto iter = m_keys.find(id);
+  return iter != m_keys.end() && iter->second ? iter->second : s_empty;
+}
+
 /// Initializing constructor
-DataSegment::DataSegment(std::mutex& l, Key::segment_type i)
-  : data(), lock(l), id(i)
+DataSegment::DataSegment(std::mutex& l, Key::segment_type i, std::pmr::memory_resource* res)
+  : resource(res), data(res), lock(l), id(i)
+{
+}
+
+/// Initializing constructor with segment lock and pre-allocated slots for the sorted keys
+DataSegment::DataSegment(Key::segment_type i, std::pmr::memory_resource* res, const std::vector<Key>& slot_keys)
+  : resource(res), data(res), lock(own_lock), id(i)
 {
+  if ( !slot_keys.empty() )   {
+    std::pmr::polymorphic_allocator<slot_t> alloc(resource);
+    slots = alloc.allocate(slot_keys.size());
+    for( const auto& key : slot_keys )
+      new(slots + num_slots++) slot_t(key);
+  }
+}
+
+/// Default destructor
+DataSegment::~DataSegment()   {
+  if ( slots )   {
+    std::pmr::polymorphic_allocator<slot_t> alloc(resource);
+    for( std::size_t i = 0; i < num_slots; ++i )
+      slots[i].~slot_t();
+    alloc.deallocate(slots, num_slots);
+  }
+}
+
+/// Access slot by key (nullptr if the key has no slot)
+DataSegment::slot_t* DataSegment::find_slot(Key key)  const   {
+  slot_t* first = slots;
+  slot_t* last  = slots + num_slots;
+  slot_t* slot  = std::lower_bound(first, last, key, [](const slot_t& s, const Key& k) { return s.value.first < k; });
+  return (slot != last && slot->value.first == key) ? slot : nullptr;
 }
 
 /// Remove data item from segment
@@ -415,8 +878,20 @@ bool DataSegment::emplace_any(Key key, std::any&& item)    {
 	   data.size(), Key::key_name(key).c_str(), key.value(), key.segment(), key.mask(), key.item(),
 	   yes_no(has_value), digiTypeName(item.type()).c_str());
 #endif
-  std::lock_guard<std::mutex> l(lock);
-  bool ret = data.emplace(key, std::move(item)).second;
+  bool ret = false;
+  if ( slot_t* slot = this->find_slot(key) )   {
+    /// Claim the slot, fill it and publish the data
+    int expected = slot_t::EMPTY;
+    ret = slot->state.compare_exchange_strong(expected, slot_t::BUSY, std::memory_order_acquire);
+    if ( ret )   {
+      slot->value.second = std::move(item);
+      slot->state.store(slot_t::VALID, std::memory_order_release);
+    }
+  }
+  else   {
+    std::lock_guard<std::mutex> l(lock);
+    ret = data.emplace(key, std::move(item)).second;
+  }
   if ( !ret )   {
     except("DataSegment","Error in DataSegment map. Duplicate ID: segment:%04X mask:%04X Number:%d Value:%s",
 	   key.mask(), key.item(), yes_no(has_value));
@@ -432,12 +907,22 @@ std::size_t DataParameters::size()  const    {
 template bool DataSegment::put(Key key, DataParameters&& data);
 template bool DataSegment::put(Key key, DepositVector&& data);
 template bool DataSegment::put(Key key, DepositMapping&& data);
+template bool DataSegment::put(Key key, DepositColumns&& data);
 template bool DataSegment::put(Key key, ParticleMapping&& data);
 template bool DataSegment::put(Key key, DetectorHistory&& data);
 template bool DataSegment::put(Key key, DetectorResponse&& data);
 
 /// Remove data item from segment
 bool DataSegment::erase(Key key)    {
+  if ( slot_t* slot = this->find_slot(key) )   {
+    int expected = slot_t::VALID;
+    if ( slot->state.compare_exchange_strong(expected, slot_t::BUSY, std::memory_order_acquire) )   {
+      slot->value.second.reset();
+      slot->state.store(slot_t::EMPTY, std::memory_order_release);
+      return true;
+    }
+    return false;
+  }
   std::lock_guard<std::mutex> l(lock);
   auto iter = data.find(key);
   if ( iter != data.end() )   {
@@ -450,21 +935,54 @@ bool DataSegment::erase(Key key)    {
 /// Remove data items from segment (locked)
 std::size_t DataSegment::erase(const std::vector<Key>& keys)   {
   std::size_t count = 0;
-  std::lock_guard<std::mutex> l(lock);
   for(const auto& key : keys)   {
-    auto iter = data.find(key);
-    if ( iter != data.end() )   {
-      data.erase(iter);
+    if ( this->erase(key) )
       ++count;
-    }
   }
   return count;
 }
 
+/// Access container size
+std::size_t DataSegment::size()  const   {
+  std::size_t count = 0;
+  for( std::size_t i = 0; i < num_slots; ++i )
+    count += slots[i].valid() ? 1 : 0;
+  return count + data.size();
+}
+
+/// Find entry by key
+DataSegment::iterator DataSegment::find(Key key)   {
+  slot_t* last = slots + num_slots;
+  if ( slot_t* slot = this->find_slot(key) )   {
+    return slot->valid() ? iterator(slot, last, data.upper_bound(key), data.end()) : end();
+  }
+  auto iter = data.find(key);
+  if ( iter == data.end() )   {
+    return end();
+  }
+  slot_t* slot = std::upper_bound(slots, last, key, [](const Key& k, const slot_t& s) { return k < s.value.first; });
+  return iterator(slot, last, iter, data.end());
+}
+
+/// Find entry by key (CONST)
+DataSegment::const_iterator DataSegment::find(Key key)  const   {
+  const slot_t* last = slots + num_slots;
+  if ( const slot_t* slot = this->find_slot(key) )   {
+    return slot->valid() ? const_iterator(slot, last, data.upper_bound(key), data.end()) : end();
+  }
+  auto iter = data.find(key);
+  if ( iter == data.end() )   {
+    return end();
+  }
+  const slot_t* slot = std::upper_bound(static_cast<const slot_t*>(slots), last, key,
+                                        [](const Key& k, const slot_t& s) { return k < s.value.first; });
+  return const_iterator(slot, last, iter, data.end());
+}
+
 /// Print segment keys
 void DataSegment::print_keys()   const   {
   size_t count = 0;
-  for( const auto& e : this->data )   {
+  for( const auto& e : *this )   {
     Key key(e.first);
     printout(INFO, "DataSegment", "Key No.%4d: %-32s %016lX -> %04X %04X %08Xld   %s",
 	     count, Key::key_name(key).c_str(), key.value(), key.segment(), key.mask(), key.item(),
@@ -488,24 +1006,32 @@ std::string DataSegment::invalid_request(Key key)  const   {
 
 /// Access data item by key
 std::any* DataSegment::get_item(Key key, bool exc)   {
-  auto it = this->data.find(key);
-  if (it != this->data.end()) return &it->second;
-  key.set_segment(0x0);
-  it = this->data.find(key);
-  if (it != this->data.end()) return &it->second;
-
+  for( int attempt = 0; attempt < 2; ++attempt )   {
+    if ( slot_t* slot = this->find_slot(key) )   {
+      if ( slot->valid() ) return &slot->value.second;
+    }
+    else   {
+      auto it = this->data.find(key);
+      if (it != this->data.end()) return &it->second;
+    }
+    key.set_segment(0x0);
+  }
   if ( exc ) throw std::runtime_error(invalid_request(std::move(key)));
   return nullptr;
 }
 
 /// Access data item by key  (CONST)
 const std::any* DataSegment::get_item(Key key, bool exc)  const   {
-  auto it = this->data.find(key);
-  if (it != this->data.end()) return &it->second;
-  key.set_segment(0x0);
-  it = this->data.find(key);
-  if (it != this->data.end()) return &it->second;
-
+  for( int attempt = 0; attempt < 2; ++attempt )   {
+    if ( const slot_t* slot = this->find_slot(key) )   {
+      if ( slot->valid() ) return &slot->value.second;
+    }
+    else   {
+      auto it = this->data.find(key);
+      if (it != this->data.end()) return &it->second;
+    }
+    key.set_segment(0x0);
+  }
   if ( exc ) throw std::runtime_error(invalid_request(std::move(key)));
   return nullptr;
 }
@@ -525,20 +1051,48 @@ DigiEvent::DigiEvent(int ev_num) : eventNumber(ev_num)
   InstanceCount::increment(this);
 }
 
+/// Intializing constructor with memory resource for the event data
+DigiEvent::DigiEvent(int ev_num, std::pmr::memory_resource* resource)
+  : DigiEvent(ev_num)
+{
+  if ( resource ) m_resource = resource;
+}
+
+/// Intializing constructor with memory resource and segment layout for the event data
+DigiEvent::DigiEvent(int ev_num, std::pmr::memory_resource* resource, SegmentLayout* layout)
+  : DigiEvent(ev_num, resource)
+{
+  m_layout = layout;
+}
+
 /// Default destructor
 DigiEvent::~DigiEvent()
 {
+  if ( m_layout )   {
+    for( const auto* segment : { &m_data, &m_counts, &m_inputs, &m_outputs, &m_deposits } )   {
+      if ( *segment ) m_layout->learn(**segment);
+    }
+  }
   InstanceCount::decrement(this);
 }
 
+/// Add the identity of one input entry to the identity of the event (locked)
+void DigiEvent::add_input_identity(uint64_t identity)   {
+  std::lock_guard<std::mutex> guard(m_lock);
+  m_input_identity += identity;
+}
+
 DataSegment& DigiEvent::access_segment(std::unique_ptr<DataSegment>& segment, Key::segment_type id)   {
   if ( segment )   {
     return *segment;
   }
   std::lock_guard<std::mutex> guard(m_lock);
   /// Check again after holding the lock:
-  if ( !segment )   {
-    segment = std::make_unique<DataSegment>(this->m_lock, id);
+  if ( !segment && m_layout )   {
+    segment = std::make_unique<DataSegment>(id, m_resource, *m_layout->keys(id));
+  }
+  else if ( !segment )   {
+    segment = std::make_unique<DataSegment>(this->m_lock, id, m_resource);
   }
   return *segment;
 }
@@ -0,0 +1,98 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DD4hep/InstanceCount.h>
+#include <DDDigi/DigiEventArena.h>
+
+// C/C++ include files
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+using namespace dd4hep::digi;
+
+namespace  {
+  /// Bytes allocated by the calling thread from any arena
+  thread_local std::size_t s_thread_allocated = 0;
+}
+
+/// Initializing constructor
+DigiEventArena::DigiEventArena(std::size_t block_size)
+  : m_block_size(std::max(block_size, std::size_t(4096)))
+{
+  InstanceCount::increment(this);
+}
+
+/// Default destructor. Releases all blocks
+DigiEventArena::~DigiEventArena()   {
+  for( auto& b : m_blocks )
+    ::operator delete(b.data);
+  m_blocks.clear();
+  InstanceCount::decrement(this);
+}
+
+/// Allocate bytes from the arena
+void* DigiEventArena::do_allocate(std::size_t bytes, std::size_t alignment)   {
+  auto place = [this, bytes, alignment](const block_t& blk) -> void*  {
+    std::uintptr_t base = reinterpret_cast<std::uintptr_t>(blk.data);
+    std::uintptr_t addr = (base + m_offset + alignment - 1) & ~std::uintptr_t(alignment - 1);
+    if ( addr + bytes > base + blk.length )
+      return nullptr;
+    m_offset = std::size_t(addr - base) + bytes;
+    m_allocated.store(m_allocated.load(std::memory_order_relaxed) + bytes, std::memory_order_relaxed);
+    s_thread_allocated += bytes;
+    return reinterpret_cast<void*>(addr);
+  };
+  std::lock_guard<std::mutex> lock(m_lock);
+  for( ; m_current < m_blocks.size(); ++m_current, m_offset = 0 )   {
+    if ( void* ptr = place(m_blocks[m_current]) )
+      return ptr;
+  }
+  // No retained block fits: grow geometrically
+  std::size_t length = m_blocks.empty() ? m_block_size : 2*m_blocks.back().length;
+  length = std::max(length, bytes + alignment);
+  m_blocks.emplace_back(block_t { static_cast<std::byte*>(::operator new(length)), length });
+  m_current = m_blocks.size() - 1;
+  m_offset  = 0;
+  return place(m_blocks.back());
+}
+
+/// Deallocate bytes: no-op. Memory is recycled by reset()
+void DigiEventArena::do_deallocate(void* /* pointer */, std::size_t /* bytes */, std::size_t /* alignment */)   {
+}
+
+/// Memory resources are only equal if they are identical
+bool DigiEventArena::do_is_equal(const std::pmr::memory_resource& other)  const noexcept   {
+  return this == &other;
+}
+
+/// Rewind the arena. The blocks are kept for further usage
+void DigiEventArena::reset()   {
+  std::lock_guard<std::mutex> lock(m_lock);
+  m_current   = 0;
+  m_offset    = 0;
+  m_allocated.store(0, std::memory_order_relaxed);
+}
+
+/// Number of bytes the calling thread allocated from any arena (monotonic, never reset)
+std::size_t DigiEventArena::thread_allocated()   {
+  return s_thread_allocated;
+}
+
+/// Total size of the memory blocks owned by the arena
+std::size_t DigiEventArena::capacity()  const   {
+  std::size_t len = 0;
+  for( const auto& b : m_blocks ) len += b.length;
+  return len;
+}
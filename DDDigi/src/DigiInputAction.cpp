@@ -13,7 +13,9 @@
 
 /// Framework include files
 #include <DD4hep/InstanceCount.h>
+#include <DDDigi/DigiData.h>
 #include <DDDigi/DigiInputAction.h>
+#include <DDDigi/DigiPhiloxEngine.h>
 
 /// C/C++ include files
 #include <stdexcept>
@@ -62,6 +64,12 @@ void DigiInputAction::onProcessEvent(input_source& source, event_frame& /* frame
   ++source.event_count = 0;
 }
 
+/// Add the identity of an input entry (input mask, source index, entry) to the event
+void DigiInputAction::record_input(DigiEvent& event, const input_source& source, uint64_t entry)  const   {
+  uint64_t input = DigiPhiloxEngine::mix(uint64_t(m_input_mask), uint64_t(source.input_index));
+  event.add_input_identity(DigiPhiloxEngine::mix(input, entry));
+}
+
 /// Check if a event object should be loaded: Default YES unless inhibited by selection or veto
 bool DigiInputAction::object_loading_is_enabled(const std::string& nam)  const   {
   /// If there are no required branches, we convert everything
@@ -21,12 +21,16 @@
 
 #include <DDDigi/DigiKernel.h>
 #include <DDDigi/DigiContext.h>
+#include <DDDigi/DigiEventArena.h>
+#include <DDDigi/DigiProfiler.h>
+#include <DDDigi/DigiPhiloxEngine.h>
 #include <DDDigi/DigiActionSequence.h>
 #include <DDDigi/DigiMonitorHandler.h>
 
 #ifdef DD4HEP_USE_TBB
 #include <tbb/task_group.h>
 #include <tbb/global_control.h>
+#include <tbb/parallel_pipeline.h>
 #else
 namespace tbb {  struct global_control { enum { max_allowed_parallelism = -1 }; }; }
 #endif
@@ -71,6 +75,11 @@ public:
   /// Lock for global output logging
   std::mutex            global_output_lock  { };
 
+  /// Lock to protect the pool of event arenas
+  std::mutex            arena_lock          { };
+  /// Event arenas not in use. Recycled from event to event
+  std::vector<std::unique_ptr<DigiEventArena> > arenas { };
+
   using callbacks_t    = std::vector<std::function<void()> >;
   using ev_callbacks_t = std::vector<std::function<void(DigiContext&)> >;
 
@@ -98,6 +107,12 @@ public:
   TRandom* root_random;
   /// Shared random number generator
   std::shared_ptr<DigiRandomGenerator> random  { };
+  /// Counter based engine for bulk random numbers
+  std::unique_ptr<DigiPhiloxEngine> batch_random { };
+  /// Action profiler (only present if enabled)
+  std::unique_ptr<DigiProfiler> profiler { };
+  /// Keys of the event data with pre-allocated segment slots
+  SegmentLayout         segment_layout      { };
   /// TBB initializer (If TBB is used)
   std::unique_ptr<tbb::global_control> tbb_init { };
   /// Property: Output level
@@ -108,6 +123,24 @@ public:
   int                   maxEventsParallel;
   /// Property: maximum number of threads to be used (if TBB)
   int                   num_threads;
+  /// Property: maximum number of events in flight in pipeline mode (if <= 0: maxEventsParallel)
+  int                   pipelineTokens;
+  /// Property: execute input, event and output sequences as separate pipeline stages (if TBB)
+  bool                  pipeline = false;
+  /// Property: Initial block size of the per-event memory arena (0: use the heap)
+  std::size_t           eventArenaSize;
+  /// Property: Seed of the counter based engine used for bulk random numbers and random streams
+  std::size_t           batchRandomSeed;
+  /// Property: Run number keying the reproducible random streams
+  std::size_t           runNumber;
+  /// Property: Output file of the profiler trace in Chrome trace format (empty: no trace)
+  std::string           profileTrace;
+  /// Property: Maximal number of profiler trace entries per thread
+  std::size_t           profileTraceLimit;
+  /// Property: Enable the action profiler
+  bool                  profile = false;
+  /// Property: Publish event data of known keys to pre-allocated segment slots without locking
+  bool                  segmentSlots = true;
   /// Property: Allow to stop execution from interactive prompt
   bool                  stop = false;
 
@@ -117,6 +150,26 @@ public:
   /// Default destructor
   ~Internals() = default;
 
+  /// Take an event arena from the pool or create a new one
+  std::unique_ptr<DigiEventArena> acquire_arena()   {
+    if ( 0 == eventArenaSize )
+      return { };
+    std::lock_guard<std::mutex> lock(arena_lock);
+    if ( arenas.empty() )
+      return std::make_unique<DigiEventArena>(eventArenaSize);
+    auto arena = std::move(arenas.back());
+    arenas.pop_back();
+    return arena;
+  }
+  /// Rewind event arena and return it to the pool
+  void release_arena(std::unique_ptr<DigiEventArena>&& arena)   {
+    if ( arena )   {
+      arena->reset();
+      std::lock_guard<std::mutex> lock(arena_lock);
+      arenas.emplace_back(std::move(arena));
+    }
+  }
+
   static std::mutex kernel_mutex;  
 };
 
@@ -167,14 +220,132 @@ public:
       }
       if ( todo >= 0 )   {
         int ev_num = kernel.internals->numEvents - todo;
+	/// The arena must outlive the event: it is only recycled once the event is deleted
+	auto arena = kernel.internals->acquire_arena();
 	std::unique_ptr<DigiContext> context = 
-	  std::make_unique<DigiContext>(this->kernel,std::make_unique<DigiEvent>(ev_num));
+	  std::make_unique<DigiContext>(this->kernel,std::make_unique<DigiEvent>(ev_num, arena.get(), this->kernel.segment_layout()));
 	context->set_random_generator(this->kernel.internals->random);
         kernel.executeEvent(std::move(context));
+	kernel.internals->release_arena(std::move(arena));
+      }
+    }
+  }
+};
+
+#ifdef DD4HEP_USE_TBB
+/// DigiKernel herlp class: TBB pipeline with separate stages for input, event and output actions
+/*
+ *  The pipeline executes
+ *  - the creation of the event context (serial),
+ *  - the input action sequence (parallel),
+ *  - the event action sequence (parallel),
+ *  - the output action sequence (serial, in event order)
+ *  as separate stages. The number of events in flight is bounded by the number of tokens.
+ *  Hence I/O bound stages overlap with compute bound stages of other events,
+ *  while the memory consumption is limited by the number of tokens.
+ *
+ *  Note: The virtual DigiKernel::executeEvent is not called in pipeline mode.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_DIGITIZATION
+ */
+class DigiKernel::Pipeline {
+  DigiKernel& kernel;
+public:
+  /// Event token passed between the pipeline stages
+  class token_t  {
+  public:
+    /// The arena must outlive the event: it is only recycled once the event is deleted
+    std::unique_ptr<DigiEventArena> arena;
+    /// Event context
+    std::unique_ptr<DigiContext>    context;
+  };
+public:
+  Pipeline(DigiKernel& k) : kernel(k) {}
+  Pipeline(Pipeline&& l) = default;
+  Pipeline(const Pipeline& l) = default;
+
+  /// Stage 0: Create the context of the next event. Returns null if no more events are to be processed
+  token_t* create()  const   {
+    int todo = -1;
+    {
+      std::lock_guard<std::mutex> lock(kernel.internals->counter_lock);
+      if( !kernel.internals->stop && kernel.internals->events_todo > 0)   {
+        todo = --kernel.internals->events_todo;
+        ++kernel.internals->events_submitted;
+      }
+    }
+    if ( todo < 0 )   {
+      return nullptr;
+    }
+    auto token = std::make_unique<token_t>();
+    int ev_num = kernel.internals->numEvents - todo;
+    token->arena   = kernel.internals->acquire_arena();
+    token->context = std::make_unique<DigiContext>(kernel, std::make_unique<DigiEvent>(ev_num, token->arena.get(), kernel.segment_layout()));
+    token->context->set_random_generator(kernel.internals->random);
+    return token.release();
+  }
+  /// Finish the event: release the context and recycle the arena
+  void finish(token_t* token, const std::exception* e)  const   {
+    if ( e ) 
+      kernel.notify(std::move(token->context), *e);
+    else
+      kernel.notify(std::move(token->context));
+    kernel.internals->release_arena(std::move(token->arena));
+    delete token;
+  }
+  /// Execute one stage. On failure the event is finished and dropped from the pipeline
+  template <typename CALL> token_t* stage(token_t* token, CALL call)  const   {
+    if ( token )   {
+      try   {
+        call(*token->context);
+      }
+      catch(const std::exception& e)   {
+        finish(token, &e);
+        return nullptr;
       }
     }
+    return token;
+  }
+  /// Run the pipeline until all events are processed
+  void operator()(std::size_t num_tokens)  const {
+    auto source = [this] (tbb::flow_control& control)  {
+      token_t* token = this->create();
+      if ( !token ) control.stop();
+      return token;
+    };
+    auto input = [this] (token_t* token)  {
+      return this->stage(token, [this] (DigiContext& context)  {
+        for(auto& call : kernel.internals->start_event) call(context);
+        DigiProfiler::scope_t scope(kernel.inputAction(), context);
+        kernel.inputAction().execute(context);
+      });
+    };
+    auto event = [this] (token_t* token)  {
+      return this->stage(token, [this] (DigiContext& context)  {
+        DigiProfiler::scope_t scope(kernel.eventAction(), context);
+        kernel.eventAction().execute(context);
+      });
+    };
+    auto output = [this] (token_t* token)  {
+      token = this->stage(token, [this] (DigiContext& context)  {
+        {
+          DigiProfiler::scope_t scope(kernel.outputAction(), context);
+          kernel.outputAction().execute(context);
+        }
+        for(auto& call : kernel.internals->end_event) call(context);
+      });
+      if ( token ) this->finish(token, nullptr);
+    };
+    tbb::parallel_pipeline(num_tokens,
+                           tbb::make_filter<void, token_t*>(tbb::filter_mode::serial_in_order, source) &
+                           tbb::make_filter<token_t*, token_t*>(tbb::filter_mode::parallel, input)    &
+                           tbb::make_filter<token_t*, token_t*>(tbb::filter_mode::parallel, event)    &
+                           tbb::make_filter<token_t*, void>(tbb::filter_mode::serial_in_order, output));
   }
 };
+#endif
 
 /// Standard constructor
 DigiKernel::DigiKernel(Detector& description_ref)
@@ -184,8 +355,17 @@ DigiKernel::DigiKernel(Detector& description_ref)
   internals->num_threads = tbb::global_control::max_allowed_parallelism;
   declareProperty("maxEventsParallel",internals->maxEventsParallel = 1);
   declareProperty("numThreads",       internals->num_threads);
+  declareProperty("pipeline",         internals->pipeline = false);
+  declareProperty("pipelineTokens",   internals->pipelineTokens = 0);
   declareProperty("numEvents",        internals->numEvents = 10);
   declareProperty("stop",             internals->stop = false);
+  declareProperty("eventArenaSize",   internals->eventArenaSize = 1024*1024);
+  declareProperty("batchRandomSeed",  internals->batchRandomSeed = 65539);
+  declareProperty("runNumber",        internals->runNumber = 0);
+  declareProperty("profile",          internals->profile = false);
+  declareProperty("profileTrace",     internals->profileTrace);
+  declareProperty("profileTraceLimit",internals->profileTraceLimit = 1000000);
+  declareProperty("segmentSlots",     internals->segmentSlots = true);
   declareProperty("OutputLevels",     internals->clientLevels);
   auto* h = new DigiMonitorHandler(*this, "MonitorData");
   properties().add("MonitorOutput", h->property("MonitorOutput"));
@@ -200,6 +380,10 @@ DigiKernel::DigiKernel(Detector& description_ref)
   internals->root_random = new TRandom();
   internals->random = std::make_shared<DigiRandomGenerator>();
   internals->random->engine = [this] {  return internals->root_random->Uniform(1.0);  };
+  internals->batch_random = std::make_unique<DigiPhiloxEngine>(internals->batchRandomSeed);
+  internals->random->batch = [this] (double* buffer, std::size_t count)  {
+    internals->batch_random->fill(buffer, count);
+  };
   InstanceCount::increment(this);
 }
 
@@ -285,6 +469,16 @@ std::size_t DigiKernel::events_processing()  const   {
   return evts;
 }
 
+/// Access the action profiler. Returns null if profiling is disabled
+DigiProfiler* DigiKernel::profiler()  const   {
+  return internals->profiler.get();
+}
+
+/// Access the keys of the event data with pre-allocated segment slots. Returns null if disabled
+SegmentLayout* DigiKernel::segment_layout()  const   {
+  return internals->segmentSlots ? &internals->segment_layout : nullptr;
+}
+
 /// Construct detector geometry using description plugin
 void DigiKernel::loadGeometry(const std::string& compact_file) {
   char* arg = (char*) compact_file.c_str();
@@ -305,6 +499,9 @@ int DigiKernel::configure()   {
 
 /// Initialize the digitization: call all registered initializers
 int DigiKernel::initialize()   {
+  internals->batch_random->seed(internals->batchRandomSeed);
+  internals->random->stream_seed = internals->batchRandomSeed;
+  internals->random->stream_run  = internals->runNumber;
   for(auto& call : internals->initializers) call();
   return 1;
 }
@@ -408,9 +605,18 @@ void DigiKernel::executeEvent(std::unique_ptr<DigiContext>&& context)    {
   DigiContext& refContext = *context;
   try {
     for(auto& call : internals->start_event) call(refContext);
-    inputAction().execute(refContext);
-    eventAction().execute(refContext);
-    outputAction().execute(refContext);
+    {
+      DigiProfiler::scope_t scope(inputAction(), refContext);
+      inputAction().execute(refContext);
+    }
+    {
+      DigiProfiler::scope_t scope(eventAction(), refContext);
+      eventAction().execute(refContext);
+    }
+    {
+      DigiProfiler::scope_t scope(outputAction(), refContext);
+      outputAction().execute(refContext);
+    }
     for(auto& call : internals->end_event) call(refContext);
     notify(std::move(context));
   }
@@ -444,6 +650,14 @@ int DigiKernel::run()   {
   internals->events_finished = 0;
   internals->events_submitted = 0;
   internals->events_todo = internals->numEvents;
+  if ( internals->profile )   {
+    std::size_t limit = internals->profileTrace.empty() ? 0 : internals->profileTraceLimit;
+    if ( internals->profiler ) internals->profiler->reset(limit);
+    else internals->profiler = std::make_unique<DigiProfiler>(limit);
+  }
+  else   {
+    internals->profiler.reset();
+  }
   info("+++ Total number of events:    %d",internals->numEvents);
 #ifdef DD4HEP_USE_TBB
   if ( !internals->tbb_init && internals->num_threads > 0 )   {
@@ -454,7 +668,19 @@ int DigiKernel::run()   {
       info("+++ Number of TBB threads:     %d",internals->num_threads);
       info("+++ Number of parallel events: %d",internals->maxEventsParallel);
       internals->tbb_init = std::make_unique<ctrl_t>(ctrl_t::max_allowed_parallelism,internals->num_threads+1);
-      if ( internals->maxEventsParallel >= 0 )   {
+      if ( internals->pipeline )   {
+	int num_tokens = internals->pipelineTokens > 0
+	  ? internals->pipelineTokens : std::max(1, internals->maxEventsParallel);
+	info("+++ Pipeline mode with %d events in flight", num_tokens);
+	try  {
+	  Pipeline(*this)(num_tokens);
+	}
+	catch(const std::exception& e)    {
+	  internals->stop = true;
+	  error("run: +++ C++ exception. Event loop stop. [%s]", e.what());
+	}
+      }
+      else if ( internals->maxEventsParallel >= 0 )   {
 	int todo_evt = internals->events_todo;
 	int num_proc = std::min(todo_evt,internals->maxEventsParallel);
 	tbb::task_group main_group;
@@ -487,6 +713,15 @@ int DigiKernel::run()   {
        "Total: %7.1f seconds %7.3f seconds/event",
        internals->numEvents-int(internals->events_todo), internals->numEvents,
        sec, sec/double(std::max(1,internals->numEvents)));
+  if ( internals->profiler )   {
+    internals->profiler->print_summary();
+    if ( !internals->profileTrace.empty() )   {
+      if ( internals->profiler->write_trace(internals->profileTrace) )
+        info("+++ Profiler trace written to %s", internals->profileTrace.c_str());
+      else
+        error("+++ Failed to write profiler trace to %s", internals->profileTrace.c_str());
+    }
+  }
   return 1;
 }
 
@@ -0,0 +1,61 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DDDigi/DigiPhiloxEngine.h>
+
+using namespace dd4hep::digi;
+
+/// Initializing constructor
+DigiPhiloxEngine::DigiPhiloxEngine(uint64_t seed_value, uint64_t stream)
+  : m_key(seed_value), m_stream(stream)
+{
+}
+
+/// Re-seed the engine and rewind the counter
+void DigiPhiloxEngine::seed(uint64_t seed_value, uint64_t stream)   {
+  m_key    = seed_value;
+  m_stream = stream;
+  m_counter.store(0);
+}
+
+/// Fill buffer with uniform random numbers in ]0,1[
+void DigiPhiloxEngine::fill(double* buffer, std::size_t count)   {
+  uint64_t first = m_counter.fetch_add((count+1)/2);
+  uniform(m_key, m_stream, first, buffer, count);
+}
+
+/// Single uniform random number in ]0,1[
+double DigiPhiloxEngine::operator()()   {
+  double value;
+  fill(&value, 1);
+  return value;
+}
+
+/// Stateless generation: uniform random numbers of (key, stream) starting with counter 'first'
+void DigiPhiloxEngine::uniform(uint64_t key, uint64_t stream, uint64_t first, double* buffer, std::size_t count)   {
+  const uint32_t s0 = uint32_t(stream), s1 = uint32_t(stream >> 32);
+  const std::size_t pairs = count/2;
+  // No loop carried dependencies: the compiler may vectorize this loop
+  for( std::size_t i = 0; i < pairs; ++i )   {
+    uint64_t ctr = first + i;
+    block_t  r   = philox(block_t { { uint32_t(ctr), uint32_t(ctr >> 32), s0, s1 } }, key);
+    buffer[2*i]   = to_double(r.v[0], r.v[1]);
+    buffer[2*i+1] = to_double(r.v[2], r.v[3]);
+  }
+  if ( count & 1 )   {
+    uint64_t ctr = first + pairs;
+    block_t  r   = philox(block_t { { uint32_t(ctr), uint32_t(ctr >> 32), s0, s1 } }, key);
+    buffer[count-1] = to_double(r.v[0], r.v[1]);
+  }
+}
@@ -0,0 +1,264 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DD4hep/InstanceCount.h>
+#include <DDDigi/DigiContext.h>
+#include <DDDigi/DigiPileupInput.h>
+
+/// C/C++ include files
+#include <algorithm>
+#include <iterator>
+
+using namespace dd4hep::digi;
+
+namespace  {
+  /// Convert a container to a read-only shared view
+  template <typename T> bool to_view(std::any& data, std::any& view, std::size_t& bytes)   {
+    if ( T* cont = std::any_cast<T>(&data) )   {
+      bytes += cont->size() * sizeof(typename T::container_t::value_type);
+      view   = shared_view_t<T>(std::make_shared<T>(std::move(*cont)));
+      return true;
+    }
+    return false;
+  }
+
+  /// Move the keys of a history record to another mask
+  void remap_history(History& history, Key::mask_type mask)   {
+    for( auto& entry : history.hits )
+      entry.source = Key(entry.source).set_mask(mask).value();
+    for( auto& entry : history.particles )
+      entry.source = Key(entry.source).set_mask(mask).value();
+  }
+  /// Copy a deposit container to another mask
+  template <typename T> T remap(const T& cont, Key::mask_type mask)   {
+    T copy(cont);
+    copy.key.set_mask(mask);
+    for( auto& dep : copy )   {
+      dep.second.mask = mask;
+      remap_history(dep.second.history, mask);
+    }
+    return copy;
+  }
+  /// Copy a particle container to another mask
+  ParticleMapping remap(const ParticleMapping& cont, Key::mask_type mask)   {
+    ParticleMapping copy(cont.name, mask);
+    for( const auto& p : cont )
+      copy.push(Key(p.first).set_mask(mask), Particle(p.second));
+    return copy;
+  }
+  /// Copy a detector history container to another mask
+  DetectorHistory remap(const DetectorHistory& cont, Key::mask_type mask)   {
+    DetectorHistory copy(cont);
+    copy.key.set_mask(mask);
+    for( auto& h : copy )
+      remap_history(h.second, mask);
+    return copy;
+  }
+  /// Copy a detector response container to another mask
+  DetectorResponse remap(const DetectorResponse& cont, Key::mask_type mask)   {
+    DetectorResponse copy(cont);
+    copy.key.set_mask(mask);
+    return copy;
+  }
+  /// Copy a shared view to another mask
+  template <typename T> bool remap_view(const std::any& view, std::any& result, Key::mask_type mask, std::size_t& bytes)   {
+    if ( const auto* v = std::any_cast<shared_view_t<T> >(&view) )   {
+      auto copy = std::make_shared<T>(remap(**v, mask));
+      bytes += copy->size() * sizeof(typename T::container_t::value_type);
+      result = shared_view_t<T>(std::move(copy));
+      return true;
+    }
+    return false;
+  }
+}
+
+/// Standard constructor
+DigiPileupInput::DigiPileupInput(const DigiKernel& krnl, const std::string& nam)
+  : DigiEventAction(krnl, nam)
+{
+  declareProperty("input_segment", m_input_segment);
+  declareProperty("mean_pileup",   m_mean_pileup);
+  declareProperty("max_pileup",    m_max_pileup);
+  declareProperty("first_mask",    m_first_mask);
+  declareProperty("pool_size",     m_pool_size);
+  declareProperty("pool_memory",   m_pool_memory);
+  declareProperty("max_reuse",     m_max_reuse);
+  InstanceCount::increment(this);
+}
+
+/// Default destructor
+DigiPileupInput::~DigiPileupInput()   {
+  info("+++ Decoded %ld minimum bias events for %ld pile-up events.", m_num_decoded, m_num_used);
+  m_pool.clear();
+  dd4hep::detail::releasePtr(m_reader);
+  InstanceCount::decrement(this);
+}
+
+/// Adopt the reader action used to decode the minimum bias events
+void DigiPileupInput::adopt(DigiEventAction* action)   {
+  if ( action )   {
+    action->addRef();
+    dd4hep::detail::releasePtr(m_reader);
+    m_reader = action;
+    return;
+  }
+  except("+++ Attempt to adopt invalid reader action!");
+}
+
+/// Decode the next minimum bias event using the reader action
+DigiPileupInput::pool_entry_t DigiPileupInput::decode(context_t& context)  const   {
+  if ( !m_reader )   {
+    except("+++ No reader action present. Did you call DigiPileupInput::adopt?");
+  }
+  std::size_t number = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_pool_lock);
+    number = m_num_decoded++;
+  }
+  /// The decoded data must outlive the signal event: use a private event with heap allocation
+  DigiContext local(context.kernel, std::make_unique<DigiEvent>(int(number)));
+  m_reader->execute(local);
+
+  auto entry = std::make_shared<pool_event_t>();
+  auto& segment = local.event->get_segment(m_input_segment);
+  entry->number = number;
+  for( auto& i : segment )   {
+    std::any view;
+    if ( to_view<DepositVector>(i.second, view, entry->bytes)      ||
+         to_view<DepositMapping>(i.second, view, entry->bytes)     ||
+         to_view<DepositHashMapping>(i.second, view, entry->bytes) ||
+         to_view<ParticleMapping>(i.second, view, entry->bytes)    ||
+         to_view<DetectorHistory>(i.second, view, entry->bytes)    ||
+         to_view<DetectorResponse>(i.second, view, entry->bytes) )   {
+      entry->views[Key(i.first).mask()].emplace_back(i.first, std::move(view));
+      continue;
+    }
+    debug("%s+++ Ignore pile-up container %s of type %s", context.event->id(),
+          Key::key_name(i.first).c_str(), digiTypeName(i.second).c_str());
+  }
+  return entry;
+}
+
+/// Add newly decoded event to the pool and evict old events if the pool is full
+void DigiPileupInput::insert(pool_entry_t entry)  const   {
+  const std::size_t max_bytes = m_pool_memory * 1024 * 1024;
+  std::lock_guard<std::mutex> lock(m_pool_lock);
+  m_pool_bytes += entry->bytes;
+  entry->pooled = true;
+  m_pool.emplace_front(std::move(entry));
+  /// Evict the least recently used events. Events still in use stay alive until released
+  while( m_pool.size() > 1 && (m_pool.size() > m_pool_size || m_pool_bytes > max_bytes) )   {
+    m_pool_bytes -= m_pool.back()->bytes;
+    m_pool.back()->pooled = false;
+    m_pool.pop_back();
+  }
+}
+
+/// Access the views of a pooled event with all keys moved to the requested mask
+const DigiPileupInput::pool_event_t::views_t&
+DigiPileupInput::views(pool_event_t& entry, Key::mask_type mask)  const   {
+  std::lock_guard<std::mutex> lock(entry.lock);
+  auto iter = entry.views.find(mask);
+  if ( iter != entry.views.end() )   {
+    return iter->second;
+  }
+  /// Particle keys and history records must refer to the new mask: copy the containers
+  pool_event_t::views_t result;
+  std::size_t bytes = 0;
+  if ( !entry.views.empty() )   {
+    const auto& source = entry.views.begin()->second;
+    result.reserve(source.size());
+    for( const auto& v : source )   {
+      std::any view;
+      if ( remap_view<DepositVector>(v.second, view, mask, bytes)      ||
+           remap_view<DepositMapping>(v.second, view, mask, bytes)     ||
+           remap_view<DepositHashMapping>(v.second, view, mask, bytes) ||
+           remap_view<ParticleMapping>(v.second, view, mask, bytes)    ||
+           remap_view<DetectorHistory>(v.second, view, mask, bytes)    ||
+           remap_view<DetectorResponse>(v.second, view, mask, bytes) )   {
+        Key key(v.first);
+        result.emplace_back(key.set_mask(mask), std::move(view));
+      }
+    }
+  }
+  {
+    std::lock_guard<std::mutex> pool_lock(m_pool_lock);
+    entry.bytes += bytes;
+    if ( entry.pooled ) m_pool_bytes += bytes;
+  }
+  return entry.views.emplace(mask, std::move(result)).first->second;
+}
+
+/// Sample one pile-up event from the pool. Decode new events if necessary
+DigiPileupInput::pool_entry_t DigiPileupInput::sample(context_t& context)  const   {
+  const std::size_t max_bytes = m_pool_memory * 1024 * 1024;
+  {
+    std::lock_guard<std::mutex> lock(m_pool_lock);
+    ++m_num_used;
+    /// Only sample from the pool once it is filled. Otherwise decode new events
+    if ( !m_pool.empty() && (m_pool.size() >= m_pool_size || m_pool_bytes >= max_bytes) )   {
+      std::size_t which = std::size_t(context.randomGenerator().uniform(double(m_pool.size())));
+      auto iter = std::next(m_pool.begin(), std::min(which, m_pool.size()-1));
+      pool_entry_t entry = *iter;
+      if ( m_max_reuse > 0 && ++entry->used >= m_max_reuse )   {
+        /// Exhausted: drop from the pool. The next request decodes a new event
+        m_pool_bytes -= entry->bytes;
+        entry->pooled = false;
+        m_pool.erase(iter);
+      }
+      else   {
+        m_pool.splice(m_pool.begin(), m_pool, iter);
+      }
+      return entry;
+    }
+  }
+  /// Decode outside the pool lock: other events may continue to sample
+  pool_entry_t entry = decode(context);
+  entry->used = 1;
+  if ( m_max_reuse != 1 )   {
+    insert(entry);
+  }
+  return entry;
+}
+
+/// Callback to place the pile-up events to the input segment
+void DigiPileupInput::execute(context_t& context)  const   {
+  auto& event   = *context.event;
+  auto& segment = event.get_segment(m_input_segment);
+  std::size_t num_pileup = std::size_t(context.randomGenerator().poisson(m_mean_pileup));
+  std::size_t num_conts  = 0;
+
+  num_pileup = std::min(num_pileup, m_max_pileup);
+  for( std::size_t i = 0; i < num_pileup; ++i )   {
+    pool_entry_t entry = sample(context);
+    Key::mask_type mask = Key::mask_type(m_first_mask + i);
+    for( const auto& v : this->views(*entry, mask) )   {
+      Key key(v.first);
+      key.set_segment(segment.id);
+      std::any view(v.second);
+      segment.emplace_any(key, std::move(view));
+      ++num_conts;
+    }
+    debug("%s+++ Pile-up event %3ld: minimum bias event %6ld [used %ld times] mask: $%04X",
+          event.id(), i, entry->number, entry->used, mask);
+  }
+  std::size_t pool_events = 0, pool_bytes = 0;
+  {
+    std::lock_guard<std::mutex> lock(m_pool_lock);
+    pool_events = m_pool.size();
+    pool_bytes  = m_pool_bytes;
+  }
+  info("%s+++ Added %3ld pile-up events [%ld containers]. Pool: %ld events %ld kB",
+       event.id(), num_pileup, num_conts, pool_events, pool_bytes/1024);
+}
@@ -0,0 +1,198 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DD4hep/Printout.h>
+#include <DD4hep/InstanceCount.h>
+#include <DDDigi/DigiData.h>
+#include <DDDigi/DigiAction.h>
+#include <DDDigi/DigiProfiler.h>
+#include <DDDigi/DigiEventArena.h>
+
+/// C/C++ include files
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <ctime>
+
+using namespace dd4hep::digi;
+
+namespace  {
+  /// Source of unique profiler identifiers
+  std::atomic<std::size_t> s_profiler_id { 0 };
+
+  /// Bytes the calling thread allocated so far from event arenas (0 if the event uses the heap)
+  std::size_t arena_bytes(const DigiContext* context)   {
+    if ( context && context->event )   {
+      if ( dynamic_cast<const DigiEventArena*>(context->event->memory_resource()) )
+        return DigiEventArena::thread_allocated();
+    }
+    return 0;
+  }
+
+  /// Write string to JSON output with escapes
+  void json_string(std::FILE* file, const std::string& value)   {
+    std::fputc('"', file);
+    for( char c : value )   {
+      if ( c == '"' || c == '\\' ) std::fputc('\\', file);
+      if ( static_cast<unsigned char>(c) >= 0x20 ) std::fputc(c, file);
+    }
+    std::fputc('"', file);
+  }
+}
+
+/// Start the measurement
+void DigiProfiler::scope_t::begin()   {
+  bytes = arena_bytes(context);
+  cpu   = thread_cpu_time();
+  start = clock_t::now();
+}
+
+/// Stop the measurement and record the result
+void DigiProfiler::scope_t::end()   {
+  auto   stop  = clock_t::now();
+  double used  = thread_cpu_time() - cpu;
+  std::size_t allocated = arena_bytes(context);
+  profiler->record(*action, *context, start, stop, used, items, allocated > bytes ? allocated - bytes : 0);
+}
+
+/// Initializing constructor
+DigiProfiler::DigiProfiler(std::size_t trace_limit)   {
+  reset(trace_limit);
+  InstanceCount::increment(this);
+}
+
+/// Default destructor
+DigiProfiler::~DigiProfiler()   {
+  InstanceCount::decrement(this);
+}
+
+/// Clear all measurements and restart
+void DigiProfiler::reset(std::size_t trace_limit)   {
+  std::lock_guard<std::mutex> lock(m_lock);
+  m_threads.clear();
+  m_trace_limit = trace_limit;
+  m_start = clock_t::now();
+  m_id    = ++s_profiler_id;
+}
+
+/// CPU time of the calling thread in seconds
+double DigiProfiler::thread_cpu_time()   {
+  struct timespec ts;
+  if ( 0 == ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) )
+    return double(ts.tv_sec) + 1e-9 * double(ts.tv_nsec);
+  return 0e0;
+}
+
+/// Access the measurements of the current thread
+DigiProfiler::thread_data_t& DigiProfiler::thread_data()   {
+  thread_local std::size_t    tls_id   = 0;
+  thread_local thread_data_t* tls_data = nullptr;
+  if ( tls_id != m_id || !tls_data )   {
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_threads.emplace_back(std::make_unique<thread_data_t>());
+    tls_data = m_threads.back().get();
+    tls_data->thread = m_threads.size();
+    tls_id = m_id;
+  }
+  return *tls_data;
+}
+
+/// Record one action call
+void DigiProfiler::record(const DigiAction& action, const DigiContext& context,
+                          clock_t::time_point start, clock_t::time_point stop,
+                          double cpu, std::size_t items, std::size_t bytes)
+{
+  using usec_t = std::chrono::microseconds;
+  thread_data_t& data = thread_data();
+  counter_t& cnt = data.counters[&action];
+  ++cnt.calls;
+  cnt.items += items;
+  cnt.bytes += bytes;
+  cnt.cpu   += cpu;
+  cnt.wall  += std::chrono::duration<double>(stop - start).count();
+  if ( data.traces.size() < m_trace_limit )   {
+    trace_t trace;
+    trace.action = &action;
+    trace.event  = context.event ? context.event->eventNumber : -1;
+    trace.start  = std::chrono::duration_cast<usec_t>(start - m_start).count();
+    trace.length = std::chrono::duration_cast<usec_t>(stop - start).count();
+    trace.items  = items;
+    data.traces.emplace_back(trace);
+  }
+}
+
+/// Print the summary table of all actions
+void DigiProfiler::print_summary()  const   {
+  struct summary_t  {
+    counter_t   total   { };
+    std::size_t threads { 0 };
+  };
+  std::map<const DigiAction*, summary_t> summary;
+  {
+    std::lock_guard<std::mutex> lock(m_lock);
+    for( const auto& thr : m_threads )   {
+      for( const auto& c : thr->counters )   {
+        auto& s = summary[c.first];
+        s.total.calls += c.second.calls;
+        s.total.items += c.second.items;
+        s.total.bytes += c.second.bytes;
+        s.total.wall  += c.second.wall;
+        s.total.cpu   += c.second.cpu;
+        ++s.threads;
+      }
+    }
+  }
+  std::vector<std::pair<const DigiAction*, summary_t> > sorted(summary.begin(), summary.end());
+  std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b)  {
+    return a.second.total.wall > b.second.total.wall;
+  });
+  const char* tag = "DigiProfiler";
+  printout(ALWAYS, tag, "+%s+", std::string(132, '-').c_str());
+  printout(ALWAYS, tag, "| %-40s %9s %7s %12s %12s %12s %12s %14s |",
+           "Action", "Calls", "Threads", "Wall [ms]", "Wall/call", "CPU [ms]", "Items", "Arena [kB]");
+  printout(ALWAYS, tag, "+%s+", std::string(132, '-').c_str());
+  for( const auto& e : sorted )   {
+    const auto& t = e.second.total;
+    printout(ALWAYS, tag, "| %-40s %9ld %7ld %12.3f %12.4f %12.3f %12ld %14.1f |",
+             e.first->name().substr(0, 40).c_str(), t.calls, e.second.threads,
+             1e3 * t.wall, 1e3 * t.wall / double(std::max(t.calls, std::size_t(1))),
+             1e3 * t.cpu, t.items, double(t.bytes) / 1024e0);
+  }
+  printout(ALWAYS, tag, "+%s+", std::string(132, '-').c_str());
+}
+
+/// Write the recorded calls in the Chrome trace event format
+bool DigiProfiler::write_trace(const std::string& file_name)  const   {
+  std::FILE* file = std::fopen(file_name.c_str(), "w");
+  if ( !file )   {
+    return false;
+  }
+  bool first = true;
+  std::lock_guard<std::mutex> lock(m_lock);
+  std::fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  for( const auto& thr : m_threads )   {
+    std::fprintf(file, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%ld,"
+                 "\"args\":{\"name\":\"Thread %ld\"}}", first ? "" : ",", thr->thread, thr->thread);
+    first = false;
+    for( const auto& t : thr->traces )   {
+      std::fprintf(file, ",\n{\"name\":");
+      json_string(file, t.action->name());
+      std::fprintf(file, ",\"cat\":\"digi\",\"ph\":\"X\",\"pid\":1,\"tid\":%ld,\"ts\":%lld,\"dur\":%lld,"
+                   "\"args\":{\"event\":%d,\"items\":%ld}}",
+                   thr->thread, (long long)t.start, (long long)t.length, t.event, t.items);
+    }
+  }
+  std::fprintf(file, "\n]}\n");
+  return 0 == std::fclose(file);
+}
@@ -19,6 +19,15 @@
 #include <TROOT.h>
 #include <TFile.h>
 #include <TTree.h>
+#include <TBranch.h>
+#include <TClass.h>
+
+/// C/C++ include files
+#include <condition_variable>
+#include <exception>
+#include <thread>
+#include <deque>
+#include <tuple>
 
 using namespace dd4hep::digi;
 
@@ -58,7 +67,31 @@ public:
  */
 class DigiROOTInput::internals_t   {
 public:
-  using source_t = std::unique_ptr<inputsource_t>;
+  using source_t = std::shared_ptr<inputsource_t>;
+
+  /// Event entry decoded by the read-ahead thread
+  class frame_t   {
+  public:
+    /// Input source the entry was read from
+    source_t  source  { };
+    /// Entry number in the input tree
+    Long64_t  entry   { -1 };
+    /// Total number of bytes read
+    std::size_t bytes { 0 };
+    /// Objects read from the branches: (container, object, bytes)
+    std::vector<std::tuple<container_t*, void*, Long64_t> > objects { };
+  public:
+    /// Default constructor
+    frame_t() = default;
+    /// Default destructor. Deletes the objects not yet handled
+    ~frame_t()   {
+      for( auto& o : objects )   {
+        if ( std::get<1>(o) ) std::get<0>(o)->clazz.Destructor(std::get<1>(o));
+      }
+    }
+  };
+  using frame_queue_t = std::deque<std::unique_ptr<frame_t> >;
+
   /// Reference to parent action
   DigiROOTInput* m_parent       { nullptr };
   /// Handle to input source
@@ -66,15 +99,36 @@ public:
   /// Pointer to current input source
   int            m_curr_input   { INPUT_START };
 
+  /// Read-ahead: queue of decoded entries
+  frame_queue_t           m_queue        { };
+  /// Read-ahead: lock protecting the queue
+  std::mutex              m_queue_lock   { };
+  /// Read-ahead: signal new entries in the queue
+  std::condition_variable m_queue_filled { };
+  /// Read-ahead: signal free space in the queue
+  std::condition_variable m_queue_space  { };
+  /// Read-ahead: reader thread
+  std::thread             m_reader       { };
+  /// Read-ahead: exception thrown by the reader thread
+  std::exception_ptr      m_error        { };
+  /// Read-ahead: stop flag for the reader thread
+  bool                    m_stop         { false };
+
 public:
   /// Default constructor
   internals_t (DigiROOTInput* p);
   /// Default destructor
-  ~internals_t () = default;
+  ~internals_t ();
   /// Access the next valid event entry
   inputsource_t& next();
   /// Open the next input source from the input list
   std::unique_ptr<inputsource_t> open_source();
+  /// Read-ahead: body of the reader thread
+  void read_ahead();
+  /// Read-ahead: read one entry and decode all branches
+  std::unique_ptr<frame_t> read_frame();
+  /// Read-ahead: take the next decoded entry from the queue. Starts the reader thread if necessary
+  std::unique_ptr<frame_t> pop();
 };
 
 /// Default constructor
@@ -83,6 +137,19 @@ DigiROOTInput::internals_t::internals_t (DigiROOTInput* p)
 {
 }
 
+/// Default destructor
+DigiROOTInput::internals_t::~internals_t ()   {
+  {
+    std::lock_guard<std::mutex> lock(m_queue_lock);
+    m_stop = true;
+  }
+  m_queue_space.notify_all();
+  if ( m_reader.joinable() )   {
+    m_reader.join();
+  }
+  m_queue.clear();
+}
+
 /// Open the next input source from the input list
 std::unique_ptr<DigiROOTInput::inputsource_t> DigiROOTInput::internals_t::open_source()   {
   const auto& inputs    = m_parent->inputs();
@@ -113,6 +180,14 @@ std::unique_ptr<DigiROOTInput::inputsource_t> DigiROOTInput::internals_t::open_s
       auto source   = std::make_unique<inputsource_t>();
       source->file  = std::move(file);
       source->tree  = tree;
+      source->input_index = m_curr_input;
+      if ( m_parent->m_cache_size > 0 )   {
+        tree->SetCacheSize(m_parent->m_cache_size);
+      }
+      if ( m_parent->m_implicit_mt )   {
+        if ( !ROOT::IsImplicitMTEnabled() ) ROOT::EnableImplicitMT();
+        tree->SetImplicitMT(true);
+      }
       auto* branches = tree->GetListOfBranches();
       int mask = m_parent->input_mask();
       TObjArrayIter it(branches);
@@ -123,6 +198,9 @@ std::unique_ptr<DigiROOTInput::inputsource_t> DigiROOTInput::internals_t::open_s
 	  Key key(b->GetName(), mask);
 	  b->SetAutoDelete(kFALSE);
 	  source->branches.emplace(key, container_t(key, *b, *cls));
+	  if ( m_parent->m_cache_size > 0 )   {
+	    tree->AddBranchToCache(b, kTRUE);
+	  }
 	}
       }
       if ( source->branches.empty() )    {
@@ -146,10 +224,78 @@ DigiROOTInput::inputsource_t& DigiROOTInput::internals_t::next()   {
   return src;
 }
 
+/// Read-ahead: read one entry and decode all branches
+std::unique_ptr<DigiROOTInput::internals_t::frame_t> DigiROOTInput::internals_t::read_frame()   {
+  std::lock_guard<std::mutex> lock(m_parent->m_kernel.global_io_lock());
+  auto  frame  = std::make_unique<frame_t>();
+  auto& source = next();
+  frame->source = m_source;
+  frame->entry  = source.entry;
+  frame->objects.reserve(source.branches.size());
+  for( auto& b : source.branches )    {
+    auto& ent = b.second;
+    /// Every entry is read into a new object, which is handed over to the event
+    ent.object = ent.clazz.New();
+    ent.branch.SetAddress(&ent.object);
+    Long64_t bytes = ent.branch.GetEntry( source.entry );
+    frame->objects.emplace_back(&ent, ent.object, bytes);
+    frame->bytes += bytes > 0 ? bytes : 0;
+    ent.object = nullptr;
+  }
+  return frame;
+}
+
+/// Read-ahead: body of the reader thread
+void DigiROOTInput::internals_t::read_ahead()   {
+  const std::size_t depth = m_parent->m_prefetch;
+  try   {
+    while( true )   {
+      {
+        std::unique_lock<std::mutex> lock(m_queue_lock);
+        m_queue_space.wait(lock, [this, depth] { return m_stop || m_queue.size() < depth; });
+        if ( m_stop ) return;
+      }
+      auto frame = read_frame();
+      {
+        std::lock_guard<std::mutex> lock(m_queue_lock);
+        m_queue.emplace_back(std::move(frame));
+      }
+      m_queue_filled.notify_one();
+    }
+  }
+  catch(...)   {
+    std::lock_guard<std::mutex> lock(m_queue_lock);
+    m_error = std::current_exception();
+  }
+  m_queue_filled.notify_all();
+}
+
+/// Read-ahead: take the next decoded entry from the queue. Starts the reader thread if necessary
+std::unique_ptr<DigiROOTInput::internals_t::frame_t> DigiROOTInput::internals_t::pop()   {
+  std::unique_ptr<frame_t> frame;
+  {
+    std::unique_lock<std::mutex> lock(m_queue_lock);
+    if ( !m_reader.joinable() )   {
+      m_reader = std::thread([this] { this->read_ahead(); });
+    }
+    m_queue_filled.wait(lock, [this] { return !m_queue.empty() || m_error; });
+    if ( m_queue.empty() )   {
+      std::rethrow_exception(m_error);
+    }
+    frame = std::move(m_queue.front());
+    m_queue.pop_front();
+  }
+  m_queue_space.notify_one();
+  return frame;
+}
+
 /// Standard constructor
 DigiROOTInput::DigiROOTInput(const DigiKernel& kernel, const std::string& nam)
   : DigiInputAction(kernel, nam)
 {
+  declareProperty("prefetch",    m_prefetch    = 0);
+  declareProperty("cache_size",  m_cache_size  = 0);
+  declareProperty("implicit_mt", m_implicit_mt = false);
   imp = std::make_unique<internals_t>(this);
   InstanceCount::increment(this);
 }
@@ -162,13 +308,39 @@ DigiROOTInput::~DigiROOTInput()   {
 
 /// Pre-track action callback
 void DigiROOTInput::execute(DigiContext& context)  const   {
+  auto& event = context.event;
+  std::size_t input_len = 0;
+  if ( m_prefetch > 0 )   {
+    //
+    //  Entries were read by the read-ahead thread: No ROOT I/O here, no global lock necessary.
+    //
+    auto frame = imp->pop();
+    DataSegment& segment = event->get_segment(m_input_segment);
+    for( auto& o : frame->objects )    {
+      auto&    ent   = *std::get<0>(o);
+      Long64_t bytes = std::get<2>(o);
+      if ( bytes > 0 )  {
+        work_t work { segment, ent, std::get<1>(o) };
+        (*this)(context, work);
+        input_len += bytes;
+      }
+      ent.clazz.Destructor(std::get<1>(o));
+      std::get<1>(o) = nullptr;
+      debug("%s+++ Loaded %8ld bytes from branch %s", event->id(), bytes, ent.branch.GetName());
+    }
+    record_input(*event, *frame->source, frame->entry);
+    info("%s+++ Read event %6ld [%ld bytes] from tree %s file: %s (prefetched)",
+         event->id(), frame->entry, input_len, frame->source->tree->GetName(), frame->source->file->GetName());
+    /// The frame may hold the last reference to an input file: close it with the I/O lock
+    std::lock_guard<std::mutex> lock(context.global_io_lock());
+    frame.reset();
+    return;
+  }
   //
   //  We have to lock all ROOT based actions. Consequences are SEGV otherwise.
   //
   std::lock_guard<std::mutex> lock(context.global_io_lock());
-  auto& event = context.event;
   auto& source = imp->next();
-  std::size_t input_len = 0;
 
   /// We only get here with a valid input
   DataSegment& segment = event->get_segment(m_input_segment);
@@ -176,12 +348,13 @@ void DigiROOTInput::execute(DigiContext& context)  const   {
     auto& ent = b.second;
     Long64_t bytes = ent.branch.GetEntry( source.entry );
     if ( bytes > 0 )  {
-      work_t work { segment, ent };
+      work_t work { segment, ent, *(void**)ent.branch.GetAddress() };
       (*this)(context, work);
       input_len += bytes;
     }
     debug("%s+++ Loaded %8ld bytes from branch %s", event->id(), bytes, ent.branch.GetName());
   }
+  record_input(*event, source, source.entry);
   info("%s+++ Read event %6ld [%ld bytes] from tree %s file: %s",
        event->id(), source.entry, input_len, source.tree->GetName(), source.file->GetName());
 }
@@ -28,6 +28,7 @@
 #include <Math/ProbFuncMathCore.h>
 #include <Math/SpecFuncMathCore.h>
 #include <Math/QuantFuncMathCore.h>
+#include <algorithm>
 #include <cmath>
 
 
@@ -243,3 +244,102 @@ void   DigiRandomGenerator::circle(double &x, double &y, double r)   const  {
   x = r*std::cos(phi);
   y = r*std::sin(phi);
 }
+
+/// Fill buffer with uniform random numbers in [x1, x2]
+void DigiRandomGenerator::fill_uniform(double* buffer, std::size_t count, double x1, double x2)  const   {
+  if ( batch )   {
+    batch(buffer, count);
+  }
+  else   {
+    for( std::size_t i=0; i < count; ++i )
+      buffer[i] = engine();
+  }
+  if ( x1 != 0.0 || x2 != 1.0 )   {
+    const double width = x2 - x1;
+    for( std::size_t i=0; i < count; ++i )
+      buffer[i] = x1 + width*buffer[i];
+  }
+}
+
+/// Fill buffer with exponentially distributed random numbers
+void DigiRandomGenerator::fill_exponential(double* buffer, std::size_t count, double tau)  const   {
+  fill_uniform(buffer, count);
+  for( std::size_t i=0; i < count; ++i )
+    buffer[i] = -tau * std::log(buffer[i]);
+}
+
+/// Fill buffer with gaussian random numbers (Box-Muller)
+void DigiRandomGenerator::fill_gaussian(double* buffer, std::size_t count, double mean, double sigma)  const   {
+  const std::size_t pairs = count/2;
+  fill_uniform(buffer, 2*pairs);
+  for( std::size_t i=0; i < pairs; ++i )   {
+    double r   = sigma * std::sqrt(-2.0*std::log(buffer[2*i]));
+    double phi = TWOPI * buffer[2*i+1];
+    buffer[2*i]   = mean + r*std::cos(phi);
+    buffer[2*i+1] = mean + r*std::sin(phi);
+  }
+  if ( count & 1 )   {
+    buffer[count-1] = gaussian(mean, sigma);
+  }
+}
+
+/// Fill buffer with landau distributed random numbers
+void DigiRandomGenerator::fill_landau(double* buffer, std::size_t count, double mu, double sigma)  const   {
+  if ( sigma <= 0 )   {
+    std::fill(buffer, buffer+count, 0e0);
+    return;
+  }
+  fill_uniform(buffer, count);
+  for( std::size_t i=0; i < count; ++i )
+    buffer[i] = mu + ROOT::Math::landau_quantile(buffer[i], sigma);
+}
+
+/// Fill buffer with poisson distributed random numbers
+void DigiRandomGenerator::fill_poisson(double* buffer, std::size_t count, double mean)  const   {
+  if ( mean <= 0 )   {
+    std::fill(buffer, buffer+count, 0e0);
+  }
+  else if ( mean < 25 )   {
+    // Inversion of the cumulative distribution: exactly one uniform number per value
+    const double expmean = std::exp(-mean);
+    fill_uniform(buffer, count);
+    for( std::size_t i=0; i < count; ++i )   {
+      double u = buffer[i], p = expmean, cumulated = expmean;
+      int    n = 0;
+      while( u > cumulated && p > 0e0 )   {
+        ++n;
+        p *= mean/n;
+        cumulated += p;
+      }
+      buffer[i] = static_cast<double>(n);
+    }
+  }
+  else   {
+    for( std::size_t i=0; i < count; ++i )
+      buffer[i] = poisson(mean);
+  }
+}
+
+/// Initializing constructor
+DigiCellRandom::DigiCellRandom(uint64_t key, uint32_t event, uint64_t cell)
+  : m_key(key), m_cell(cell), m_event(event)
+{
+  this->engine = [this] ()  {  return this->next();  };
+  this->batch  = [this] (double* buffer, std::size_t count)  {
+    for( std::size_t i=0; i < count; ++i ) buffer[i] = this->next();
+  };
+}
+
+namespace {
+  /// Philox key of a cell stream: seed, run, processor and input
+  uint64_t stream_key(const DigiRandomGenerator& generator, uint64_t input, uint64_t processor)   {
+    uint64_t key = DigiPhiloxEngine::mix(generator.stream_seed, generator.stream_run);
+    return DigiPhiloxEngine::mix(DigiPhiloxEngine::mix(key, processor), input);
+  }
+}
+
+/// Initializing constructor: stream of a cell keyed by (seed, run, input, cell, processor)
+DigiCellRandom::DigiCellRandom(const DigiRandomGenerator& generator, uint64_t input, uint64_t cell, uint64_t processor)
+  : DigiCellRandom(stream_key(generator, input, processor), uint32_t(input), cell)
+{
+}
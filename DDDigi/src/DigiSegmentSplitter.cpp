@@ -17,10 +17,70 @@
 #include <DDDigi/DigiKernel.h>
 #include <DDDigi/DigiContext.h>
 #include <DDDigi/DigiPlugins.h>
+#include <DDDigi/DigiProfiler.h>
 #include <DDDigi/DigiSegmentSplitter.h>
 
+/// C/C++ include files
+#include <algorithm>
+
 using namespace dd4hep::digi;
 
+namespace {
+  /// Create an empty deposit container with the identity of an existing one
+  template <typename T> T empty_like(const T& cont)   {
+    T empty(cont.name, cont.key.mask(), cont.data_type);
+    empty.key = cont.key;
+    return empty;
+  }
+  template <> DepositMapping empty_like(const DepositMapping& cont)   {
+    DepositMapping empty(cont.name, cont.key.mask(), cont.data_type, cont.data.get_allocator().resource());
+    empty.key = cont.key;
+    return empty;
+  }
+}
+
+/// Parallel call to process one slice of the partitioned input container
+/**
+ *  All workers handling the same split identifier are called sequentially
+ *  on the same slice.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \ingroup DD4HEP_DIGITIZATION
+ */
+class DigiSegmentSplitter::slice_call_t : public ParallelWorker  {
+public:
+  using predicate_t = DigiContainerProcessor::predicate_t;
+  /// Workers to be called for this slice
+  std::vector<const worker_t*> workers;
+  /// Slice data: always a DepositVector
+  std::any                     data;
+  /// Work definition pointing to the slice
+  work_t                       work;
+  /// Split identifier of this slice
+  uint32_t                     split_id;
+
+  /// Initializing constructor
+  slice_call_t(const work_t& w, uint32_t id, DepositVector&& slice)
+    : data(std::move(slice)), work(w), split_id(id)
+  {
+    this->work.input.data = &this->data;
+  }
+  /// Access the slice
+  DepositVector& slice()   {
+    return *std::any_cast<DepositVector>(&this->data);
+  }
+  /// Process the slice: the deposits are already selected, no need to check the split again
+  virtual void execute(void* /* args */)  const override   {
+    for( const auto* w : workers )   {
+      predicate_t pred(predicate_t::always_true, split_id, &w->options);
+      work_t      wrk(this->work);
+      DigiProfiler::scope_t scope(*w->action, wrk.environ.context, wrk.input_size());
+      w->action->execute(wrk.environ.context, wrk, pred);
+    }
+  }
+};
+
 /// Default copy constructor
 DigiSegmentProcessContext::DigiSegmentProcessContext(const DigiSegmentContext& copy)
   : DigiSegmentContext(copy)
@@ -50,6 +110,7 @@ template <> void DigiParallelWorker<DigiContainerProcessor,
 				    DigiContainerProcessor::work_t,
 				    DigiSegmentProcessContext>::execute(void* ptr) const  {
   calldata_t* args  = reinterpret_cast<calldata_t*>(ptr);
+  DigiProfiler::scope_t scope(*action, args->environ.context, args->input_size());
   action->execute(args->environ.context, *args, this->options.predicate);
 }
 
@@ -63,6 +124,7 @@ DigiSegmentSplitter::DigiSegmentSplitter(const kernel_t& kernel, const std::stri
   declareProperty("split_by",        m_split_by);
   declareProperty("processor_type",  m_processor_type);
   declareProperty("share_processor", m_share_processor = false);
+  declareProperty("partition",       m_partition = false);
   m_kernel.register_initialize(std::bind(&DigiSegmentSplitter::initialize,this));
   InstanceCount::increment(this);
 }
@@ -154,6 +216,85 @@ void DigiSegmentSplitter::adopt_segment_processor(DigiContainerProcessor* action
     adopt_segment_processor(action, split_id);
 }
 
+/// Partition the deposits by split identifier and let each worker process its slice
+template <typename T>
+void DigiSegmentSplitter::process_slices(context_t& context, work_t& work, T& container)  const   {
+  auto group = m_workers.get_group();
+  std::vector<uint32_t> ids;
+  for( const auto* w : group.actors() )
+    ids.emplace_back(w->options.predicate.id);
+  std::sort(ids.begin(), ids.end());
+  ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+  /// Single pass over the input: bucket number of every deposit. ids.size() marks unhandled deposits
+  const std::size_t num_buckets = ids.size() + 1;
+  std::vector<uint32_t>    bucket;
+  std::vector<std::size_t> counts(num_buckets, 0);
+  bucket.reserve(container.size());
+  for( const auto& dep : container )   {
+    uint32_t id  = m_split_context.split_id(dep.first);
+    auto     pos = std::lower_bound(ids.begin(), ids.end(), id);
+    uint32_t b   = uint32_t((pos != ids.end() && *pos == id) ? pos - ids.begin() : ids.size());
+    bucket.emplace_back(b);
+    ++counts[b];
+  }
+  /// Move the deposits to their slices
+  std::vector<DepositVector> slices(num_buckets);
+  for( std::size_t b = 0; b < num_buckets; ++b )   {
+    slices[b] = DepositVector(container.name, container.key.mask(), container.data_type);
+    slices[b].reserve(counts[b]);
+  }
+  std::size_t idx = 0;
+  for( auto& dep : container )
+    slices[bucket[idx++]].emplace(dep.first, std::move(dep.second));
+
+  /// Dispatch only the non-empty slices
+  std::vector<std::unique_ptr<slice_call_t> > calls(ids.size());
+  for( std::size_t b = 0; b < ids.size(); ++b )   {
+    if ( counts[b] > 0 )
+      calls[b] = std::make_unique<slice_call_t>(work, ids[b], std::move(slices[b]));
+  }
+  std::vector<ParallelCall*> todo;
+  for( const auto* w : group.actors() )   {
+    std::size_t b = std::lower_bound(ids.begin(), ids.end(), w->options.predicate.id) - ids.begin();
+    if ( calls[b] )   {
+      if ( calls[b]->workers.empty() ) todo.emplace_back(calls[b].get());
+      calls[b]->workers.emplace_back(w);
+    }
+  }
+  info("%s+++ Partitioned %ld deposits into %ld of %ld splits [%ld unhandled]",
+       context.event->id(), container.size(), todo.size(), ids.size(), counts.back());
+  if ( !todo.empty() )   {
+    m_kernel.submit(context, todo, &work, m_parallel);
+  }
+
+  /// Move the processed deposits back to the input container
+  for( std::size_t b = 0; b < ids.size(); ++b )   {
+    if ( calls[b] ) slices[b] = std::move(calls[b]->slice());
+  }
+  bool same_size = true;
+  for( std::size_t b = 0; b < num_buckets; ++b )
+    same_size &= (slices[b].size() == counts[b]);
+  if ( same_size )   {
+    /// Restore in place: keeps the order of the input container
+    std::vector<DepositVector::iterator> next;
+    for( auto& slice : slices ) next.emplace_back(slice.begin());
+    idx = 0;
+    for( auto& dep : container )   {
+      uint32_t b = bucket[idx++];
+      dep.second = std::move((next[b]++)->second);
+    }
+    return;
+  }
+  /// Processors removed deposits: rebuild the container slice by slice
+  T output = empty_like(container);
+  for( auto& slice : slices )   {
+    for( auto& dep : slice )
+      output.emplace(dep.first, std::move(dep.second));
+  }
+  container = std::move(output);
+}
+
 /// Main functional callback
 void DigiSegmentSplitter::execute(context_t& context, work_t& work, const predicate_t& /* predicate */)  const    {
   Key key = work.input_key();
@@ -163,6 +304,14 @@ void DigiSegmentSplitter::execute(context_t& context, work_t& work, const predic
     if ( work.has_input() )   {
       info("%s+++ Got hit collection %04X %08X. Prepare processors for %sparallel execution.",
 	   context.event->id(), key.mask(), key.item(), m_parallel ? "" : "NON-");
+      if ( m_partition )   {
+	if ( auto* v = work.get_input<DepositVector>() )
+	  return process_slices(context, work, *v);
+	else if ( auto* m = work.get_input<DepositMapping>() )
+	  return process_slices(context, work, *m);
+	else if ( auto* h = work.get_input<DepositHashMapping>() )
+	  return process_slices(context, work, *h);
+      }
       m_kernel.submit(context, m_workers.get_group(), m_workers.size(), &work, m_parallel);
     }
   }
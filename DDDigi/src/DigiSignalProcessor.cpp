@@ -14,6 +14,12 @@
 // Framework include files
 #include <DD4hep/InstanceCount.h>
 #include <DDDigi/DigiSignalProcessor.h>
+#include <DDDigi/DigiSegmentation.h>
+
+/// C/C++ include files
+#include <cmath>
+#include <limits>
+#include <vector>
 
 /// Standard constructor
 dd4hep::digi::DigiSignalProcessor::DigiSignalProcessor(const DigiKernel& krnl, const std::string& nam)
@@ -32,3 +38,57 @@ void dd4hep::digi::DigiSignalProcessor::initialize()   {
   m_initialized = true;
 }
 
+/// Bulk callback: compute the values for 'count' cells with the given signals
+void dd4hep::digi::DigiSignalProcessor::generate(DigiContext& context,
+                                                 const double* signals,
+                                                 double* values,
+                                                 std::size_t count)  const   {
+  DigiCellData data;
+  DigiCellContext cell(context, data);
+  for( std::size_t i=0; i < count; ++i )   {
+    data.signal = signals[i];
+    values[i] = (*this)(cell);
+  }
+}
+
+/// Apply the signal processor to all deposits of a container
+std::size_t dd4hep::digi::DigiSignalProcessor::apply(DigiContext& context, DepositVector& deposits)  const   {
+  std::size_t count = deposits.size(), updated = 0;
+  std::vector<double> signals, values(count);
+  signals.reserve(count);
+  for( const auto& dep : deposits )
+    signals.emplace_back(dep.second.deposit);
+  this->generate(context, signals.data(), values.data(), count);
+  std::size_t i = 0;
+  for( auto& dep : deposits )   {
+    if ( values[i] != 0e0 )   {
+      dep.second.deposit += values[i];
+      dep.second.flag |= EnergyDeposit::DEPOSIT_NOISE;
+      ++updated;
+    }
+    ++i;
+  }
+  return updated;
+}
+
+/// Apply the signal processor to all entries of a detector response
+std::size_t dd4hep::digi::DigiSignalProcessor::apply(DigiContext& context, DetectorResponse& response)  const   {
+  constexpr double max_adc = double(std::numeric_limits<ADCValue::value_t>::max());
+  std::size_t count = response.size(), updated = 0;
+  std::vector<double> signals, values(count);
+  signals.reserve(count);
+  for( const auto& r : response )
+    signals.emplace_back(double(r.second.value));
+  this->generate(context, signals.data(), values.data(), count);
+  std::size_t i = 0;
+  for( auto& r : response )   {
+    double adc = std::round(signals[i] + values[i]);
+    adc = adc < 0e0 ? 0e0 : (adc > max_adc ? max_adc : adc);
+    if ( ADCValue::value_t(adc) != r.second.value )   {
+      r.second.value = ADCValue::value_t(adc);
+      ++updated;
+    }
+    ++i;
+  }
+  return updated;
+}
@@ -15,6 +15,7 @@
 #include <DD4hep/InstanceCount.h>
 #include <DDDigi/DigiKernel.h>
 #include <DDDigi/DigiContext.h>
+#include <DDDigi/DigiProfiler.h>
 #include <DDDigi/DigiSynchronize.h>
 
 // C/C++ include files
@@ -26,6 +27,7 @@ using namespace dd4hep::digi;
 template <> void 
 DigiParallelWorker<DigiEventAction, DigiSynchronize::work_t, std::size_t, DigiSynchronize&>::execute(void* data) const  {
   calldata_t* args = reinterpret_cast<calldata_t*>(data);
+  DigiProfiler::scope_t scope(*action, *args);
   action->execute(*args);
 }
 
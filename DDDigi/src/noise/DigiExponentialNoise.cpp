@@ -36,3 +36,8 @@ DigiExponentialNoise::~DigiExponentialNoise() {
 double DigiExponentialNoise::operator()(DigiCellContext& context)  const  {
   return context.context.randomGenerator().exponential(m_tau);
 }
+
+/// Bulk callback to generate exponential noise for 'count' cells
+void DigiExponentialNoise::generate(DigiContext& context, const double* /* signals */, double* values, std::size_t count)  const  {
+  context.randomGenerator().fill_exponential(values, count, m_tau);
+}
@@ -23,7 +23,7 @@ using namespace dd4hep::digi;
 DigiLandauNoise::DigiLandauNoise(const DigiKernel& krnl, const std::string& nam)
   : DigiSignalProcessor(krnl, nam)
 {
-  declareProperty("meam",    m_mean);
+  declareProperty("mean",    m_mean);
   declareProperty("sigma",   m_sigma);
   declareProperty("cutoff",  m_cutoff);
   InstanceCount::increment(this);
@@ -40,3 +40,12 @@ double DigiLandauNoise::operator()(DigiCellContext& context)  const  {
     return 0;
   return context.context.randomGenerator().landau(m_mean,m_sigma);
 }
+
+/// Bulk callback to generate landau noise for 'count' cells
+void DigiLandauNoise::generate(DigiContext& context, const double* signals, double* values, std::size_t count)  const  {
+  auto& random = context.randomGenerator();
+  random.fill_landau(values, count, m_mean, m_sigma);
+  for( std::size_t i=0; i < count; ++i )   {
+    if ( signals[i] < m_cutoff ) values[i] = 0e0;
+  }
+}
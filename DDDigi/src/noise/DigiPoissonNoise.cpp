@@ -23,7 +23,7 @@ using namespace dd4hep::digi;
 DigiPoissonNoise::DigiPoissonNoise(const DigiKernel& krnl, const std::string& nam)
   : DigiSignalProcessor(krnl, nam)
 {
-  declareProperty("meam",    m_mean);
+  declareProperty("mean",    m_mean);
   declareProperty("cutoff",  m_cutoff);
   InstanceCount::increment(this);
 }
@@ -39,3 +39,12 @@ double DigiPoissonNoise::operator()(DigiCellContext& context)  const  {
     return 0;
   return context.context.randomGenerator().poisson(m_mean);
 }
+
+/// Bulk callback to generate poisson noise for 'count' cells
+void DigiPoissonNoise::generate(DigiContext& context, const double* signals, double* values, std::size_t count)  const  {
+  auto& random = context.randomGenerator();
+  random.fill_poisson(values, count, m_mean);
+  for( std::size_t i=0; i < count; ++i )   {
+    if ( signals[i] >= m_cutoff ) values[i] = 0e0;
+  }
+}
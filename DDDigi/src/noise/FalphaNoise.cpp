@@ -400,6 +400,12 @@ void FalphaNoise::normalizeVariance(const random_engine_wrapper& generator, size
   m_distribution = std::normal_distribution<double>(0.0, m_variance);
 }
 
+/// Transform a buffer of normal distributed white noise (mean 0, sigma 1) in place to 1/f**alpha noise
+void FalphaNoise::transform(double* values, std::size_t count)   {
+  for( std::size_t i=0; i < count; ++i )
+    values[i] = compute(m_variance * values[i]);
+}
+
 /// Retrieve the next random number of the sequence
 double FalphaNoise::compute(double rndm_value)   {
 #ifdef  __GSL_FALPHA_NOISE
@@ -40,10 +40,13 @@ namespace dd4hep {
     protected:
       /// Reference to the detector description field
       OverlayedField m_field;
+      /// Flag to use the per-thread lookup cache of the overlayed field
+      bool           m_useCache { true };
 
     public:
       /// Constructor. The sensitive detector element is identified by the detector name
-      Geant4Field(OverlayedField field) : m_field(field) {   }
+      Geant4Field(OverlayedField field, bool use_cache = true)
+        : m_field(field), m_useCache(use_cache) {   }
       /// Standard destructor
       virtual ~Geant4Field() {    }
       /// Access field values at a given point
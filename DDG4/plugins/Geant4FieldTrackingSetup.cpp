@@ -58,6 +58,8 @@ namespace dd4hep {
       double      eps_max;
       /// G4PropagatorInField parameter: LargestAcceptableStep
       double      largest_step;
+      /// Use the per-thread lookup cache of the overlayed field
+      bool        use_field_cache;
 
     public:
       /// Default constructor
@@ -180,6 +182,7 @@ Geant4FieldTrackingSetup::Geant4FieldTrackingSetup() : eq_typ(), stepper_typ() {
   delta_one_step     = -1.0;
   delta_intersection = -1.0;
   largest_step       = -1.0;
+  use_field_cache    = true;
 }
 
 /// Default destructor
@@ -193,7 +196,7 @@ int Geant4FieldTrackingSetup::execute(Detector& description)   {
   G4TransportationManager* transportMgr;
   G4PropagatorInField*     propagator;
   G4FieldManager*          fieldManager;
-  G4MagneticField*         mag_field    = new sim::Geant4Field(fld);
+  G4MagneticField*         mag_field    = new sim::Geant4Field(fld, use_field_cache);
   G4Mag_EqRhs*             mag_equation = PluginService::Create<G4Mag_EqRhs*>(eq_typ,mag_field);
   G4EquationOfMotion*      mag_eq       = mag_equation;
   if ( nullptr == mag_eq )   {
@@ -253,6 +256,7 @@ static long setup_fields(dd4hep::Detector& description,
       if ( pm["delta_one_step"] ) delta_one_step = pm.toDouble("delta_one_step");
       if ( pm["delta_intersection"] ) delta_intersection = pm.toDouble("delta_intersection");
       if ( pm["largest_step"] ) largest_step = pm.toDouble("largest_step");
+      if ( pm["field_cache"] ) use_field_cache = dd4hep::_toBool(pm.value("field_cache"));
     }
     virtual ~XMLFieldTrackingSetup() {}
   } setup(vals);
@@ -272,6 +276,7 @@ Geant4FieldTrackingSetupAction::Geant4FieldTrackingSetupAction(Geant4Context* ct
   declareProperty("eps_min",            eps_min = -1.0);
   declareProperty("eps_max",            eps_max = -1.0);
   declareProperty("largest_step",       largest_step = -1.0);
+  declareProperty("field_cache",        use_field_cache = true);
 }
 
 /// Post-track action callback
@@ -299,6 +304,7 @@ Geant4FieldTrackingConstruction::Geant4FieldTrackingConstruction(Geant4Context*
   declareProperty("eps_min",            eps_min = -1.0);
   declareProperty("eps_max",            eps_max = -1.0);
   declareProperty("largest_step",       largest_step = -1.0);
+  declareProperty("field_cache",        use_field_cache = true);
 }
 
 /// Detector construction callback
@@ -28,7 +28,10 @@ void Geant4Field::GetFieldValue(const double pos[4], double *field) const {
   static const double fac2 = CLHEP::tesla/units::tesla;
   double p[3] = {pos[0]*fac1, pos[1]*fac1, pos[2]*fac1}; // Convert from CLHEP units to tgeo units
   field[0] = field[1] = field[2] = 0.0;                  // Reset field vector
-  m_field.magneticField(p, field);
+  if ( m_useCache )
+    m_field.cachedMagneticField(p, field);               // Reuses the components of the last region
+  else
+    m_field.magneticField(p, field);
   field[0] *= fac2;                                      // Convert from tgeo units to CLHEP units
   field[1] *= fac2;
   field[2] *= fac2;
@@ -19,9 +19,15 @@
 
 #include "DDSegmentation/Segmentation.h"
 
+#include <map>
 #include <set>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
+#include <unordered_map>
 
+class TGeoNavigator;
 
 namespace dd4hep {
   namespace rec {
@@ -32,6 +38,12 @@ namespace dd4hep {
     /** Utility for position to cellID and cellID to position conversions.
      *  (Correctly re-implements some of the functionality of the deprecated IDDecoder).
      *
+     *  At construction the Readout of every DetElement known to the VolumeManager and the
+     *  composed volume-to-world matrix of every volume context are precomputed, so that
+     *  after the context lookup a position conversion needs no further searches.
+     *  Only the nominal placements enter the caches, which are not affected by alignment
+     *  updates. The caches are read-only after construction: concurrent conversions are safe.
+     *
      * @author F.Gaede, DESY
      * @date May 2017
      */
@@ -48,12 +60,10 @@ namespace dd4hep {
     public:
       
       /// The constructor - takes the main description object.
-      CellIDPositionConverter(const Detector& description ) : _description( &description )  {
-        _volumeManager = VolumeManager::getVolumeManager(description);
-      }
+      CellIDPositionConverter(const Detector& description ) ;
 
       /// Destructor
-      virtual ~CellIDPositionConverter(){} ;
+      virtual ~CellIDPositionConverter() ;
       
       /** Return the nominal global position for a given cellID of a sensitive volume.
        *  No Alignment corrections are applied.
@@ -67,13 +77,42 @@ namespace dd4hep {
        */
       Position position(const CellID& cellID) const;
 
+      /** Return the nominal global positions for a collection of cellIDs of sensitive volumes.
+       *  The cells are grouped by their volume context, so that the readout, the segmentation
+       *  and the volume-to-world transformation are resolved only once per group. The
+       *  transformation is then applied to all cells of the group in one tight loop.
+       *  The position of cells[i] is stored in positions[i]; the caller provides a buffer
+       *  of at least count entries.
+       *  No Alignment corrections are applied.
+       */
+      void positionNominal(const CellID* cells, std::size_t count, Position* positions) const;
+
+      /** Return the global positions for a collection of cellIDs of sensitive volumes.
+       *  Alignment corrections are applied (TO BE DONE).
+       *  See positionNominal(const CellID*, std::size_t, Position*) for details.
+       */
+      void position(const CellID* cells, std::size_t count, Position* positions) const;
+
 
       /** Return the global cellID for the given global position.
        *  Note: this call is rather slow - only use it when really needed !
-       *  
+       *  The geometry is navigated with a navigator owned by the converter and private to
+       *  the calling thread, hence the call is thread-safe and does not touch the state of
+       *  the global navigator.
+       *  Note: shapes keeping per-thread scratch data require the TGeoManager to be set
+       *  to multi-threaded mode (TGeoManager::SetMaxThreads).
+       *  If the point is not inside a sensitive volume, 0 is returned.
        */
       CellID cellID(const Position& global) const;
 
+      /** Return the global cellIDs for a collection of global positions.
+       *  The cellID of globals[i] is stored in cells[i]; the caller provides a buffer
+       *  of at least count entries. One per-thread navigator is used for all points:
+       *  for spatially ordered points the search starts close to the previous location.
+       *  See cellID(const Position&) for details.
+       */
+      void cellID(const Position* globals, std::size_t count, CellID* cells) const;
+
 
 
       /** Find the context with DetElement, placements etc for a given cellID of a sensitive volume.
@@ -117,8 +156,34 @@ namespace dd4hep {
     std::vector<double> cellDimensions(const CellID& cell) const ;
 
     protected:
+
+      /// Cached data of one volume context: readout, segmentation and volume-to-world matrix
+      struct ContextData {
+        Readout      readout{} ;
+        Segmentation segmentation{} ;
+        double       rotation[9] ;
+        double       translation[3] ;
+      } ;
+
+      /// Build the readout and context caches from the VolumeManager
+      void buildCaches() ;
+      /// Resolve readout, segmentation and volume-to-world matrix of a volume context
+      void fillContextData(const VolumeManagerContext* context, ContextData& data) const ;
+      /// Access the cached data of a volume context. Returns NULL if the context is unknown
+      const ContextData* contextData(const VolumeManagerContext* context) const ;
+      /// Access the navigator of the calling thread. Created on first use and not registered to the TGeoManager
+      TGeoNavigator* navigator() const ;
+
       VolumeManager _volumeManager{} ;
       const Detector* _description ;
+      /// Cache of the readout for every DetElement known to the VolumeManager
+      std::unordered_map<const DetElement::Object*, Readout> _readoutCache{} ;
+      /// Cache of readout and composed volume-to-world matrix per volume context
+      std::unordered_map<const VolumeManagerContext*, ContextData> _contextCache{} ;
+      /// Navigators of the threads calling cellID(). They live as long as the converter
+      mutable std::map<std::thread::id, TGeoNavigator*> _navigators{} ;
+      /// Lock protecting the navigator map
+      mutable std::mutex _navigatorLock{} ;
 
     };
 
@@ -17,12 +17,114 @@
 #include <DD4hep/detail/VolumeManagerInterna.h>
 
 #include <TGeoManager.h>
+#include <TGeoNavigator.h>
+
+#include <algorithm>
 
 namespace dd4hep {
   namespace rec {
 
     using std::set;
 
+    namespace {
+
+      /// Apply the cached volume-to-world transformation to a local position
+      inline Position toGlobal( const double r[9], const double t[3], const Position& local ) {
+	const double lx = local.x(), ly = local.y(), lz = local.z() ;
+	return Position( t[0] + r[0]*lx + r[1]*ly + r[2]*lz,
+			 t[1] + r[3]*lx + r[4]*ly + r[5]*lz,
+			 t[2] + r[6]*lx + r[7]*ly + r[8]*lz ) ;
+      }
+
+      /// Locate the point with the given navigator and encode the cellID of the sensitive volume
+      CellID navigateCellID( TGeoNavigator* nav, const Position& global ) {
+
+	PlacedVolume pv = nav->FindNode( global.x() , global.y() , global.z() ) ;
+
+	if( ! ( pv.isValid() && pv.volume().isSensitive() ) )
+	  return 0 ;
+
+	double g[3], l[3] ;
+	global.GetCoordinates( g ) ;
+	nav->GetCurrentMatrix()->MasterToLocal( g, l );
+
+	SensitiveDetector sd = pv.volume().sensitiveDetector();
+	Readout r = sd.readout() ;
+	IDDescriptor idSpec = r.idSpec() ;
+
+	// encode the volIDs of all nodes on the navigator's stack - except the world at level 0
+	VolumeID volIDPVs = 0 ;
+	for( int up = 0, level = nav->GetLevel() ; up < level ; ++up ) {
+	  PlacedVolume node = nav->GetMother( up ) ;
+	  for( const auto& id : node.volIDs() )
+	    volIDPVs |= IDDescriptor::encode( idSpec.field( id.first ), id.second ) ;
+	}
+
+	return r.segmentation().cellID( Position( l[0], l[1], l[2] ) , global, volIDPVs  );
+      }
+    }
+
+    CellIDPositionConverter::CellIDPositionConverter(const Detector& description ) : _description( &description )  {
+      _volumeManager = VolumeManager::getVolumeManager(description);
+      buildCaches() ;
+    }
+
+    CellIDPositionConverter::~CellIDPositionConverter() {
+      for( auto& it : _navigators )
+	delete it.second ;
+      _navigators.clear() ;
+    }
+
+    TGeoNavigator* CellIDPositionConverter::navigator() const {
+      std::lock_guard<std::mutex> lock( _navigatorLock ) ;
+      TGeoNavigator*& nav = _navigators[ std::this_thread::get_id() ] ;
+      if( ! nav ) {
+	nav = new TGeoNavigator( _description->world().volume()->GetGeoManager() ) ;
+	nav->BuildCache( kTRUE, kFALSE ) ;
+      }
+      return nav ;
+    }
+
+    void CellIDPositionConverter::fillContextData(const VolumeManagerContext* context, ContextData& data) const {
+
+      DetElement det = context->element ;
+      data.readout = findReadout( det ) ;
+      data.segmentation = data.readout.isValid() ? data.readout.segmentation() : Segmentation() ;
+
+      TGeoHMatrix volToGlobal( det.nominal().worldTransformation() ) ;
+      volToGlobal.Multiply( &context->toElement() ) ;
+      const double* rot = volToGlobal.GetRotationMatrix() ;
+      const double* tr  = volToGlobal.GetTranslation() ;
+      std::copy( rot, rot + 9, data.rotation ) ;
+      std::copy( tr,  tr  + 3, data.translation ) ;
+    }
+
+    void CellIDPositionConverter::buildCaches() {
+
+      if( ! _volumeManager.isValid() )
+	return ;
+
+      std::vector<const detail::VolumeManagerObject*> sections = { _volumeManager.ptr() } ;
+      for( const auto& it : _volumeManager->subdetectors )
+	sections.emplace_back( it.second.ptr() ) ;
+
+      for( const auto* section : sections ) {
+	for( const auto& it : section->volumes ) {
+	  const VolumeManagerContext* context = it.second ;
+	  DetElement det = context->element ;
+	  if( _readoutCache.find( det.ptr() ) == _readoutCache.end() )
+	    _readoutCache.emplace( det.ptr(), findReadout( det ) ) ;
+	  fillContextData( context, _contextCache[ context ] ) ;
+	}
+      }
+    }
+
+    const CellIDPositionConverter::ContextData*
+    CellIDPositionConverter::contextData(const VolumeManagerContext* context) const {
+      auto it = _contextCache.find( context ) ;
+      return it == _contextCache.end() ? NULL : &it->second ;
+    }
+
     const VolumeManagerContext*
     CellIDPositionConverter::findContext(const CellID& cellID) const {
       return _volumeManager.lookupContext( cellID ) ;
@@ -38,93 +140,114 @@ namespace dd4hep {
 
     Position CellIDPositionConverter::positionNominal(const CellID& cell) const {
 
-      double l[3], e[3], g[3];
-
       const VolumeManagerContext* context = findContext( cell ) ;
 
       if( context == NULL)
 	return Position() ;
 
-      DetElement det = context->element ;
-      
+      // use the cached readout and matrix - or resolve them if the context was added later
+      ContextData tmp ;
+      const ContextData* data = contextData( context ) ;
+      if( data == NULL ) {
+	fillContextData( context, tmp ) ;
+	data = &tmp ;
+      }
 
-#if 0  // this uses the deprecated VolumeManagerContext::placement
-      
-      PlacedVolume pv = context->placement ;
+      Position local = data->segmentation.position(cell);
 
-      if( ! pv.volume().isSensitive() )
-	return Position() ;
-	
-      SensitiveDetector sd = pv.volume().sensitiveDetector();
-      Readout r = sd.readout() ;
+      return toGlobal( data->rotation, data->translation, local ) ;
+    }
 
-#else
 
-      // use a recursive search for the Readout
-      
-      Readout r = findReadout( det ) ;
+    void CellIDPositionConverter::position(const CellID* cells, std::size_t count, Position* positions) const {
 
-#endif
+      // untill we have the alignment map object, we return the nominal positions
 
-      Segmentation seg = r.segmentation() ;
-      Position local = seg.position(cell);
-      
-      local.GetCoordinates(l);
+      positionNominal( cells, count, positions ) ;
+    }
 
-      const TGeoMatrix& volToElement = context->toElement();
-      volToElement.LocalToMaster(l, e);
+    void CellIDPositionConverter::positionNominal(const CellID* cells, std::size_t count, Position* positions) const {
 
-      const TGeoMatrix& elementToGlobal = det.nominal().worldTransformation();
-      elementToGlobal.LocalToMaster(e, g);
+      typedef std::pair<const VolumeManagerContext*, std::size_t> Entry ;
 
+      // resolve the contexts and group the cells by context
+      std::vector<Entry> order ;
+      order.reserve( count ) ;
+      for( std::size_t i = 0 ; i < count ; ++i )
+	order.emplace_back( findContext( cells[i] ), i ) ;
+      std::sort( order.begin(), order.end() ) ;
 
-      return Position(g[0], g[1], g[2]);
-    }
+      std::vector<double> x, y, z ;
+      std::vector<CellID> groupCells ;
+      std::vector<Position> local ;
 
+      for( std::size_t begin = 0, end = 0 ; begin < count ; begin = end ) {
 
+	const VolumeManagerContext* context = order[begin].first ;
+	for( end = begin + 1 ; end < count && order[end].first == context ; ++end ) ;
 
+	if( context == NULL ) {
+	  for( std::size_t k = begin ; k < end ; ++k )
+	    positions[ order[k].second ] = Position() ;
+	  continue ;
+	}
 
-    CellID CellIDPositionConverter::cellID(const Position& global) const {
+	// resolve readout, segmentation and the volume-to-world matrix once per group
+	ContextData tmp ;
+	const ContextData* data = contextData( context ) ;
+	if( data == NULL ) {
+	  fillContextData( context, tmp ) ;
+	  data = &tmp ;
+	}
+	const Segmentation& seg = data->segmentation ;
+	const double* rot = data->rotation ;
+	const double* tr  = data->translation ;
+	const double r00 = rot[0], r01 = rot[1], r02 = rot[2], t0 = tr[0] ;
+	const double r10 = rot[3], r11 = rot[4], r12 = rot[5], t1 = tr[1] ;
+	const double r20 = rot[6], r21 = rot[7], r22 = rot[8], t2 = tr[2] ;
+
+	// gather the cells of the group and compute the local positions in one segmentation call
+	const std::size_t n = end - begin ;
+	groupCells.resize( n ) ; local.resize( n ) ;
+	for( std::size_t k = 0 ; k < n ; ++k )
+	  groupCells[k] = cells[ order[begin+k].second ] ;
+	seg.position( groupCells.data(), n, local.data() ) ;
+
+	x.resize( n ) ; y.resize( n ) ; z.resize( n ) ;
+	for( std::size_t k = 0 ; k < n ; ++k ) {
+	  x[k] = local[k].x() ; y[k] = local[k].y() ; z[k] = local[k].z() ;
+	}
 
-      CellID result(0) ;
-      
-      TGeoManager *geoManager = _description->world().volume()->GetGeoManager() ;
-      
-      PlacedVolume pv = geoManager->FindNode( global.x() , global.y() , global.z() ) ;
-      
-      if(  pv.isValid() && pv.volume().isSensitive() ) {
+	// apply the transformation on the structure-of-arrays: the matrix lives in registers
+	double* px = x.data() ;
+	double* py = y.data() ;
+	double* pz = z.data() ;
+	for( std::size_t k = 0 ; k < n ; ++k ) {
+	  const double lx = px[k], ly = py[k], lz = pz[k] ;
+	  px[k] = t0 + r00*lx + r01*ly + r02*lz ;
+	  py[k] = t1 + r10*lx + r11*ly + r12*lz ;
+	  pz[k] = t2 + r20*lx + r21*ly + r22*lz ;
+	}
 
-	TGeoHMatrix*  m = geoManager->GetCurrentMatrix() ;
-      
-	double g[3], l[3] ;
-	global.GetCoordinates( g ) ;
-	m->MasterToLocal( g, l );
+	for( std::size_t k = 0 ; k < n ; ++k )
+	  positions[ order[begin+k].second ].SetCoordinates( px[k], py[k], pz[k] ) ;
+      }
+    }
 
-	SensitiveDetector sd = pv.volume().sensitiveDetector();
-	Readout r = sd.readout() ;
-	
-	// collect all volIDs for the current path
-	PlacedVolume::VolIDs volIDs ;
-	volIDs.insert( std::end(volIDs), std::begin(pv.volIDs()), std::end(pv.volIDs())) ;
 
-	TGeoPhysicalNode pN( geoManager->GetPath() ) ; 
-	
-	unsigned motherCount = 0 ;
 
-	while( pN.GetMother( motherCount ) != NULL   ){
 
-	    PlacedVolume mPv = pN.GetMother( motherCount++ ) ;
-	    
-	    if( mPv.isValid() &&  pN.GetMother( motherCount ) != NULL )  // world has no volIDs
-	      volIDs.insert( std::end(volIDs), std::begin(mPv.volIDs()), std::end(mPv.volIDs())) ;
-	}
-	
-	VolumeID volIDPVs = r.idSpec().encode( volIDs ) ;
-	
-	result = r.segmentation().cellID( Position( l[0], l[1], l[2] ) , global, volIDPVs  );
-      }
-	
-      return result ;
+    CellID CellIDPositionConverter::cellID(const Position& global) const {
+
+      return navigateCellID( navigator(), global ) ;
+    }
+
+    void CellIDPositionConverter::cellID(const Position* globals, std::size_t count, CellID* cells) const {
+
+      TGeoNavigator* nav = navigator() ;
+
+      for( std::size_t i = 0 ; i < count ; ++i )
+	cells[i] = navigateCellID( nav, globals[i] ) ;
     }
 
     // CellID CellIDPositionConverter::cellID(const Position& global) const {
@@ -301,6 +424,11 @@ namespace dd4hep {
     
     Readout CellIDPositionConverter::findReadout(const DetElement& det) const {
 
+      // use the precomputed readout if the DetElement is known to the VolumeManager
+      auto it = _readoutCache.find( det.ptr() ) ;
+      if( it != _readoutCache.end() )
+	return it->second ;
+
       // first check if top level is a sensitive detector
       if (det.volume().isValid() and det.volume().isSensitive()) {
 	SensitiveDetector sd = det.volume().sensitiveDetector();
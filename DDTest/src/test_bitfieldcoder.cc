@@ -63,6 +63,55 @@ int main(int /* argc */, char** /* argv */ ){
     test( bf2.get( field, bf2.index( "y")),    -16710 , " acces field value: y" );
 
 
+    // precompiled decoder view on a subset of the fields
+    const BitFieldDecoder dec( bf, { "system", "side", "layer", "x", "y" } ) ;
+
+    test( dec.get( field, 0 ),  30     , " decoder field value: system" );
+    test( dec.get( field, 1 ),  1      , " decoder field value: side" );
+    test( dec.get( field, 2 ),  373    , " decoder field value: layer" );
+    test( dec.get( field, 3 ), -310    , " decoder field value: x" );
+    test( dec.get( field, 4 ), -16710  , " decoder field value: y" );
+
+    CellID field2 = field ;
+    dec.set( field2, 3,  -1 ) ;
+    dec.set( field2, 2, 511 ) ;
+    test( bf.get( field2, "x" ),      -1  , " decoder set value: x" );
+    test( bf.get( field2, "layer" ),  511 , " decoder set value: layer" );
+    test( bf.get( field2, "module" ), 254 , " decoder set keeps value: module" );
+
+    // bulk decode/encode of structure-of-arrays columns
+    const std::size_t nCells = 3 ;
+    CellID cells[nCells] = { field, field2, 0 } ;
+    FieldID cols[5][nCells] ;
+    FieldID* colPtr[5] = { cols[0], cols[1], cols[2], cols[3], cols[4] } ;
+    dec.decode( cells, nCells, colPtr ) ;
+
+    test( cols[3][0], -310 , " bulk decode value: x[0]" );
+    test( cols[3][1], -1   , " bulk decode value: x[1]" );
+    test( cols[2][1], 511  , " bulk decode value: layer[1]" );
+    test( cols[4][2], 0    , " bulk decode value: y[2]" );
+
+    CellID encoded[nCells] = { 0, 0, 0 } ;
+    dec.encode( colPtr, nCells, encoded ) ;
+    CellID subsetMask = bf["system"].mask() | bf["side"].mask() | bf["layer"].mask() | bf["x"].mask() | bf["y"].mask() ;
+    test( encoded[0], field  & subsetMask , " bulk encode value: cell[0]" );
+    test( encoded[1], field2 & subsetMask , " bulk encode value: cell[1]" );
+
+    // compile time field specifications
+    typedef BitFieldSpec< 5, -2>  Side ;
+    typedef BitFieldSpec< 7,  9>  Layer ;
+    typedef BitFieldSpec<32,-16>  X ;
+
+    test( X::matches( bf["x"] ),         true , " compile time spec matches: x" );
+    test( Layer::matches( bf["layer"] ),  true , " compile time spec matches: layer" );
+    test( Side::matches( bf["side"] ),    true , " compile time spec matches: side" );
+    test( X::value( field ),     -310 , " compile time value: x" );
+    test( Layer::value( field ),  373 , " compile time value: layer" );
+    test( Side::value( field ),     1 , " compile time value: side" );
+
+    static_assert( X::value( X::encode( -5 ) ) == -5, "compile time encode/decode" ) ;
+
+
     // --------------------------------------------------------------------
 
 
@@ -0,0 +1,132 @@
+#include "DD4hep/DDTest.h"
+#include <exception>
+#include <iostream>
+#include <cstdio>
+#include <cmath>
+
+#include "DD4hep/FieldTypes.h"
+#include "DD4hep/DD4hepUnits.h"
+
+using namespace std;
+using namespace dd4hep;
+
+namespace {
+  /// Linear test field: reproduced exactly by the trilinear interpolation
+  void linearField(double x, double y, double z, double* b)  {
+    b[0] = ( 0.1*x/mm + 0.2*y/mm - 0.05*z/mm + 1.0 ) * tesla;
+    b[1] = ( 0.3*z/mm + 2.0 ) * tesla;
+    b[2] = ( 0.01*x/mm - 0.02*y/mm + 3.0 ) * tesla;
+  }
+  bool same(double a, double b)  {
+    return std::fabs(a-b) < 1e-5 * tesla;
+  }
+}
+
+//=============================================================================
+int main(int /* argc */, char** /* argv */ ){
+
+  DDTest test( "fieldmap" ) ;
+
+  try{
+    // ----- write your tests in here -------------------------------------
+    test.log( "test tabulated field maps" );
+
+    const std::string fname = "test_fieldmap_xyz.bin";
+    const unsigned nodes[3]   = { 7, 5, 9 };
+    const double   minimum[3] = { -30*mm, -20*mm, -40*mm };
+    const double   step[3]    = { 10*mm, 10*mm, 10*mm };
+
+    FieldMap map;
+    map.setGrid( FieldMap::GRID_XYZ, nodes, minimum, step );
+    for( unsigned i = 0; i < nodes[0]; ++i )
+      for( unsigned j = 0; j < nodes[1]; ++j )
+        for( unsigned k = 0; k < nodes[2]; ++k )  {
+          double b[3];
+          linearField( minimum[0]+i*step[0], minimum[1]+j*step[1], minimum[2]+k*step[2], b );
+          map.setNode( i, j, k, b );
+        }
+    map.save( fname );
+
+    // Reload memory mapped and compare against the analytic field inside the grid
+    FieldMap mapped;
+    mapped.load( fname );
+    test( mapped.gridType() == FieldMap::GRID_XYZ, true, " grid type after load " );
+
+    int failed = 0;
+    for( int n = 0; n < 1000; ++n )  {
+      double pos[3] = { minimum[0] + 60*mm*(n%37)/36.,
+                        minimum[1] + 40*mm*(n%11)/10.,
+                        minimum[2] + 80*mm*(n%13)/12. };
+      double b[3] = { 0e0, 0e0, 0e0 }, ref[3];
+      mapped.fieldComponents( pos, b );
+      linearField( pos[0], pos[1], pos[2], ref );
+      for( int c = 0; c < 3; ++c )
+        failed += same( b[c], ref[c] ) ? 0 : 1;
+    }
+    test( failed, 0, " trilinear interpolation of a linear field " );
+
+    double outside[3] = { 100*mm, 0e0, 0e0 }, bout[3] = { 0e0, 0e0, 0e0 };
+    mapped.fieldComponents( outside, bout );
+    test( bout[0] == 0e0 && bout[1] == 0e0 && bout[2] == 0e0, true, " no field outside the grid " );
+
+    // Cylindrical map: Br = 0.01 T/mm * r, Bz = 4 T - 0.001 T/mm * z
+    const std::string rzname = "test_fieldmap_rz.bin";
+    const unsigned rz_nodes[3]   = { 5, 9, 1 };
+    const double   rz_minimum[3] = { 0e0, -40*mm, 0e0 };
+    const double   rz_step[3]    = { 10*mm, 10*mm, 0e0 };
+    FieldMap rz;
+    rz.setGrid( FieldMap::GRID_RZ, rz_nodes, rz_minimum, rz_step );
+    for( unsigned i = 0; i < rz_nodes[0]; ++i )
+      for( unsigned j = 0; j < rz_nodes[1]; ++j )  {
+        double r = i*rz_step[0], z = rz_minimum[1] + j*rz_step[1];
+        double b[2] = { 0.01*r/mm * tesla, ( 4.0 - 0.001*z/mm ) * tesla };
+        rz.setNode( i, j, 0, b );
+      }
+    rz.save( rzname );
+
+    FieldMap rz_mapped;
+    rz_mapped.load( rzname );
+    double pos[3] = { 3*mm, 4*mm, 5*mm }, b[3] = { 0e0, 0e0, 0e0 };
+    rz_mapped.fieldComponents( pos, b );
+    test( same( b[0], 0.03*tesla ) && same( b[1], 0.04*tesla ) && same( b[2], 3.995*tesla ), true,
+          " bilinear interpolation of a cylindrical field " );
+
+    // Overlay of the map with a solenoid: the cached lookup must agree with the plain one
+    OverlayedField overlay( "overlay" );
+    SolenoidField* solenoid = new SolenoidField();
+    solenoid->innerField  = 2*tesla;
+    solenoid->innerRadius = 25*mm;
+    solenoid->outerRadius = 50*mm;
+    solenoid->minZ        = -35*mm;
+    solenoid->maxZ        = 35*mm;
+    CartesianField sol, fmap;
+    sol.assign( solenoid, "solenoid", "solenoid" );
+    FieldMap* overlay_map = new FieldMap();
+    overlay_map->load( fname );
+    fmap.assign( overlay_map, "map", "FieldMapXYZ" );
+    overlay.add( sol );
+    overlay.add( fmap );
+
+    failed = 0;
+    for( int n = 0; n < 2000; ++n )  {
+      double p[3] = { -60*mm + 120*mm*(n%41)/40., -60*mm + 120*mm*(n%17)/16., -60*mm + 120*mm*(n%23)/22. };
+      double cached[3], plain[3];
+      overlay.cachedMagneticField( p, cached );
+      overlay.magneticField( p, plain );
+      for( int c = 0; c < 3; ++c )
+        failed += cached[c] == plain[c] ? 0 : 1;
+    }
+    test( failed, 0, " cached overlayed field lookup " );
+
+    std::remove( fname.c_str() );
+    std::remove( rzname.c_str() );
+    // --------------------------------------------------------------------
+
+  } catch( exception &e ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
@@ -0,0 +1,156 @@
+#include "DDSegmentation/Segmentation.h"
+#include "DDSegmentation/CartesianGridXY.h"
+#include "DDSegmentation/CartesianGridXYZ.h"
+#include "DDSegmentation/PolarGridRPhi.h"
+#include "DDSegmentation/CylindricalGridPhiZ.h"
+#include "DDSegmentation/GridPhiEta.h"
+#include "DDSegmentation/GridRPhiEta.h"
+#include "DDSegmentation/HexGrid.h"
+#include "DD4hep/DDTest.h"
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <exception>
+#include <cmath>
+
+using dd4hep::DDSegmentation::Segmentation;
+using dd4hep::DDSegmentation::Vector3D;
+using dd4hep::DDSegmentation::CellID;
+using dd4hep::DDSegmentation::VolumeID;
+
+/// Compare the batch calls positions()/cellIDs() of a segmentation with the single cell calls
+void compareBatch( dd4hep::DDTest& test, const Segmentation& seg, const std::string& name ){
+
+  const std::size_t nPoints = 1000 ;
+  std::mt19937 gen( 12345 ) ;
+  std::uniform_real_distribution<double> xy( -500., 500. ) ;
+  std::uniform_real_distribution<double> z( -1000., 1000. ) ;
+  std::uniform_int_distribution<int> layer( 0, 3 ) ;
+
+  std::vector<Vector3D> points( nPoints ) ;
+  std::vector<VolumeID> volIDs( nPoints ) ;
+  for( std::size_t i = 0 ; i < nPoints ; ++i ){
+    points[i] = Vector3D( xy(gen), xy(gen), z(gen) ) ;
+    VolumeID vid = 0 ;
+    seg.decoder()->set( vid, "system", 1 ) ;
+    seg.decoder()->set( vid, "layer", layer(gen) ) ;
+    volIDs[i] = vid ;
+  }
+
+  // position -> cellID
+  std::vector<CellID> cells( nPoints ) ;
+  seg.cellIDs( points.data(), points.data(), volIDs.data(), nPoints, cells.data() ) ;
+  std::size_t nCellErrors = 0 ;
+  for( std::size_t i = 0 ; i < nPoints ; ++i ){
+    if( cells[i] != seg.cellID( points[i], points[i], volIDs[i] ) )
+      ++nCellErrors ;
+  }
+  test( nCellErrors, std::size_t(0), " " + name + ": batch cellIDs equal to cellID" ) ;
+
+  // cellID -> position
+  std::vector<Vector3D> positions( nPoints ) ;
+  seg.positions( cells.data(), nPoints, positions.data() ) ;
+  std::size_t nPosErrors = 0 ;
+  for( std::size_t i = 0 ; i < nPoints ; ++i ){
+    Vector3D p = seg.position( cells[i] ) ;
+    double d = std::fabs( p.X - positions[i].X ) + std::fabs( p.Y - positions[i].Y ) + std::fabs( p.Z - positions[i].Z ) ;
+    if( !( d <= 1e-9 * ( 1. + std::fabs( p.X ) + std::fabs( p.Y ) + std::fabs( p.Z ) ) ) )
+      ++nPosErrors ;
+  }
+  test( nPosErrors, std::size_t(0), " " + name + ": batch positions equal to position" ) ;
+}
+
+
+/// Sub-class overriding only the single cell calls: cells of odd layers are shifted in Z
+class ShiftedGridXY : public dd4hep::DDSegmentation::CartesianGridXY {
+public:
+  ShiftedGridXY( const std::string& encoding ) : CartesianGridXY( encoding ) {}
+  Vector3D position( const CellID& cID ) const override {
+    Vector3D p = CartesianGridXY::position( cID ) ;
+    p.Z = 10. * ( _decoder->get( cID, "layer" ) % 2 ) ;
+    return p ;
+  }
+  CellID cellID( const Vector3D& local, const Vector3D& global, const VolumeID& vID ) const override {
+    Vector3D shifted( local.X + 2.5, local.Y, local.Z ) ;
+    return CartesianGridXY::cellID( shifted, global, vID ) ;
+  }
+} ;
+
+/// Sub-class overriding only the single cell calls: positions are scaled to a radius of 1000
+class ScaledGridPhiEta : public dd4hep::DDSegmentation::GridPhiEta {
+public:
+  ScaledGridPhiEta( const std::string& encoding ) : GridPhiEta( encoding ) {}
+  Vector3D position( const CellID& cID ) const override {
+    Vector3D p = GridPhiEta::position( cID ) ;
+    return Vector3D( 1000. * p.X, 1000. * p.Y, 1000. * p.Z ) ;
+  }
+} ;
+
+int main() {
+
+  dd4hep::DDTest test( "SegmentationBatch" ) ;
+
+  try{
+
+    dd4hep::DDSegmentation::CartesianGridXY seg( "system:8,layer:8,x:32:-16,y:-16" ) ;
+    seg.setGridSizeX( 3.3 ) ;
+    seg.setGridSizeY( 4.7 ) ;
+    seg.setOffsetX( 0.4 ) ;
+    compareBatch( test, seg, "CartesianGridXY" ) ;
+
+    dd4hep::DDSegmentation::CartesianGridXYZ segXYZ( "system:8,layer:8,x:24:-12,y:-12,z:-12" ) ;
+    segXYZ.setGridSizeX( 3.3 ) ;
+    segXYZ.setGridSizeY( 4.7 ) ;
+    segXYZ.setGridSizeZ( 5.1 ) ;
+    segXYZ.setOffsetZ( -0.2 ) ;
+    compareBatch( test, segXYZ, "CartesianGridXYZ" ) ;
+
+    dd4hep::DDSegmentation::PolarGridRPhi segRPhi( "system:8,layer:8,r:32:16,phi:-16" ) ;
+    segRPhi.setGridSizeR( 2.5 ) ;
+    segRPhi.setGridSizePhi( M_PI/90. ) ;
+    compareBatch( test, segRPhi, "PolarGridRPhi" ) ;
+
+    dd4hep::DDSegmentation::CylindricalGridPhiZ segPhiZ( "system:8,layer:8,phi:32:-16,z:-16" ) ;
+    segPhiZ.setGridSizePhi( M_PI/180. ) ;
+    segPhiZ.setGridSizeZ( 7.5 ) ;
+    segPhiZ.setRadius( 300. ) ;
+    compareBatch( test, segPhiZ, "CylindricalGridPhiZ" ) ;
+
+    dd4hep::DDSegmentation::GridPhiEta segPhiEta( "system:8,layer:8,eta:32:-16,phi:-16" ) ;
+    segPhiEta.setGridSizeEta( 0.01 ) ;
+    segPhiEta.setPhiBins( 256 ) ;
+    segPhiEta.setOffsetPhi( -M_PI ) ;
+    compareBatch( test, segPhiEta, "GridPhiEta" ) ;
+
+    dd4hep::DDSegmentation::GridRPhiEta segRPhiEta( "system:8,layer:8,r:24:12,eta:-12,phi:-12" ) ;
+    segRPhiEta.setGridSizeR( 5. ) ;
+    segRPhiEta.setGridSizeEta( 0.01 ) ;
+    segRPhiEta.setPhiBins( 256 ) ;
+    segRPhiEta.setOffsetPhi( -M_PI ) ;
+    compareBatch( test, segRPhiEta, "GridRPhiEta" ) ;
+
+    dd4hep::DDSegmentation::HexGrid segHex( "system:8,layer:8,x:32:-16,y:-16" ) ;
+    segHex.setSideLength( 3. ) ;
+    segHex.setStagger( 1 ) ;
+    compareBatch( test, segHex, "HexGrid" ) ;
+
+    // Sub-classes overriding only the single cell calls must not use the batch kernels of the parent
+    ShiftedGridXY segShifted( "system:8,layer:8,x:32:-16,y:-16" ) ;
+    segShifted.setGridSizeX( 3.3 ) ;
+    segShifted.setGridSizeY( 4.7 ) ;
+    compareBatch( test, segShifted, "ShiftedGridXY" ) ;
+
+    ScaledGridPhiEta segScaled( "system:8,layer:8,eta:32:-16,phi:-16" ) ;
+    segScaled.setGridSizeEta( 0.01 ) ;
+    segScaled.setPhiBins( 256 ) ;
+    compareBatch( test, segScaled, "ScaledGridPhiEta" ) ;
+
+  } catch( std::exception &e ){
+
+    test.log( e.what() );
+    test.error( "exception occurred" );
+  }
+
+  return 0;
+}
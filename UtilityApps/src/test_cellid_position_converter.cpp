@@ -26,6 +26,7 @@
 #include "EVENT/SimCalorimeterHit.h"
 
 #include <sstream>
+#include <chrono>
 
 using namespace std;
 using namespace dd4hep;
@@ -56,10 +57,40 @@ struct TestCounter{
 struct TestCounters{
   TestCounter position{} ;
   TestCounter cellid{} ;
+  TestCounter batch{} ;
 };
 
 typedef std::map<std::string, TestCounters > TestMap ;
 
+typedef std::chrono::high_resolution_clock Clock ;
+
+/// Readout search of CellIDPositionConverter::findReadout(DetElement) as done before the readout cache
+Readout uncachedReadout( const CellIDPositionConverter& conv, const DetElement& det ){
+  // first check if top level is a sensitive detector
+  if( det.volume().isValid() and det.volume().isSensitive() ) {
+    SensitiveDetector sd = det.volume().sensitiveDetector() ;
+    if( sd.isValid() and sd.readout().isValid() )
+      return sd.readout() ;
+  }
+  // if not, return the first sensitive daughter volume's readout
+  return conv.findReadout( det.placement() ) ;
+}
+
+/// Position lookup as done before the readout/matrix caches: recursive readout search, two matrices
+Position uncachedPosition( const CellIDPositionConverter& conv, const CellID& cell ){
+  const VolumeManagerContext* context = conv.findContext( cell ) ;
+  if( context == NULL )
+    return Position() ;
+  DetElement det = context->element ;
+  Readout r = uncachedReadout( conv, det ) ;
+  Position local = r.segmentation().position( cell ) ;
+  double l[3], e[3], g[3] ;
+  local.GetCoordinates( l ) ;
+  context->toElement().LocalToMaster( l, e ) ;
+  det.nominal().worldTransformation().LocalToMaster( e, g ) ;
+  return Position( g[0], g[1], g[2] ) ;
+}
+
 
 
 int main_wrapper(int argc, char** argv ){
@@ -100,6 +131,12 @@ int main_wrapper(int argc, char** argv ){
   
   TestMap tMap ;
 
+  // micro-benchmark of the per-call latency of cellID -> position
+  const int nRepeat = 100 ;
+  double timeUncached = 0., timeCached = 0., timeBatch = 0. ;
+  std::size_t nCalls = 0 ;
+  Position sum ;
+
   while( ( evt = rdr->readNextEvent() ) != 0 ){
 
     const std::vector< std::string >& colNames = *evt->getCollectionNames() ;
@@ -128,6 +165,10 @@ int main_wrapper(int argc, char** argv ){
 
       int nHit = std::min( col->getNumberOfElements(), maxHit )  ;
      
+      std::vector<CellID>   batchIDs ;
+      std::vector<CellID>   batchIDRef ;
+      std::vector<Position> batchPoints ;
+      std::vector<Position> batchRef ;
       
       for(int i=0 ; i< nHit ; ++i){
 	
@@ -170,7 +211,64 @@ int main_wrapper(int argc, char** argv ){
 	else
 	  tMap[ colNames[icol] ].position.failed++ ;
 
+	batchIDs.emplace_back( id ) ;
+	batchRef.emplace_back( pointFromDecoder ) ;
+	batchPoints.emplace_back( point ) ;
+	batchIDRef.emplace_back( idFromDecoder ) ;
       }
+
+      // ====== test the batch conversion against the single cell conversion =========================
+      std::vector<Position> batchPos( batchIDs.size() ) ;
+      idposConv.position( batchIDs.data(), batchIDs.size(), batchPos.data() ) ;
+
+      for(unsigned i=0, n=batchIDs.size() ; i < n ; ++i){
+
+	double d = dist( batchPos[i], batchRef[i] ) ;
+	std::stringstream sst ;
+	sst << " batch dist " << d << " ( " <<  batchRef[i] << " ) - ( " << batchPos[i] << " )" ;
+
+	test( d < epsilon , true  , sst.str()  ) ;
+
+	if( ! strcmp( test.last_test_status() , "PASSED" ) )
+	  tMap[ colNames[icol] ].batch.passed++ ;
+	else
+	  tMap[ colNames[icol] ].batch.failed++ ;
+      }
+
+      std::vector<CellID> batchCells( batchPoints.size() ) ;
+      idposConv.cellID( batchPoints.data(), batchPoints.size(), batchCells.data() ) ;
+
+      for(unsigned i=0, n=batchPoints.size() ; i < n ; ++i){
+
+	std::stringstream sst ;
+	sst << " batch compare ids: " << idDecoder0.valueString( batchIDRef[i] ) << "  -  " << idDecoder1.valueString( batchCells[i] ) ;
+
+	test( batchIDRef[i], batchCells[i], sst.str() ) ;
+
+	if( ! strcmp( test.last_test_status() , "PASSED" ) )
+	  tMap[ colNames[icol] ].batch.passed++ ;
+	else
+	  tMap[ colNames[icol] ].batch.failed++ ;
+      }
+
+      // ====== time the conversion without and with the readout/matrix caches =======================
+      auto t0 = Clock::now() ;
+      for(int r=0 ; r < nRepeat ; ++r)
+	for( const auto& id : batchIDs )
+	  sum += uncachedPosition( idposConv, id ) ;
+      auto t1 = Clock::now() ;
+      for(int r=0 ; r < nRepeat ; ++r)
+	for( const auto& id : batchIDs )
+	  sum += idposConv.position( id ) ;
+      auto t2 = Clock::now() ;
+      for(int r=0 ; r < nRepeat ; ++r)
+	idposConv.position( batchIDs.data(), batchIDs.size(), batchPos.data() ) ;
+      auto t3 = Clock::now() ;
+
+      timeUncached += std::chrono::duration<double, std::nano>( t1 - t0 ).count() ;
+      timeCached   += std::chrono::duration<double, std::nano>( t2 - t1 ).count() ;
+      timeBatch    += std::chrono::duration<double, std::nano>( t3 - t2 ).count() ;
+      nCalls       += nRepeat * batchIDs.size() ;
     }
     
   }
@@ -185,14 +283,22 @@ int main_wrapper(int argc, char** argv ){
     unsigned total      = res.second.position.passed+res.second.position.failed ;
     unsigned pos_failed = res.second.position.failed ;
     unsigned id_failed  = res.second.cellid.failed ;
+    unsigned bt_failed  = res.second.batch.failed ;
 
     
-    printf(" %-30s \t  failed position: %5d  failed cellID:  %5d    of total: %5d   \n",
-           name.c_str(), pos_failed , id_failed, total ) ;
+    printf(" %-30s \t  failed position: %5d  failed cellID:  %5d  failed batch: %5d    of total: %5d   \n",
+           name.c_str(), pos_failed , id_failed, bt_failed, total ) ;
 
   }
   std::cout << "\n -------------------------------------------------------- " << std::endl ;
 
+  if( nCalls > 0 ) {
+    printf(" cellID -> position latency over %lu calls (checksum %g):\n", (unsigned long) nCalls, sum.r() ) ;
+    printf("    uncached (recursive readout search) : %10.1f ns/call \n", timeUncached / nCalls ) ;
+    printf("    cached   (single cell)              : %10.1f ns/call \n", timeCached   / nCalls ) ;
+    printf("    cached   (batch)                    : %10.1f ns/call \n", timeBatch    / nCalls ) ;
+    std::cout << "\n -------------------------------------------------------- " << std::endl ;
+  }
   
   return 0;
 }
@@ -0,0 +1,240 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+/*
+   Plugin invocation:
+   ==================
+   This plugin behaves like a main program.
+   Invoke the plugin with something like this:
+
+   geoPluginRun -volmgr -destroy -plugin DD4hep_ConditionExample_MT_prepare \
+   -input file:${DD4hep_DIR}/examples/AlignDet/compact/Telescope.xml -iovs 8 -threads 2 -runs 20
+
+   Stress test for the concurrent preparation of conditions slices:
+   Every thread owns one conditions slice. Several threads share one IOV range.
+   All threads start at the same time, the first thread of every IOV range
+   populates the IOV pool, then all threads prepare their slice repeatedly
+   for the same IOVs inside their range.
+   The threads of one range race to compute and register the derived conditions.
+   All of them must end up with the objects owned by the conditions manager.
+   The conditions are accessed after each prepare call.
+
+*/
+// Framework include files
+#include "ConditionExampleObjects.h"
+#include "DDCond/ConditionsManagerObject.h"
+#include "DDCond/ConditionsIOVPool.h"
+#include "DD4hep/Factories.h"
+#include "TTimeStamp.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::ConditionExamples;
+
+namespace {
+
+  /// Helper to collect the results of all threads
+  class Statistics {
+  public:
+    /// Protection mutex for thread safe updates.
+    mutex                     guard;
+    /// Total number of accesses
+    long                      total_accesses = 0;
+    /// Number of prepare calls with missing or unexpected conditions
+    long                      num_errors = 0;
+    /// Accumulated prepare results
+    ConditionsManager::Result totals;
+  };
+
+  /// Worker preparing one slice for one IOV range
+  class Executor {
+  public:
+    ConditionsManager manager;
+    ConditionsSlice   slice;
+    const IOVType*    iovTyp;
+    Statistics&       stats;
+    atomic<bool>&     start;
+    atomic<bool>&     populated;
+    int               identifier;
+    int               range_id;
+    bool              owner;
+    int               num_run;
+
+    Executor(ConditionsManager m, const ConditionsSlice& s, const IOVType* typ,
+             int id, int range, bool own, int runs,
+             atomic<bool>& go, atomic<bool>& ready, Statistics& st)
+      : manager(m), slice(s), iovTyp(typ), stats(st), start(go), populated(ready),
+        identifier(id), range_id(range), owner(own), num_run(runs)
+    {
+    }
+    /// Check that the derived conditions of the slice are the objects registered to the manager
+    long check_registered(ConditionsPool& pool)  {
+      long num_foreign = 0;
+      dd4hep_lock_t guard(manager.iovPool(*iovTyp)->lock);
+      for( const auto& d : slice.content->derived() )   {
+        Condition cond = slice.pool->get(d.first);
+        if ( !cond.isValid() || cond.ptr() != pool.exists(d.first).ptr() )
+          ++num_foreign;
+      }
+      if ( num_foreign > 0 )   {
+        printout(ERROR,"MT_prepare","Thread:%3d %ld derived conditions are not owned by the manager.",
+                 identifier, num_foreign);
+      }
+      return num_foreign;
+    }
+    void run()  {
+      const size_t num_expected = slice.content->conditions().size() + slice.content->derived().size();
+      const long   first = 1 + range_id*10;
+      long num_access = 0, num_errors = 0;
+      ConditionsManager::Result totals;
+
+      while ( !start.load() ) std::this_thread::yield();
+      /// Populate the IOV pool of this range while the other ranges already select
+      IOV range(iovTyp, IOV::Key(first, first+9));
+      ConditionsPool* pool = manager.registerIOV(*range.iovType, range.key());
+      if ( owner )   {
+        Scanner().scan(ConditionsCreator(slice, *pool, DEBUG), manager->detectorDescription().world());
+        populated = true;
+      }
+      while ( !populated.load() ) std::this_thread::yield();
+
+      TTimeStamp begin;
+      for( int i=0; i < num_run; ++i )   {
+        IOV iov(iovTyp, first + i%10);
+        ConditionsManager::Result res = manager.prepare(iov, slice);
+        if ( res.missing != 0 || res.total() != num_expected )   {
+          printout(ERROR,"MT_prepare","Thread:%3d IOV:%s Prepared %ld of %ld conditions "
+                   "(S:%6ld,L:%6ld,C:%6ld,M:%ld)", identifier, iov.str().c_str(), res.total(),
+                   num_expected, res.selected, res.loaded, res.computed, res.missing);
+          ++num_errors;
+        }
+        if ( res.computed > 0 )   {
+          num_errors += check_registered(*pool) > 0 ? 1 : 0;
+        }
+        num_access += Scanner().scan(ConditionsDataAccess(iov, slice), manager->detectorDescription().world());
+        totals += res;
+      }
+      TTimeStamp end;
+      lock_guard<mutex> lock(stats.guard);
+      printout(INFO,"MT_prepare","Thread:%3d Prepared %d slices: %ld conditions "
+               "(S:%6ld,L:%6ld,C:%6ld,M:%ld) [%8.3f sec]", identifier, num_run, totals.total(),
+               totals.selected, totals.loaded, totals.computed, totals.missing,
+               end.AsDouble()-begin.AsDouble());
+      stats.total_accesses += num_access;
+      stats.num_errors     += num_errors;
+      stats.totals         += totals;
+    }
+  };
+}
+
+/// Plugin function: Multi-threaded preparation of conditions slices
+/**
+ *  Factory: DD4hep_ConditionExample_MT_prepare
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \date    17/10/2026
+ */
+static int condition_example (Detector& description, int argc, char** argv)  {
+  string input;
+  int    num_iov = 8, num_threads = 2, num_run = 20;
+  bool   arg_error = false;
+  for(int i=0; i<argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-input",argv[i],4) )
+      input = argv[++i];
+    else if ( 0 == ::strncmp("-iovs",argv[i],4) )
+      num_iov = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-threads",argv[i],4) )
+      num_threads = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-runs",argv[i],4) )
+      num_run = ::atol(argv[++i]);
+    else
+      arg_error = true;
+  }
+  if ( arg_error || input.empty() || num_iov <= 0 || num_threads <= 0 )   {
+    /// Help printout describing the basic command line interface
+    cout <<
+      "Usage: -plugin <name> -arg [-arg]                                             \n"
+      "     name:   factory name     DD4hep_ConditionExample_MT_prepare              \n"
+      "     -input   <string>        Geometry file                                   \n"
+      "     -iovs    <number>        Number of IOV ranges.                           \n"
+      "     -threads <number>        Number of threads sharing the same IOV range.   \n"
+      "     -runs    <number>        Number of prepare calls per thread.             \n"
+      "\tArguments given: " << arguments(argc,argv) << endl << flush;
+    ::exit(EINVAL);
+  }
+
+  // First we load the geometry
+  description.fromXML(input);
+
+  /******************** Initialize the conditions manager *****************/
+  ConditionsManager manager = installManager(description);
+  const IOVType*    iov_typ = manager.registerIOVType(0,"run").second;
+  if ( 0 == iov_typ )
+    except("ConditionsPrepare","++ Unknown IOV type supplied.");
+
+  /******************** Now as usual: create the slice ********************/
+  shared_ptr<ConditionsContent> content(new ConditionsContent());
+  shared_ptr<ConditionsSlice>   slice(new ConditionsSlice(manager,content));
+  Scanner(ConditionsKeys(*content,INFO),description.world());
+  Scanner(ConditionsDependencyCreator(*content,DEBUG),description.world());
+
+  // ++++++++++++++++++++++++ Prepare N*M slices for N IOVs in parallel
+  Statistics      stats;
+  atomic<bool>    start(false);
+  vector<atomic<bool> > populated(num_iov);
+  vector<thread>  threads;
+  vector<unique_ptr<Executor> > executors;
+  for(int i=0; i<num_iov*num_threads; ++i)  {
+    int range = i%num_iov;
+    populated[range] = false;
+    executors.emplace_back(new Executor(manager, *slice, iov_typ, i, range, i < num_iov, num_run,
+                                        start, populated[range], stats));
+  }
+  TTimeStamp begin;
+  for(auto& e : executors)  {
+    Executor* exec = e.get();
+    threads.emplace_back([exec]{ exec->run(); });
+  }
+  start = true;
+  for(auto& t : threads)
+    t.join();
+  TTimeStamp end;
+
+  /// Every IOV range computes its derived conditions at least once and at most once per thread.
+  /// All other prepare calls select.
+  size_t num_derived = content->derived().size();
+  size_t num_total   = content->conditions().size() + num_derived;
+  size_t num_slices  = num_iov*num_threads;
+  bool   ok = stats.num_errors == 0 &&
+    stats.totals.missing  == 0 &&
+    stats.totals.loaded   == 0 &&
+    stats.totals.computed >= num_iov*num_derived &&
+    stats.totals.computed <= num_slices*num_derived &&
+    stats.totals.total()  == num_slices*num_run*num_total;
+  printout(INFO,"Statistics",
+           "+======= Summary: # of IOV: %3d  # of Threads: %3d  # of prepare calls: %5d [%8.3f sec]",
+           num_iov, int(num_slices), int(num_slices)*num_run, end.AsDouble()-begin.AsDouble());
+  printout(INFO,"Statistics","+  Accessed a total of %ld conditions (S:%6ld,L:%6ld,C:%6ld,M:%ld) during the test.",
+           stats.total_accesses, stats.totals.selected, stats.totals.loaded,
+           stats.totals.computed, stats.totals.missing);
+  printout(ok ? ALWAYS : ERROR,"Statistics","+  Test %s", ok ? "PASSED" : "FAILED");
+  // All done.
+  return 1;
+}
+
+// first argument is the type from the xml file
+DECLARE_APPLY(DD4hep_ConditionExample_MT_prepare,condition_example)
@@ -0,0 +1,202 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+/*
+   Plugin invocation:
+   ==================
+   This plugin behaves like a main program.
+   Invoke the plugin with something like this:
+
+   geoPluginRun -volmgr -destroy -plugin DD4hep_ConditionExample_incremental \
+   -input file:${DD4hep_DIR}/examples/AlignDet/compact/Telescope.xml -iovs 5
+
+   Test for the incremental update of conditions slices:
+   The conditions of most detector elements are valid for all runs.
+   The condition "derived_data" of every 4th detector element changes
+   every 10 runs. One slice is prepared incrementally for every run,
+   a reference slice is prepared from scratch. Both slices must contain
+   the identical condition objects.
+   The incremental slice is prepared first: it must recompute the derived
+   conditions depending on expired conditions. The reference slice then
+   finds them in the IOV pools. Within an IOV nothing must be selected or
+   computed again.
+
+*/
+// Framework include files
+#include "ConditionExampleObjects.h"
+#include "DD4hep/Factories.h"
+#include "TTimeStamp.h"
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::ConditionExamples;
+
+namespace {
+
+  /// Create a condition with a given value
+  template<typename T> Condition make_condition(DetElement de, const string& name, const T& val)  {
+    Condition cond(de.path()+"#"+name, name);
+    cond.bind<T>() = val;
+    cond->hash = ConditionKey::hashCode(de,name);
+    return cond;
+  }
+
+  /// Create conditions with long validity and conditions changing every 10 runs
+  class Creator  {
+  public:
+    ConditionsManager        manager;
+    ConditionsPool*          slow;
+    vector<ConditionsPool*>& fast;
+    mutable long             count = 0;
+
+    Creator(ConditionsManager m, ConditionsPool* s, vector<ConditionsPool*>& f)
+      : manager(m), slow(s), fast(f)  {}
+    /// Callback to process a single detector element
+    int operator()(DetElement de, int)  const  {
+      manager.registerUnlocked(*slow, make_condition<double>(de,"temperature",1.222));
+      manager.registerUnlocked(*slow, make_condition<double>(de,"pressure",888.88));
+      manager.registerUnlocked(*slow, make_condition<vector<double> >(de,"double_table",{1.,2.,3.,4.,5.}));
+      manager.registerUnlocked(*slow, make_condition<vector<int> >(de,"int_table",{10,20,30,40,50}));
+      manager.registerUnlocked(*slow, make_condition<string>(de,"de_path",de.path()));
+      if ( (count++)%4 == 0 )  {
+        for(size_t i=0; i<fast.size(); ++i)
+          manager.registerUnlocked(*fast[i], make_condition<int>(de,"derived_data",100+int(i)));
+      }
+      else  {
+        manager.registerUnlocked(*slow, make_condition<int>(de,"derived_data",100));
+      }
+      return 1;
+    }
+  };
+
+  /// Compare the conditions of the slice content in two slices
+  size_t compare(const ConditionsSlice& slice, const ConditionsSlice& reference)   {
+    size_t num_errors = 0;
+    auto check = [&](Condition::key_type key)  {
+      Condition c = slice.pool->get(key), r = reference.pool->get(key);
+      if ( !c.isValid() || c.ptr() != r.ptr() )  {
+        printout(ERROR,"Incremental","Condition %016llX differs from the reference.", key);
+        ++num_errors;
+      }
+    };
+    for( const auto& c : slice.conditions() ) check(c.first);
+    for( const auto& c : slice.derived() )    check(c.first);
+    return num_errors;
+  }
+}
+
+/// Plugin function: Incremental update of conditions slices
+/**
+ *  Factory: DD4hep_ConditionExample_incremental
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \date    17/10/2026
+ */
+static int condition_example (Detector& description, int argc, char** argv)  {
+  string input;
+  int    num_iov = 10;
+  bool   arg_error = false;
+  for(int i=0; i<argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-input",argv[i],4) )
+      input = argv[++i];
+    else if ( 0 == ::strncmp("-iovs",argv[i],4) )
+      num_iov = ::atol(argv[++i]);
+    else
+      arg_error = true;
+  }
+  if ( arg_error || input.empty() || num_iov <= 0 )   {
+    /// Help printout describing the basic command line interface
+    cout <<
+      "Usage: -plugin <name> -arg [-arg]                                             \n"
+      "     name:   factory name     DD4hep_ConditionExample_incremental             \n"
+      "     -input   <string>        Geometry file                                   \n"
+      "     -iovs    <number>        Number of IOVs with 10 runs each.               \n"
+      "\tArguments given: " << arguments(argc,argv) << endl << flush;
+    ::exit(EINVAL);
+  }
+
+  // First we load the geometry
+  description.fromXML(input);
+
+  /******************** Initialize the conditions manager *****************/
+  ConditionsManager manager = installManager(description);
+  const IOVType*    iov_typ = manager.registerIOVType(0,"run").second;
+  if ( 0 == iov_typ )
+    except("ConditionsPrepare","++ Unknown IOV type supplied.");
+
+  /******************** Now as usual: create the slices *******************/
+  shared_ptr<ConditionsContent> content(new ConditionsContent());
+  shared_ptr<ConditionsSlice>   slice(new ConditionsSlice(manager,content));
+  shared_ptr<ConditionsSlice>   reference(new ConditionsSlice(manager,content));
+  Scanner(ConditionsKeys(*content,INFO),description.world());
+  Scanner(ConditionsDependencyCreator(*content,DEBUG),description.world());
+  slice->flags |= ConditionsSlice::INCREMENTAL;
+
+  /******************** Populate the conditions store *********************/
+  IOV slow_iov(iov_typ, IOV::Key(1, num_iov*10));
+  ConditionsPool* slow = manager.registerIOV(*iov_typ, slow_iov.key());
+  vector<ConditionsPool*> fast;
+  for(int i=0; i<num_iov; ++i)  {
+    IOV iov(iov_typ, IOV::Key(1+i*10, (i+1)*10));
+    fast.emplace_back(manager.registerIOV(*iov_typ, iov.key()));
+  }
+  Scanner().scan(Creator(manager, slow, fast), description.world());
+
+  // ++++++++++++++++++++++++ Prepare both slices for every run and compare
+  // The incremental slice goes first: the derived conditions are not yet registered to the IOV pools
+  ConditionsManager::Result total, total_ref;
+  double time_ref = 0e0, time_inc = 0e0;
+  size_t num_errors = 0;
+  for(int run=1; run <= num_iov*10; ++run)  {
+    IOV req_iov(iov_typ, run);
+    TTimeStamp start;
+    ConditionsManager::Result s = manager.prepare(req_iov, *slice);
+    TTimeStamp middle;
+    ConditionsManager::Result r = manager.prepare(req_iov, *reference);
+    TTimeStamp stop;
+    time_inc  += middle.AsDouble() - start.AsDouble();
+    time_ref  += stop.AsDouble() - middle.AsDouble();
+    total_ref += r;
+    total     += s;
+    num_errors += compare(*slice, *reference);
+    if ( s.missing != 0 || slice->pool->size() != reference->pool->size() )  {
+      printout(ERROR,"Incremental","Run %d: Slice with %ld conditions (S:%ld,L:%ld,C:%ld,M:%ld) "
+               "Reference: %ld conditions", run, slice->pool->size(), s.selected, s.loaded,
+               s.computed, s.missing, reference->pool->size());
+      ++num_errors;
+    }
+    // The fast IOV changes: the dependents of the expired conditions must be recomputed
+    if ( run > 1 && (run-1)%10 == 0 && s.computed == 0 )  {
+      printout(ERROR,"Incremental","Run %d: New IOV, but no derived condition was recomputed.", run);
+      ++num_errors;
+    }
+    // Same IOV: all conditions are kept, nothing is selected or computed
+    else if ( run > 1 && (run-1)%10 != 0 && (s.selected != 0 || s.computed != 0) )  {
+      printout(ERROR,"Incremental","Run %d: Same IOV, but %ld conditions selected and %ld computed.",
+               run, s.selected, s.computed);
+      ++num_errors;
+    }
+  }
+  printout(INFO,"Statistics","+  Reference:   %ld conditions (S:%6ld,L:%6ld,C:%6ld,M:%ld) [%8.3f sec]",
+           total_ref.total(), total_ref.selected, total_ref.loaded, total_ref.computed,
+           total_ref.missing, time_ref);
+  printout(INFO,"Statistics","+  Incremental: %ld conditions (S:%6ld,L:%6ld,C:%6ld,M:%ld) [%8.3f sec]",
+           total.total(), total.selected, total.loaded, total.computed, total.missing, time_inc);
+  printout(num_errors == 0 ? ALWAYS : ERROR,"Statistics","+  Test %s",
+           num_errors == 0 ? "PASSED" : "FAILED");
+  // All done.
+  return 1;
+}
+
+// first argument is the type from the xml file
+DECLARE_APPLY(DD4hep_ConditionExample_incremental,condition_example)
@@ -118,7 +118,7 @@ static int condition_example (Detector& description, int argc, char** argv)  {
   // ++++++++++++++++++++++++ Now compute the conditions for each of these IOVs
   const IOVType* iov_typ = manager.iovType("run");
   cond::ConditionsIOVPool* pool = manager.iovPool(*iov_typ);
-  for( const auto& p : pool->elements )
+  for( const auto& p : pool->elements() )
     p.second->print("*");
 
   ConditionsManager::Result total;
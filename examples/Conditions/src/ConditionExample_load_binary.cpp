@@ -0,0 +1,166 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+/*
+   Plugin invocation:
+   ==================
+   This plugin behaves like a main program.
+   Invoke the plugin with something like this:
+
+   geoPluginRun -volmgr -destroy -plugin DD4hep_ConditionExample_load_binary \
+   -input file:${DD4hep_DIR}/examples/AlignDet/compact/Telescope.xml \
+   -conditions Conditions.snapshot -iovs 10
+
+   Load the conditions written by DD4hep_ConditionExample_save_binary
+   on demand from the memory mapped snapshot using the conditions loader.
+   The first pass over all IOVs loads the conditions from the snapshot,
+   the second pass must select all of them from the conditions store.
+
+*/
+// Framework include files
+#include "ConditionExampleObjects.h"
+#include "DDCond/ConditionsManager.h"
+#include "DDCond/ConditionsDataLoader.h"
+#include "DD4hep/AlignmentData.h"
+#include "DD4hep/Alignments.h"
+#include "DD4hep/Factories.h"
+#include "TTimeStamp.h"
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::ConditionExamples;
+
+namespace {
+  /// Add the keys of the alignment deltas to the slice content
+  class DeltaKeys  {
+  public:
+    ConditionsContent& content;
+    DeltaKeys(ConditionsContent& c) : content(c) {}
+    /// Callback to process a single detector element
+    int operator()(DetElement de, int)  const  {
+      content.insertKey(ConditionKey::KeyMaker(de.key(), align::Keys::deltaKey).hash);
+      return 1;
+    }
+  };
+  /// Check the alignment deltas of the slice
+  class DeltaCheck  {
+  public:
+    ConditionsSlice& slice;
+    double           shift;
+    size_t&          num_errors;
+    DeltaCheck(ConditionsSlice& s, double z, size_t& err) : slice(s), shift(z), num_errors(err) {}
+    /// Callback to process a single detector element
+    int operator()(DetElement de, int)  const  {
+      Condition cond = slice.get(de, align::Keys::deltaKey);
+      if ( !cond.isValid() || cond.get<Delta>().translation.Z() != shift )  {
+        printout(ERROR,"DeltaCheck","++ Invalid alignment delta of %s", de.path().c_str());
+        ++num_errors;
+        return 0;
+      }
+      return 1;
+    }
+  };
+}
+
+/// Plugin function: Load conditions from a binary snapshot
+/**
+ *  Factory: DD4hep_ConditionExample_load_binary
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \date    17/10/2026
+ */
+static int condition_example (Detector& description, int argc, char** argv)  {
+  string input, conditions;
+  int    num_iov = 10;
+  bool   arg_error = false;
+  for(int i=0; i<argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-input",argv[i],4) )
+      input = argv[++i];
+    else if ( 0 == ::strncmp("-conditions",argv[i],4) )
+      conditions = argv[++i];
+    else if ( 0 == ::strncmp("-iovs",argv[i],4) )
+      num_iov = ::atol(argv[++i]);
+    else
+      arg_error = true;
+  }
+  if ( arg_error || input.empty() || conditions.empty() || num_iov <= 0 )   {
+    /// Help printout describing the basic command line interface
+    cout <<
+      "Usage: -plugin <name> -arg [-arg]                                             \n"
+      "     name:   factory name     DD4hep_ConditionExample_load_binary             \n"
+      "     -input       <string>    Geometry file                                   \n"
+      "     -conditions  <string>    Conditions snapshot input file                  \n"
+      "     -iovs        <number>    Number of IOVs with 10 runs each.               \n"
+      "\tArguments given: " << arguments(argc,argv) << endl << flush;
+    ::exit(EINVAL);
+  }
+
+  // First we load the geometry
+  description.fromXML(input);
+
+  /******************** Initialize the conditions manager *****************/
+  description.apply("DD4hep_ConditionsManagerInstaller",0,(char**)0);
+  ConditionsManager manager = ConditionsManager::from(description);
+  manager["PoolType"]       = "DD4hep_ConditionsLinearPool";
+  manager["UserPoolType"]   = "DD4hep_ConditionsMapUserPool";
+  manager["UpdatePoolType"] = "DD4hep_ConditionsLinearUpdatePool";
+  manager["LoaderType"]     = "DD4hep_Conditions_binary_snapshot_Loader";
+  manager.initialize();
+  manager.loader().addSource(conditions);
+  const IOVType* iov_typ = manager.registerIOVType(0,"run").second;
+  if ( 0 == iov_typ )
+    except("ConditionsPrepare","++ Unknown IOV type supplied.");
+
+  /******************** Now as usual: create the slice ********************/
+  shared_ptr<ConditionsContent> content(new ConditionsContent());
+  shared_ptr<ConditionsSlice>   slice(new ConditionsSlice(manager,content));
+  Scanner(ConditionsKeys(*content,INFO),description.world());
+  Scanner(DeltaKeys(*content),description.world());
+  Scanner(ConditionsDependencyCreator(*content,DEBUG),description.world());
+
+  // ++++++++++++++++++++++++ Load the conditions on demand, then select them
+  const size_t num_cond    = content->conditions().size();
+  const size_t num_derived = content->derived().size();
+  size_t num_errors = 0;
+  for(int pass=0; pass<2; ++pass)  {
+    ConditionsManager::Result total;
+    TTimeStamp start;
+    for(int i=0; i<num_iov; ++i)  {
+      IOV req_iov(iov_typ,i*10+5);
+      ConditionsManager::Result r = manager.prepare(req_iov,*slice);
+      /// The first pass loads and computes, the second pass selects everything
+      bool ok = pass == 0
+        ? r.selected == 0 && r.loaded == num_cond && r.computed == num_derived
+        : r.selected == num_cond+num_derived && r.loaded == 0 && r.computed == 0;
+      if ( !ok || r.missing != 0 )  {
+        printout(ERROR,"Prepare","Pass %d: Prepared %ld conditions (S:%ld,L:%ld,C:%ld,M:%ld) of IOV %s",
+                 pass, r.total(), r.selected, r.loaded, r.computed, r.missing, req_iov.str().c_str());
+        ++num_errors;
+      }
+      Scanner().scan(ConditionsDataAccess(req_iov,*slice),description.world());
+      Scanner().scan(DeltaCheck(*slice,double(i),num_errors),description.world());
+      total += r;
+    }
+    TTimeStamp stop;
+    printout(ALWAYS,"Statistics","+  Pass %d: %ld conditions (S:%6ld,L:%6ld,C:%6ld,M:%ld) [%8.3f sec]",
+             pass, total.total(), total.selected, total.loaded, total.computed, total.missing,
+             stop.AsDouble()-start.AsDouble());
+  }
+  printout(num_errors == 0 ? ALWAYS : ERROR,"Statistics","+  Test %s",
+           num_errors == 0 ? "PASSED" : "FAILED");
+  // All done.
+  return 1;
+}
+
+// first argument is the type from the xml file
+DECLARE_APPLY(DD4hep_ConditionExample_load_binary,condition_example)
@@ -43,7 +43,7 @@ static int condition_example (Detector& description, int argc, char** argv)  {
 
   string     input;
   PrintLevel print_level = INFO;
-  int        num_iov = 10, extend = 0;
+  int        num_iov = 10, extend = 0, num_threads = 0;
   bool       arg_error = false;
   for(int i=0; i<argc && argv[i]; ++i)  {
     if ( 0 == ::strncmp("-input",argv[i],4) )
@@ -52,6 +52,8 @@ static int condition_example (Detector& description, int argc, char** argv)  {
       num_iov = ::atol(argv[++i]);
     else if ( 0 == ::strncmp("-extend",argv[i],4) )
       extend = ::atol(argv[++i]);
+    else if ( 0 == ::strncmp("-threads",argv[i],4) )
+      num_threads = ::atol(argv[++i]);
     else if ( 0 == ::strncmp("-print",argv[i],4) )
       print_level = dd4hep::decodePrintLevel(argv[++i]);
     else
@@ -64,6 +66,7 @@ static int condition_example (Detector& description, int argc, char** argv)  {
       "     name:   factory name     DD4hep_ConditionExample_populate                \n"
       "     -input   <string>        Geometry file                                   \n"
       "     -iovs    <number>        Number of parallel IOV slots for processing.    \n"
+      "     -threads <number>        Number of threads to compute derived conditions.\n"
       "     -print   <leve>          Set print level (number or string)              \n"
       "\tArguments given: " << arguments(argc,argv) << endl << flush;
     ::exit(EINVAL);
@@ -76,6 +79,7 @@ static int condition_example (Detector& description, int argc, char** argv)  {
   
   /******************** Initialize the conditions manager *****************/
   ConditionsManager manager = installManager(description);
+  manager["ComputeThreads"] = num_threads;
   const IOVType*    iov_typ = manager.registerIOVType(0,"run").second;
   if ( 0 == iov_typ )
     except("ConditionsPrepare","++ Unknown IOV type supplied.");
@@ -125,7 +125,7 @@ static int condition_example (Detector& description, int argc, char** argv)  {
   if ( output_condpool )  {
     int npool = 0;
     cond::ConditionsIOVPool* iov_pool = manager.iovPool(*iov_typ);
-    for( const auto& p : iov_pool->elements )  {
+    for( const auto& p : iov_pool->elements() )  {
       ::snprintf(text,sizeof(text),"Conditions pool %s:[%ld,%ld]",
                  iov_typ->name.c_str(),long(p.second->iov->key().first),long(p.second->iov->key().second));
       if ( (npool%2) == 0 )  { /// Check here saving ConditionsPool objects
@@ -0,0 +1,131 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+/*
+   Plugin invocation:
+   ==================
+   This plugin behaves like a main program.
+   Invoke the plugin with something like this:
+
+   geoPluginRun -volmgr -destroy -plugin DD4hep_ConditionExample_save_binary \
+   -input file:${DD4hep_DIR}/examples/AlignDet/compact/Telescope.xml \
+   -conditions Conditions.snapshot -iovs 10
+
+   Populate the conditions store for a set of IOVs and save the
+   content of the IOV pool to a binary conditions snapshot.
+   Next to the example conditions every detector element gets
+   an alignment delta with the IOV number as z-translation.
+
+*/
+// Framework include files
+#include "ConditionExampleObjects.h"
+#include "DDCond/ConditionsManager.h"
+#include "DDCond/ConditionsIOVPool.h"
+#include "DDCond/ConditionsBinarySnapshot.h"
+#include "DD4hep/AlignmentData.h"
+#include "DD4hep/Alignments.h"
+#include "DD4hep/Factories.h"
+
+using namespace std;
+using namespace dd4hep;
+using namespace dd4hep::ConditionExamples;
+
+namespace {
+  /// Create one alignment delta per detector element
+  class DeltaCreator  {
+  public:
+    ConditionsManager manager;
+    ConditionsPool&   pool;
+    double            shift;
+    DeltaCreator(ConditionsManager m, ConditionsPool& p, double s) : manager(m), pool(p), shift(s) {}
+    /// Callback to process a single detector element
+    int operator()(DetElement de, int)  const  {
+      Condition cond(de.path()+"#"+align::Keys::deltaName, align::Keys::deltaName);
+      cond.bind<Delta>() = Delta(Position(0e0, 0e0, shift));
+      cond->hash = ConditionKey::KeyMaker(de.key(), align::Keys::deltaKey).hash;
+      cond->setFlag(Condition::ALIGNMENT_DELTA);
+      manager.registerUnlocked(pool, cond);
+      return 1;
+    }
+  };
+}
+
+/// Plugin function: Save conditions to a binary snapshot
+/**
+ *  Factory: DD4hep_ConditionExample_save_binary
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ *  \date    17/10/2026
+ */
+static int condition_example (Detector& description, int argc, char** argv)  {
+  string input, conditions;
+  int    num_iov = 10;
+  bool   arg_error = false;
+  for(int i=0; i<argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-input",argv[i],4) )
+      input = argv[++i];
+    else if ( 0 == ::strncmp("-conditions",argv[i],4) )
+      conditions = argv[++i];
+    else if ( 0 == ::strncmp("-iovs",argv[i],4) )
+      num_iov = ::atol(argv[++i]);
+    else
+      arg_error = true;
+  }
+  if ( arg_error || input.empty() || conditions.empty() || num_iov <= 0 )   {
+    /// Help printout describing the basic command line interface
+    cout <<
+      "Usage: -plugin <name> -arg [-arg]                                             \n"
+      "     name:   factory name     DD4hep_ConditionExample_save_binary             \n"
+      "     -input       <string>    Geometry file                                   \n"
+      "     -conditions  <string>    Conditions snapshot output file                 \n"
+      "     -iovs        <number>    Number of IOVs with 10 runs each.               \n"
+      "\tArguments given: " << arguments(argc,argv) << endl << flush;
+    ::exit(EINVAL);
+  }
+
+  // First we load the geometry
+  description.fromXML(input);
+
+  /******************** Initialize the conditions manager *****************/
+  ConditionsManager manager = installManager(description);
+  const IOVType*    iov_typ = manager.registerIOVType(0,"run").second;
+  if ( 0 == iov_typ )
+    except("ConditionsPrepare","++ Unknown IOV type supplied.");
+
+  /******************** Populate the conditions store *********************/
+  shared_ptr<ConditionsContent> content(new ConditionsContent());
+  shared_ptr<ConditionsSlice>   slice(new ConditionsSlice(manager,content));
+  for(int i=0; i<num_iov; ++i)  {
+    IOV iov(iov_typ, IOV::Key(1+i*10,(i+1)*10));
+    ConditionsPool* iov_pool = manager.registerIOV(*iov.iovType, iov.key());
+    Scanner(ConditionsCreator(*slice, *iov_pool, DEBUG),description.world(),0,true);
+    Scanner(DeltaCreator(manager, *iov_pool, double(i)),description.world(),0,true);
+  }
+
+  /******************** Save the conditions store *************************/
+  cond::ConditionsBinarySnapshot snapshot;
+  size_t count = snapshot.add(*manager.iovPool(*iov_typ));
+  printout(ALWAYS,"Example","+++ Added %ld conditions to the snapshot [%8.3f seconds]. %ld conditions skipped.",
+           count, snapshot.duration, snapshot.numSkipped());
+  long nBytes = snapshot.save(conditions);
+  printout(ALWAYS,"Example","+++ Wrote %ld Bytes (%ld conditions) of data to '%s'  [%8.3f seconds].",
+           nBytes, snapshot.size(), conditions.c_str(), snapshot.duration);
+  if ( nBytes > 0 && snapshot.numSkipped() == 0 )  {
+    printout(ALWAYS,"Example","+++ Successfully saved %ld conditions to file.",snapshot.size());
+  }
+  // All done.
+  return 1;
+}
+
+// first argument is the type from the xml file
+DECLARE_APPLY(DD4hep_ConditionExample_save_binary,condition_example)
@@ -164,7 +164,7 @@ namespace {
         dd4hep::cond::ConditionsIOVPool* iovp = m_manager.iovPool(*m_iovtype);
         dd4hep::cond::ConditionsManager::Result total;
         printout(INFO,"ConditionsManager","+++ Dump pools at dump:");
-        for(const auto& e : iovp->elements)
+        for(const auto& e : iovp->elements())
           e.second->print();
         printout(INFO,"ConditionsManager","+++ Starting conditions dump loop");
         long daq_start = dd4hep::detail::makeTime(2016,5,20,0,0,0);
@@ -178,7 +178,7 @@ namespace {
           printout(dd4hep::ALWAYS,"ConditionsManager","Total %ld conditions (S:%ld,L:%ld,C:%ld,M:%ld) of IOV %s",
                    res.total(), res.selected, res.loaded, res.computed, res.missing, iov.str().c_str());
           total += res;
-          for(const auto& e : iovp->elements)
+          for(const auto& e : iovp->elements())
             e.second->print();
           DeVelo devp = slice->get(m_de,Keys::deKey);
           devp.print(0,DePrint::ALL);
@@ -0,0 +1,112 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import
+
+
+def run():
+  import math
+  import DigiTest
+  from dd4hep import units
+  digi = DigiTest.Test(geometry=None)
+
+  # ========================================================================================================
+  input_action = digi.input_action('DigiSequentialActionSequence/READER')
+  input_action.adopt_action('DigiDDG4ROOT/SignalReader', mask=0x0, input=[digi.next_input()])
+  # ========================================================================================================
+  event = digi.event_action('DigiSequentialActionSequence/EventAction')
+  event.adopt_action('DigiContainerCombine/Combine',
+                     parallel=True,
+                     input_masks=[0x0],
+                     input_segment='inputs',
+                     output_mask=0xFEED,
+                     output_segment='deposits',
+                     erase_combined=False)
+  # Convert the deposits to the column layout. Same mask: the reproducible random streams are identical
+  proc = event.adopt_action('DigiContainerSequenceAction/ToColumns',
+                            parallel=True,
+                            input_mask=0xFEED,
+                            input_segment='deposits',
+                            output_mask=0xFEED,
+                            output_segment='data')
+  proc.adopt_container_processor(digi.create_action('DigiDepositColumnCreator/ColumnCreate'), digi.containers())
+  # Noise produces negative deposits, which are smeared afterwards
+  noise = digi.create_action('DigiDepositSmearEnergy/Noise',
+                             reproducible_random=True,
+                             instrumentation_resolution=20 * units.keV)
+  smear = digi.create_action('DigiDepositSmearEnergy/Smear',
+                             reproducible_random=True)
+  smear.intrinsic_fluctuation = 0.005 / math.sqrt(units.GeV)
+  smear.systematic_resolution = 0.02 / units.GeV
+  smear.instrumentation_resolution = 1 * units.keV
+  # Scalar handlers on the standard containers
+  proc = event.adopt_action('DigiContainerSequenceAction/ScalarSmearing',
+                            parallel=True,
+                            input_mask=0xFEED,
+                            input_segment='deposits')
+  proc.adopt_container_processor(noise, digi.containers())
+  proc.adopt_container_processor(smear, digi.containers())
+  # Column kernels: smearing, energy cut, zero suppression and ADC response
+  proc = event.adopt_action('DigiContainerSequenceAction/Smearing',
+                            parallel=True,
+                            input_mask=0xFEED,
+                            input_segment='data')
+  proc.adopt_container_processor(noise, digi.containers())
+  proc.adopt_container_processor(smear, digi.containers())
+  # Scalar handlers and column kernels must give identical results
+  event.adopt_action('DigiTestCompareDeposits/Compare',
+                     reference_segment='deposits',
+                     reference_mask=0xFEED,
+                     compare_segment='data',
+                     compare_mask=0xFEED)
+  proc = event.adopt_action('DigiContainerSequenceAction/EnergyCut',
+                            parallel=True,
+                            input_mask=0xFEED,
+                            input_segment='data',
+                            output_mask=0xFEED,
+                            output_segment='data')
+  cut = digi.create_action('DigiDepositEnergyCut/Cut', deposit_cutoff=1 * units.keV)
+  proc.adopt_container_processor(cut, digi.containers())
+  proc = event.adopt_action('DigiContainerSequenceAction/ZeroSuppress',
+                            parallel=True,
+                            input_mask=0xFEED,
+                            input_segment='data',
+                            output_mask=0xFEED,
+                            output_segment='data')
+  suppress = digi.create_action('DigiDepositZeroSuppress/Suppress', threshold=5 * units.keV)
+  proc.adopt_container_processor(suppress, digi.containers())
+  proc = event.adopt_action('DigiContainerSequenceAction/ADCsequence',
+                            parallel=True,
+                            input_mask=0xFEED,
+                            input_segment='data',
+                            output_mask=0xBABE,
+                            output_segment='output')
+  proc.adopt_container_processor(digi.create_action('DigiSimpleADCResponse/ADCCreate'), digi.containers())
+  # Convert back to the standard layout
+  proc = event.adopt_action('DigiContainerSequenceAction/FromColumns',
+                            parallel=True,
+                            input_mask=0xFEED,
+                            input_segment='data',
+                            output_mask=0xBEEF,
+                            output_segment='output')
+  proc.adopt_container_processor(digi.create_action('DigiDepositColumnCreator/VectorCreate'), digi.containers())
+  event.adopt_action('DigiContainerDrop/DropCombine',
+                     parallel=True,
+                     input_masks=[0xFEED],
+                     input_segment='deposits')
+  event.adopt_action('DigiStoreDump/DumpOutput')
+  digi.info('Created event.dump')
+
+  # ========================================================================================================
+  digi.run_checked(num_events=5, num_threads=10, parallel=3)
+
+
+if __name__ == '__main__':
+  run()
@@ -0,0 +1,78 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import
+import math
+
+
+def digitize(digi):
+  import DigiTest
+  from dd4hep import units
+  digi.kernel().OutputLevel = DigiTest.INFO
+  input_action = digi.input_action('DigiSequentialActionSequence/READER')
+  input_action.adopt_action('DigiDDG4ROOT/SignalReader', mask=0x0, input=[digi.next_input()])
+  # ========================================================================================================
+  event = digi.event_action('DigiSequentialActionSequence/EventAction')
+  event.adopt_action('DigiContainerCombine/Combine',
+                     input_masks=[0x0],
+                     output_mask=0xFEED,
+                     output_segment='deposits',
+                     erase_combined=True)
+  # Reproducible random streams: results do not depend on the number of threads
+  proc = event.adopt_action('DigiContainerSequenceAction/Smearing',
+                            parallel=True,
+                            input_mask=0xFEED,
+                            input_segment='deposits')
+  smear = digi.create_action('DigiDepositSmearTime/SmearTime',
+                             reproducible_random=True,
+                             resolution_time=1e-6 * units.second)
+  proc.adopt_container_processor(smear, digi.containers())
+  smear = digi.create_action('DigiDepositSmearEnergy/SmearEnergy',
+                             reproducible_random=True)
+  smear.intrinsic_fluctuation = 0.005 / math.sqrt(units.GeV)
+  smear.systematic_resolution = 0.02 / units.GeV
+  smear.instrumentation_resolution = 1 * units.keV
+  proc.adopt_container_processor(smear, digi.containers())
+  event.adopt_action('DigiTestDepositChecksum/Checksum', mask=0xFEED)
+  # ========================================================================================================
+  digi.info('Starting digitization core')
+  digi.run_checked(num_events=5, num_threads=10, parallel=5)
+
+
+def checksums(threads, parallel):
+  import sys
+  import subprocess
+  cmd = [sys.executable, __file__, '-num_threads', str(threads), '-events_parallel', str(parallel)]
+  out = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True).stdout
+  print(out)
+  return sorted([line[line.index('+++ Checksum'):] for line in out.splitlines() if '+++ Checksum' in line])
+
+
+def run():
+  import DigiTest
+  digi = DigiTest.Test(geometry=None)
+  if digi.num_threads:
+    return digitize(digi)
+  # Run the same job sequentially and with parallel events: the deposits must be identical
+  sequential = checksums(threads=1, parallel=1)
+  parallel = checksums(threads=10, parallel=5)
+  if len(sequential) == 0 or sequential != parallel:
+    digi.error('FAILED  Deposits of the sequential and the parallel job differ: %d / %d checksums'
+               % (len(sequential), len(parallel)))
+    for s, p in zip(sequential, parallel):
+      if s != p:
+        digi.error('    %s  <>  %s' % (s, p))
+    return
+  digi.always('PASSED  Deposits of the sequential and the parallel job are identical [%d checksums]'
+              % (len(sequential), ))
+
+
+if __name__ == '__main__':
+  run()
@@ -0,0 +1,73 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import
+
+
+def run():
+  import DigiTest
+  digi = DigiTest.Test(geometry=None)
+
+  input_action = digi.input_action('DigiParallelActionSequence/READER')
+  # ========================================================================================================
+  digi.info('Created SIGNAL input')
+  signal = input_action.adopt_action('DigiDDG4ROOT/SignalReader', mask=0x0, input=[digi.next_input()])
+  digi.check_creation([signal])
+  # ========================================================================================================
+  digi.info('Creating collision overlays....')
+  # ========================================================================================================
+  overlay = input_action.adopt_action('DigiSequentialActionSequence/Overlay-1')
+  evtreader = overlay.adopt_action('DigiDDG4ROOT/Reader-1', mask=0x1, input=[digi.next_input()])
+  hist_drop = overlay.adopt_action('DigiHitHistoryDrop/Drop-1', masks=[evtreader.mask])
+  digi.check_creation([overlay, evtreader, hist_drop])
+  digi.info('Created input.overlay25')
+  # ========================================================================================================
+  overlay = input_action.adopt_action('DigiSequentialActionSequence/Overlay-2')
+  evtreader = overlay.adopt_action('DigiDDG4ROOT/Reader-2', mask=0x2, input=[digi.next_input()])
+  hist_drop = overlay.adopt_action('DigiHitHistoryDrop/Drop-2', masks=[evtreader.mask])
+  digi.check_creation([overlay, evtreader, hist_drop])
+  digi.info('Created input.overlay50')
+  # ========================================================================================================
+  overlay = input_action.adopt_action('DigiSequentialActionSequence/Overlay-3')
+  evtreader = overlay.adopt_action('DigiDDG4ROOT/Reader-3', mask=0x3, input=[digi.next_input()])
+  hist_drop = overlay.adopt_action('DigiHitHistoryDrop/Drop-3', masks=[evtreader.mask])
+  digi.check_creation([overlay, evtreader, hist_drop])
+  digi.info('Created input.overlay75')
+  # ========================================================================================================
+  event = digi.event_action('DigiSequentialActionSequence/EventAction')
+  # Combine the same inputs with the parallel tree reduction and sequentially.
+  # The inputs are not erased: both must give identical deposit containers.
+  masks = {'Tree': 0xFEED, 'Sequential': 0xBEEF, 'TreeHashed': 0xFEEE, 'SequentialHashed': 0xBEEE}
+  for name, mask in masks.items():
+    combine = event.adopt_action('DigiContainerCombine/Combine' + name,
+                                 parallel=True,
+                                 parallel_merge=name.startswith('Tree'),
+                                 hashed_deposits=name.endswith('Hashed'),
+                                 input_masks=[0x0, 0x1, 0x2, 0x3],
+                                 output_mask=mask,
+                                 output_segment='deposits',
+                                 erase_combined=False)
+    digi.check_creation([combine])
+  compare = event.adopt_action('DigiTestCompareDeposits/Compare',
+                               reference_mask=masks['Sequential'],
+                               compare_mask=masks['Tree'])
+  compare_hashed = event.adopt_action('DigiTestCompareDeposits/CompareHashed',
+                                      reference_mask=masks['SequentialHashed'],
+                                      compare_mask=masks['TreeHashed'])
+  dump = event.adopt_action('DigiStoreDump/StoreDump')
+  digi.check_creation([compare, compare_hashed, dump])
+  digi.info('Created event.dump')
+
+  # ========================================================================================================
+  digi.run_checked(num_events=5, num_threads=10, parallel=3)
+
+
+if __name__ == '__main__':
+  run()
@@ -0,0 +1,58 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import
+
+
+def run():
+  import DigiTest
+  digi = DigiTest.Test(geometry=None)
+
+  input_action = digi.input_action('DigiParallelActionSequence/READER')
+  # ========================================================================================================
+  digi.info('Created SIGNAL input')
+  signal = input_action.adopt_action('DigiDDG4ROOT/SignalReader', mask=0x0, input=[digi.next_input()])
+  digi.check_creation([signal])
+  # ========================================================================================================
+  digi.info('Creating pile-up input with a pool of decoded minimum bias events....')
+  # ========================================================================================================
+  pileup = input_action.adopt_action('DigiPileupInput/Pileup',
+                                     mean_pileup=3.0,
+                                     max_pileup=8,
+                                     first_mask=0x1,
+                                     pool_size=4,
+                                     pool_memory=256,
+                                     max_reuse=3)
+  minbias = digi.create_action('DigiDDG4ROOT/MinBiasReader', mask=0x1, keep_raw=False, input=[digi.next_input()])
+  pileup.adopt(minbias)
+  digi.check_creation([pileup, minbias])
+  digi.info('Created input.pileup')
+  # ========================================================================================================
+  event = digi.event_action('DigiSequentialActionSequence/EventAction')
+  # Particle keys and history records of every pile-up event must carry its own mask
+  check = event.adopt_action('DigiTestHistoryCheck/HistoryCheck', segment='inputs')
+  # Particles of several pile-up events from the same pool entry must not clash
+  combine = event.adopt_action('DigiContainerCombine/Combine',
+                               parallel=False,
+                               input_masks=[i for i in range(9)],
+                               output_mask=0xFEED,
+                               output_segment='deposits',
+                               merge_particles=True,
+                               erase_combined=True)
+  dump = event.adopt_action('DigiStoreDump/StoreDump')
+  digi.check_creation([check, combine, dump])
+  digi.info('Created event.dump')
+
+  # ========================================================================================================
+  digi.run_checked(num_events=10, num_threads=5, parallel=3)
+
+
+if __name__ == '__main__':
+  run()
@@ -0,0 +1,44 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import
+
+
+def run():
+  import DigiTest
+  digi = DigiTest.Test(geometry=None)
+
+  input_action = digi.input_action('DigiParallelActionSequence/READER')
+  # ========================================================================================================
+  digi.info('Created SIGNAL input')
+  signal = input_action.adopt_action('DigiDDG4ROOT/SignalReader', mask=0x0, input=[digi.next_input()])
+  overlay = input_action.adopt_action('DigiDDG4ROOT/Reader-1', mask=0x1, input=[digi.next_input()])
+  digi.check_creation([signal, overlay])
+  # ========================================================================================================
+  event = digi.event_action('DigiSequentialActionSequence/EventAction')
+  combine = event.adopt_action('DigiContainerCombine/Combine',
+                               parallel=False,
+                               input_masks=[0x0, 0x1],
+                               output_mask=0xFEED,
+                               output_segment='deposits',
+                               erase_combined=True)
+  dump = event.adopt_action('DigiStoreDump/StoreDump')
+  digi.check_creation([combine, dump])
+  digi.info('Created event.dump')
+  # ========================================================================================================
+  # Execute input, event and output sequences as separate stages with at most 4 events in flight
+  kernel = digi.kernel()
+  kernel.pipeline = True
+  kernel.pipelineTokens = 4
+  digi.run_checked(num_events=10, num_threads=5, parallel=3)
+
+
+if __name__ == '__main__':
+  run()
@@ -0,0 +1,52 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import
+
+
+def run():
+  import DigiTest
+  digi = DigiTest.Test(geometry=None)
+
+  input_action = digi.input_action('DigiParallelActionSequence/READER')
+  # ========================================================================================================
+  digi.info('Created SIGNAL input')
+  signal = input_action.adopt_action('DigiDDG4ROOT/SignalReader', mask=0x0, input=[digi.next_input()])
+  overlay = input_action.adopt_action('DigiDDG4ROOT/Reader-1', mask=0x1, input=[digi.next_input()])
+  digi.check_creation([signal, overlay])
+  # ========================================================================================================
+  event = digi.event_action('DigiSequentialActionSequence/EventAction')
+  event.adopt_action('DigiContainerCombine/Combine',
+                     parallel=True,
+                     input_masks=[0x0, 0x1],
+                     input_segment='inputs',
+                     output_mask=0xFEED,
+                     output_segment='deposits',
+                     erase_combined=True)
+  # Many small containers written in parallel to the same output segment
+  proc = event.adopt_action('DigiContainerSequenceAction/ADCsequence',
+                            parallel=True,
+                            input_mask=0xFEED,
+                            input_segment='deposits',
+                            output_mask=0xBABE,
+                            output_segment='output')
+  proc.adopt_container_processor(digi.create_action('DigiSimpleADCResponse/ADCCreate'), digi.containers())
+  event.adopt_action('DigiStoreDump/StoreDump')
+  digi.info('Created event.dump')
+  # ========================================================================================================
+  # Event data of known containers are published to pre-allocated segment slots without locking.
+  # The slots are learned from the first events.
+  kernel = digi.kernel()
+  kernel.segmentSlots = True
+  digi.run_checked(num_events=10, num_threads=10, parallel=5)
+
+
+if __name__ == '__main__':
+  run()
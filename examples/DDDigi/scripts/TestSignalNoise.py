@@ -0,0 +1,64 @@
+# ==========================================================================
+#  AIDA Detector description implementation
+# --------------------------------------------------------------------------
+# Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+# All rights reserved.
+#
+# For the licensing terms see $DD4hepINSTALL/LICENSE.
+# For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+#
+# ==========================================================================
+from __future__ import absolute_import
+
+
+def run():
+  import DigiTest
+  from dd4hep import units
+  digi = DigiTest.Test(geometry=None)
+
+  # ========================================================================================================
+  input_action = digi.input_action('DigiSequentialActionSequence/READER')
+  input_action.adopt_action('DigiDDG4ROOT/SignalReader', mask=0x0, input=[digi.next_input()])
+  # ========================================================================================================
+  event = digi.event_action('DigiSequentialActionSequence/EventAction')
+  event.adopt_action('DigiContainerCombine/Combine',
+                     parallel=True,
+                     input_masks=[0x0],
+                     input_segment='inputs',
+                     output_mask=0xFEED,
+                     output_segment='deposits',
+                     erase_combined=False)
+  # Bulk noise on the energy deposits
+  proc = event.adopt_action('DigiContainerSequenceAction/DepositNoise',
+                            parallel=True,
+                            input_mask=0xFEED,
+                            input_segment='deposits')
+  noise = digi.create_action('DigiContainerSignalProcessor/DepositNoise')
+  noise.adopt_tool(digi.create_action('DigiGaussianNoise/Gauss', sigma=20 * units.keV), 'DigiSignalProcessor')
+  noise.adopt_tool(digi.create_action('DigiExponentialNoise/Exponential', tau=5 * units.keV), 'DigiSignalProcessor')
+  proc.adopt_container_processor(noise, digi.containers())
+  # ADC response
+  proc = event.adopt_action('DigiContainerSequenceAction/ADCsequence',
+                            parallel=True,
+                            input_mask=0xFEED,
+                            input_segment='deposits',
+                            output_mask=0xBABE,
+                            output_segment='output')
+  proc.adopt_container_processor(digi.create_action('DigiSimpleADCResponse/ADCCreate'), digi.containers())
+  # Bulk noise on the ADC values
+  proc = event.adopt_action('DigiContainerSequenceAction/ADCNoise',
+                            parallel=True,
+                            input_mask=0xBABE,
+                            input_segment='output')
+  noise = digi.create_action('DigiContainerSignalProcessor/ADCNoise')
+  noise.adopt_tool(digi.create_action('DigiGaussianNoise/ADCGauss', sigma=2.0), 'DigiSignalProcessor')
+  noise.adopt_tool(digi.create_action('DigiPoissonNoise/ADCPoisson', mean=1.0, cutoff=5.0), 'DigiSignalProcessor')
+  proc.adopt_container_processor(noise, [c + '.adc' for c in digi.containers()])
+  event.adopt_action('DigiStoreDump/DumpOutput')
+
+  # ========================================================================================================
+  digi.run_checked(num_events=5, num_threads=10, parallel=3)
+
+
+if __name__ == '__main__':
+  run()
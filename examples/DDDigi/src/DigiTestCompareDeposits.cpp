@@ -0,0 +1,184 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DD4hep/InstanceCount.h>
+#include <DDDigi/DigiData.h>
+#include <DDDigi/DigiContext.h>
+#include <DDDigi/DigiEventAction.h>
+
+// C/C++ include files
+#include <algorithm>
+#include <cmath>
+#include <mutex>
+#include <tuple>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    /// Compare the deposit containers of two masks cell by cell
+    /**
+     *  All deposit containers of the reference mask are compared to the containers
+     *  with the same item name and the compare mask. Deposit columns are accepted
+     *  as well. The deposits of both containers are sorted by cell identifier
+     *  and energy and must agree within the relative tolerance in energy and time.
+     *  Differences are reported as errors.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiTestCompareDeposits : public DigiEventAction   {
+    protected:
+      using entry_t = std::tuple<CellID, double, double>;
+
+      /// Property: Segment of the reference containers
+      std::string m_reference_segment  { "deposits" };
+      /// Property: Segment of the containers to be compared
+      std::string m_compare_segment    { "deposits" };
+      /// Property: Mask of the reference containers
+      int         m_reference_mask     { 0 };
+      /// Property: Mask of the containers to be compared
+      int         m_compare_mask       { 0 };
+      /// Property: Relative tolerance of deposit energy and time
+      double      m_tolerance          { 1e-9 };
+
+      /// Lock to protect the monitoring counters
+      mutable std::mutex  m_lock;
+      /// Monitoring: number of compared containers
+      mutable std::size_t m_num_containers  { 0 };
+      /// Monitoring: number of compared deposits
+      mutable std::size_t m_num_deposits    { 0 };
+      /// Monitoring: number of differences
+      mutable std::size_t m_num_differences { 0 };
+
+    protected:
+      /// Define standard assignments and constructors
+      DDDIGI_DEFINE_ACTION_CONSTRUCTORS(DigiTestCompareDeposits);
+
+      /// Extract the deposits of a deposit container sorted by cell and energy. False for other data
+      bool entries(const std::any& data, std::vector<entry_t>& result)  const;
+      /// Compare two values within the relative tolerance
+      bool equal(double a, double b)  const   {
+        return std::fabs(a-b) <= m_tolerance * (std::fabs(a) + std::fabs(b)) || a == b;
+      }
+
+    public:
+      /// Standard constructor
+      DigiTestCompareDeposits(const kernel_t& kernel, const std::string& nam)
+        : DigiEventAction(kernel, nam)
+      {
+        declareProperty("reference_segment", m_reference_segment);
+        declareProperty("compare_segment",   m_compare_segment);
+        declareProperty("reference_mask",    m_reference_mask);
+        declareProperty("compare_mask",      m_compare_mask);
+        declareProperty("tolerance",         m_tolerance);
+        InstanceCount::increment(this);
+      }
+      /// Default destructor
+      virtual ~DigiTestCompareDeposits()   {
+        info("+++ Compared %ld containers with %ld deposits: %ld differences.",
+             m_num_containers, m_num_deposits, m_num_differences);
+        InstanceCount::decrement(this);
+      }
+      /// Main functional callback
+      virtual void execute(context_t& context)  const override;
+    };
+  }    // End namespace digi
+}      // End namespace dd4hep
+
+using namespace dd4hep::digi;
+
+/// Extract the deposits of a deposit container sorted by cell and energy. False for other data
+bool DigiTestCompareDeposits::entries(const std::any& data, std::vector<entry_t>& result)  const   {
+  auto fill = [&result] (const auto& container)  {
+    result.reserve(container.size());
+    for( const auto& dep : container )
+      result.emplace_back(dep.first, dep.second.deposit, dep.second.time);
+  };
+  if ( const auto* v = std::any_cast<DepositVector>(&data) )
+    fill(*v);
+  else if ( const auto* m = std::any_cast<DepositMapping>(&data) )
+    fill(*m);
+  else if ( const auto* h = std::any_cast<DepositHashMapping>(&data) )
+    fill(*h);
+  else if ( const auto* c = std::any_cast<DepositColumns>(&data) )   {
+    result.reserve(c->size());
+    for( std::size_t i = 0; i < c->size(); ++i )
+      result.emplace_back(c->cell[i], c->deposit[i], c->time[i]);
+  }
+  else
+    return false;
+  std::sort(result.begin(), result.end());
+  return true;
+}
+
+/// Main functional callback
+void DigiTestCompareDeposits::execute(context_t& context)  const   {
+  const auto& event     = *context.event;
+  const auto& reference = event.get_segment(m_reference_segment);
+  const auto& compare   = event.get_segment(m_compare_segment);
+  std::size_t num_containers = 0, num_deposits = 0, num_differences = 0;
+
+  for( const auto& ref : reference )   {
+    Key key(ref.first);
+    if ( key.mask() != m_reference_mask )
+      continue;
+    std::vector<entry_t> ref_entries, cmp_entries;
+    if ( !entries(ref.second, ref_entries) )
+      continue;
+    key.set_mask(m_compare_mask);
+    key.set_segment(compare.id);
+    const std::any* cmp = compare.entry(key);
+    if ( !cmp )   {
+      error("%s+++ %-32s No container with mask %04X to compare.",
+            event.id(), Key::key_name(key).c_str(), m_compare_mask);
+      ++num_differences;
+      continue;
+    }
+    std::size_t diff = 0;
+    if ( !entries(*cmp, cmp_entries) || ref_entries.size() != cmp_entries.size() )   {
+      diff = std::max(ref_entries.size(), cmp_entries.size());
+    }
+    else   {
+      for( std::size_t i=0; i < ref_entries.size(); ++i )   {
+        const auto& r = ref_entries[i];
+        const auto& c = cmp_entries[i];
+        if ( std::get<0>(r) != std::get<0>(c) ||
+             !equal(std::get<1>(r), std::get<1>(c)) ||
+             !equal(std::get<2>(r), std::get<2>(c)) )
+          ++diff;
+      }
+    }
+    if ( diff > 0 )   {
+      error("%s+++ %-32s Masks %04X / %04X: %ld / %ld deposits, %ld differ.",
+            event.id(), Key::key_name(key).c_str(), m_reference_mask, m_compare_mask,
+            ref_entries.size(), cmp_entries.size(), diff);
+    }
+    ++num_containers;
+    num_deposits    += ref_entries.size();
+    num_differences += diff;
+  }
+  info("%s+++ Compared %ld containers with %ld deposits: %ld differences.",
+       event.id(), num_containers, num_deposits, num_differences);
+  std::lock_guard<std::mutex> lock(m_lock);
+  m_num_containers  += num_containers;
+  m_num_deposits    += num_deposits;
+  m_num_differences += num_differences;
+}
+
+#include <DDDigi/DigiFactories.h>
+DECLARE_DIGIACTION_NS(dd4hep::digi,DigiTestCompareDeposits)
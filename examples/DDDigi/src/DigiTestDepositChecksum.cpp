@@ -0,0 +1,104 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DD4hep/InstanceCount.h>
+#include <DDDigi/DigiData.h>
+#include <DDDigi/DigiContext.h>
+#include <DDDigi/DigiEventAction.h>
+#include <DDDigi/DigiPhiloxEngine.h>
+
+// C/C++ include files
+#include <cstring>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    /// Print a checksum of the deposit containers of one mask together with the event input identity
+    /**
+     *  The checksum covers cell identifier, energy and time of all deposits bit by bit.
+     *  It does not depend on the order of the deposits in the container.
+     *  Since the lines are tagged with the input identity and not with the event number,
+     *  the printout of two jobs may be compared independent of the event scheduling.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiTestDepositChecksum : public DigiEventAction   {
+    protected:
+      /// Property: Segment of the deposit containers
+      std::string m_segment  { "deposits" };
+      /// Property: Mask of the deposit containers
+      int         m_mask     { 0 };
+
+    protected:
+      /// Define standard assignments and constructors
+      DDDIGI_DEFINE_ACTION_CONSTRUCTORS(DigiTestDepositChecksum);
+
+      /// Checksum of one deposit container
+      template <typename T> uint64_t checksum(const T& container)  const   {
+        uint64_t sum = 0;
+        for( const auto& dep : container )   {
+          uint64_t deposit, time;
+          std::memcpy(&deposit, &dep.second.deposit, sizeof(deposit));
+          std::memcpy(&time,    &dep.second.time,    sizeof(time));
+          sum += DigiPhiloxEngine::mix(DigiPhiloxEngine::mix(dep.first, deposit), time);
+        }
+        return sum;
+      }
+
+    public:
+      /// Standard constructor
+      DigiTestDepositChecksum(const kernel_t& kernel, const std::string& nam)
+        : DigiEventAction(kernel, nam)
+      {
+        declareProperty("segment", m_segment);
+        declareProperty("mask",    m_mask);
+        InstanceCount::increment(this);
+      }
+      /// Default destructor
+      virtual ~DigiTestDepositChecksum()   {
+        InstanceCount::decrement(this);
+      }
+      /// Main functional callback
+      virtual void execute(context_t& context)  const override   {
+        const auto& event   = *context.event;
+        const auto& segment = event.get_segment(m_segment);
+        for( const auto& i : segment )   {
+          Key key(i.first);
+          std::size_t count = 0;
+          uint64_t    sum   = 0;
+          if ( key.mask() != m_mask )
+            continue;
+          else if ( const auto* v = std::any_cast<DepositVector>(&i.second) )
+            count = v->size(), sum = checksum(*v);
+          else if ( const auto* m = std::any_cast<DepositMapping>(&i.second) )
+            count = m->size(), sum = checksum(*m);
+          else if ( const auto* h = std::any_cast<DepositHashMapping>(&i.second) )
+            count = h->size(), sum = checksum(*h);
+          else
+            continue;
+          always("+++ Checksum input:%016lX %-32s %6ld deposits: %016lX",
+                 event.input_identity(), Key::key_name(key).c_str(), count, sum);
+        }
+      }
+    };
+  }    // End namespace digi
+}      // End namespace dd4hep
+
+#include <DDDigi/DigiFactories.h>
+DECLARE_DIGIACTION_NS(dd4hep::digi,DigiTestDepositChecksum)
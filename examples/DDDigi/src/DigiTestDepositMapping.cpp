@@ -0,0 +1,94 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+/// Framework include files
+#include <DD4hep/Factories.h>
+#include <DD4hep/Printout.h>
+#include <DDDigi/DigiData.h>
+
+/// C/C++ include files
+#include <cmath>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <algorithm>
+#include <iostream>
+
+using namespace dd4hep;
+
+namespace  {
+
+  /// Create one event worth of deposits with random cell identifiers
+  digi::DepositVector make_deposits(std::mt19937_64& generator, std::size_t event, std::size_t count, std::size_t cells)   {
+    std::uniform_int_distribution<CellID> cell_id(0, cells-1);
+    digi::DepositVector deposits("deposits", int(event&0xFF), digi::SegmentEntry::TRACKER_HITS);
+    for( std::size_t i=0; i < count; ++i )   {
+      digi::EnergyDeposit depo;
+      depo.deposit  = 1e-3;
+      depo.position = Position(1e0, 2e0, 3e0);
+      depo.history.hits.emplace_back(digi::Key(digi::Key::key_type(i)), 1e0);
+      deposits.emplace(cell_id(generator), std::move(depo));
+    }
+    return deposits;
+  }
+
+  /// Merge all events into one container of type OUT and return the elapsed time in milliseconds
+  template <typename OUT>
+  double merge_events(const std::vector<digi::DepositVector>& events, OUT& output)   {
+    auto start = std::chrono::steady_clock::now();
+    for( const auto& ev : events )   {
+      digi::DepositVector input(ev);
+      output.merge(std::move(input));
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop-start).count();
+  }
+
+  /// Remove the deposits of the given cells one by one and return the elapsed time in milliseconds
+  template <typename OUT>
+  double remove_cells(const std::vector<CellID>& cells, OUT& output)   {
+    auto start = std::chrono::steady_clock::now();
+    for( CellID cell : cells )   {
+      auto iter = output.find(cell);
+      if ( iter != output.end() ) output.remove(iter);
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop-start).count();
+  }
+
+  /// Compare the content of both containers and return the number of differences
+  std::size_t compare(const digi::DepositMapping& mapping, const digi::DepositHashMapping& hashed)   {
+    std::size_t errors = compare(mapping, hashed);
+
+  /// Remove every second cell one by one
+  std::vector<CellID> cells_to_remove;
+  std::size_t num_cells = 0;
+  for( const auto& depo : mapping )   {
+    if ( (num_cells++)%2 == 0 ) cells_to_remove.emplace_back(depo.first);
+  }
+  std::shuffle(cells_to_remove.begin(), cells_to_remove.end(), generator);
+  double remove_mapping = remove_cells(cells_to_remove, mapping);
+  double remove_hashed  = remove_cells(cells_to_remove, hashed);
+  errors += compare(mapping, hashed);
+
+  printout(INFO, "DepositMapping", "Merged %ld events with %ld deposits each into %ld cells",
+           events, deposits, mapping.size());
+  printout(INFO, "DepositMapping", "DepositMapping     merge time: %9.2f ms", time_mapping);
+  printout(INFO, "DepositMapping", "DepositHashMapping merge time: %9.2f ms", time_hashed);
+  printout(INFO, "DepositMapping", "Removed %ld cells one by one", cells_to_remove.size());
+  printout(INFO, "DepositMapping", "DepositMapping     remove time: %9.2f ms", remove_mapping);
+  printout(INFO, "DepositMapping", "DepositHashMapping remove time: %9.2f ms", remove_hashed);
+  printout(errors ? ERROR : INFO, "DepositMapping", "Comparison of merged containers: %ld differences", errors);
+  return errors ? 0 : 1;
+}
+DECLARE_APPLY(DD4hep_DigiDepositMappingBenchmark,benchmark_deposit_mapping)
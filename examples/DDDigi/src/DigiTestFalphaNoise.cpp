@@ -17,8 +17,11 @@
 #include <DDDigi/noise/FalphaNoise.h>
 
 /// C/C++ include files
+#include <cmath>
 #include <random>
+#include <vector>
 #include <iostream>
+#include <algorithm>
 
 #include <TH1.h>
 #include <TCanvas.h>
@@ -105,6 +108,24 @@ static long test_FalphaNoise(Detector& , int argc, char** argv) {
   printout(INFO, "FalphaNoise", "Distribution  Mean Uncertainty %10.5f", hist11->GetMeanError());
   printout(INFO, "FalphaNoise", "Distribution  RMS              %10.5f", hist11->GetRMS());
   printout(INFO, "FalphaNoise", "Distribution  RMS  Uncertainty %10.5f", hist11->GetRMSError());
+
+  /// Bulk transform of white noise generated in chunks: must give the same distribution
+  FalphaNoise bulk(poles, alpha, variance);
+  std::normal_distribution<double> white(0e0, 1e0);
+  std::vector<double> values(1000);
+  TH1D* hist15 = new TH1D("D15", ("Bulk 1/f**alpha"+cpara.str()).c_str(), 50, -5e0*variance, 5e0*variance);
+  for(size_t done=0; done < shots; done += values.size())  {
+    size_t count = std::min(values.size(), shots-done);
+    for(size_t i=0; i < count; ++i)
+      values[i] = white(generator);
+    bulk.transform(values.data(), count);
+    for(size_t i=0; i < count; ++i)
+      hist15->Fill(values[i], 1.);
+  }
+  double delta = std::abs(hist15->GetRMS() - hist11->GetRMS());
+  double sigma = std::sqrt(std::pow(hist15->GetRMSError(),2) + std::pow(hist11->GetRMSError(),2));
+  printout(delta > 5e0*sigma ? ERROR : INFO, "FalphaNoise",
+           "Bulk transform RMS             %10.5f  [delta: %.5f]", hist15->GetRMS(), delta);
   hist11->GetXaxis()->SetTitle("Energy [arb.units]");
   hist11->GetYaxis()->SetTitle("Counts");
   hist21->GetXaxis()->SetTitle("exp(Energy) [arb.units]");
@@ -0,0 +1,154 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+// Framework include files
+#include <DD4hep/InstanceCount.h>
+#include <DDDigi/DigiData.h>
+#include <DDDigi/DigiContext.h>
+#include <DDDigi/DigiEventAction.h>
+
+// C/C++ include files
+#include <mutex>
+
+/// Namespace for the AIDA detector description toolkit
+namespace dd4hep {
+
+  /// Namespace for the Digitization part of the AIDA detector description toolkit
+  namespace digi {
+
+    /// Check the history records of the deposit containers in a data segment
+    /**
+     *  The particle keys and the history records of all deposits must carry
+     *  the mask of their container and the particles must be resolvable
+     *  in the event. Owned containers and shared views (pile-up) are checked.
+     *  Differences are reported as errors.
+     *
+     *  \author  M.Frank
+     *  \version 1.0
+     *  \ingroup DD4HEP_DIGITIZATION
+     */
+    class DigiTestHistoryCheck : public DigiEventAction   {
+    protected:
+      /// Property: Segment of the containers to be checked
+      std::string m_segment  { "inputs" };
+
+      /// Lock to protect the monitoring counters
+      mutable std::mutex  m_lock;
+      /// Monitoring: number of checked history entries
+      mutable std::size_t m_num_entries { 0 };
+      /// Monitoring: number of bad history entries
+      mutable std::size_t m_num_errors  { 0 };
+
+    protected:
+      /// Define standard assignments and constructors
+      DDDIGI_DEFINE_ACTION_CONSTRUCTORS(DigiTestHistoryCheck);
+
+      /// Access owned container or shared view
+      template <typename T> static const T* data(const std::any& item)   {
+        if ( const auto* ptr = std::any_cast<T>(&item) )
+          return ptr;
+        else if ( const auto* view = std::any_cast<shared_view_t<T> >(&item) )
+          return view->get();
+        return nullptr;
+      }
+      /// Check the history entries of one deposit container
+      template <typename T>
+      std::size_t check(const DigiEvent& event, Key key, const T& cont, std::size_t& entries)  const;
+
+    public:
+      /// Standard constructor
+      DigiTestHistoryCheck(const kernel_t& kernel, const std::string& nam)
+        : DigiEventAction(kernel, nam)
+      {
+        declareProperty("segment", m_segment);
+        InstanceCount::increment(this);
+      }
+      /// Default destructor
+      virtual ~DigiTestHistoryCheck()   {
+        info("+++ Checked %ld history entries: %ld errors.", m_num_entries, m_num_errors);
+        InstanceCount::decrement(this);
+      }
+      /// Main functional callback
+      virtual void execute(context_t& context)  const override;
+    };
+  }    // End namespace digi
+}      // End namespace dd4hep
+
+using namespace dd4hep::digi;
+
+/// Check the history entries of one deposit container
+template <typename T> std::size_t
+DigiTestHistoryCheck::check(const DigiEvent& event, Key key, const T& cont, std::size_t& entries)  const   {
+  std::size_t errors = 0;
+  for( const auto& dep : cont )   {
+    const auto& history = dep.second.history;
+    for( const auto& entry : history.hits )   {
+      ++entries;
+      if ( Key(entry.source).mask() != key.mask() )
+        ++errors;
+    }
+    for( const auto& entry : history.particles )   {
+      ++entries;
+      if ( Key(entry.source).mask() != key.mask() )   {
+        ++errors;
+        continue;
+      }
+      try   {
+        entry.get_particle(event);
+      }
+      catch(const std::exception&)   {
+        ++errors;
+      }
+    }
+  }
+  if ( errors > 0 )   {
+    error("%s+++ %-32s %ld history entries with wrong mask or unresolved particle.",
+          event.id(), Key::key_name(key).c_str(), errors);
+  }
+  return errors;
+}
+
+/// Main functional callback
+void DigiTestHistoryCheck::execute(context_t& context)  const   {
+  const auto& event   = *context.event;
+  const auto& segment = event.get_segment(m_segment);
+  std::size_t entries = 0, errors = 0;
+
+  for( const auto& i : segment )   {
+    Key key(i.first);
+    if ( const auto* v = data<DepositVector>(i.second) )
+      errors += check(event, key, *v, entries);
+    else if ( const auto* m = data<DepositMapping>(i.second) )
+      errors += check(event, key, *m, entries);
+    else if ( const auto* h = data<DepositHashMapping>(i.second) )
+      errors += check(event, key, *h, entries);
+    else if ( const auto* p = data<ParticleMapping>(i.second) )   {
+      std::size_t bad = 0;
+      for( const auto& part : *p )
+        bad += Key(part.first).mask() != key.mask() ? 1 : 0;
+      if ( bad > 0 )   {
+        error("%s+++ %-32s %ld particles with wrong mask.",
+              event.id(), Key::key_name(key).c_str(), bad);
+      }
+      entries += p->size();
+      errors  += bad;
+    }
+  }
+  info("%s+++ Checked %ld history entries: %ld errors.", event.id(), entries, errors);
+  std::lock_guard<std::mutex> lock(m_lock);
+  m_num_entries += entries;
+  m_num_errors  += errors;
+}
+
+#include <DDDigi/DigiFactories.h>
+DECLARE_DIGIACTION_NS(dd4hep::digi,DigiTestHistoryCheck)
@@ -0,0 +1,101 @@
+//==========================================================================
+//  AIDA Detector description implementation
+//--------------------------------------------------------------------------
+// Copyright (C) Organisation europeenne pour la Recherche nucleaire (CERN)
+// All rights reserved.
+//
+// For the licensing terms see $DD4hepINSTALL/LICENSE.
+// For the list of contributors see $DD4hepINSTALL/doc/CREDITS.
+//
+// Author     : M.Frank
+//
+//==========================================================================
+
+/// Framework include files
+#include <DD4hep/Factories.h>
+#include <DD4hep/Printout.h>
+#include <DDDigi/DigiPhiloxEngine.h>
+#include <DDDigi/DigiRandomGenerator.h>
+
+/// C/C++ include files
+#include <cmath>
+#include <chrono>
+#include <cstring>
+#include <vector>
+#include <iostream>
+
+using namespace dd4hep;
+
+namespace  {
+
+  /// Check mean and RMS of a buffer of random numbers against the expectation
+  std::size_t check(const char* tag, const std::vector<double>& values, double mean, double rms)   {
+    double sum = 0e0, sum2 = 0e0;
+    for( double v : values )   {
+      sum  += v;
+      sum2 += v*v;
+    }
+    double m = sum / double(values.size());
+    double r = std::sqrt(sum2 / double(values.size()) - m*m);
+    bool   ok = std::abs(m - mean) < 0.01*std::max(1e0, rms) && std::abs(r - rms) < 0.01*std::max(1e0, rms);
+    printout(ok ? INFO : ERROR, "RandomBatch", "%-12s mean: %9.4f [%9.4f]  rms: %9.4f [%9.4f]",
+             tag, m, mean, r, rms);
+    return ok ? 0 : 1;
+  }
+}
+
+/// Plugin to benchmark the bulk random number interface of the DigiRandomGenerator
+/**
+ *  Factory: DD4hep_DigiRandomBatchBenchmark
+ *
+ *  Generates gaussian random numbers one by one and in bulk,
+ *  prints the time spent by each of them and checks the
+ *  moments of the bulk distributions.
+ *
+ *  \author  M.Frank
+ *  \version 1.0
+ */
+static long benchmark_random_batch(Detector& , int argc, char** argv) {
+  std::size_t shots = 1000000;
+  for(int i = 0; i < argc && argv[i]; ++i)  {
+    if ( 0 == ::strncmp("-shots",argv[i],3) )
+      shots = ::atol(argv[++i]);
+    else  {
+      std::cout <<
+        "Usage: -plugin DD4hep_DigiRandomBatchBenchmark -arg [-arg]                 \n"
+        "     -shots    <value>  Number of random numbers [default: 1000000]        \n"
+        "\tArguments given: " << arguments(argc,argv) << std::endl << std::flush;
+      ::exit(EINVAL);
+    }
+  }
+  digi::DigiPhiloxEngine    engine(65539);
+  digi::DigiRandomGenerator generator;
+  generator.engine = [&engine] ()  {  return engine();  };
+  generator.batch  = [&engine] (double* buffer, std::size_t count)  {  engine.fill(buffer, count);  };
+
+  std::vector<double> values(shots);
+  auto start = std::chrono::steady_clock::now();
+  for( std::size_t i=0; i < shots; ++i )
+    values[i] = generator.gaussian(0e0, 1e0);
+  auto stop  = std::chrono::steady_clock::now();
+  double time_single = std::chrono::duration<double, std::milli>(stop-start).count();
+
+  start = std::chrono::steady_clock::now();
+  generator.fill_gaussian(values.data(), values.size(), 0e0, 1e0);
+  stop  = std::chrono::steady_clock::now();
+  double time_batch = std::chrono::duration<double, std::milli>(stop-start).count();
+
+  std::size_t errors = check("gaussian", values, 0e0, 1e0);
+  generator.fill_uniform(values.data(), values.size(), 0e0, 1e0);
+  errors += check("uniform", values, 0.5, std::sqrt(1e0/12e0));
+  generator.fill_exponential(values.data(), values.size(), 2e0);
+  errors += check("exponential", values, 2e0, 2e0);
+  generator.fill_poisson(values.data(), values.size(), 5e0);
+  errors += check("poisson", values, 5e0, std::sqrt(5e0));
+
+  printout(INFO, "RandomBatch", "Single gaussian random numbers: %9.2f ms for %ld shots", time_single, shots);
+  printout(INFO, "RandomBatch", "Bulk   gaussian random numbers: %9.2f ms for %ld shots", time_batch,  shots);
+  printout(errors ? ERROR : INFO, "RandomBatch", "Check of bulk random numbers: %ld failures", errors);
+  return errors ? 0 : 1;
+}
+DECLARE_APPLY(DD4hep_DigiRandomBatchBenchmark,benchmark_random_batch)